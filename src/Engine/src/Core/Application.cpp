@@ -8,6 +8,7 @@
 // #include "Platform/Vulkan/VulkanRendererAPI.h"
 #include "DeletionQueue.h"
 #include "JobSystem/JobScheduler.h"
+#include "Memory/FrameAllocator.h"
 #include "Move.h"
 #include "Renderer/GraphicsDevice.h"
 #include "Renderer/Renderer.h"
@@ -27,8 +28,6 @@ namespace BeeEngine
     {
         m_EventQueue.AddEvent(CreateScope<WindowResizeEvent>(
             m_Window->GetWidth(), m_Window->GetHeight(), m_Window->GetWidthInPixels(), m_Window->GetHeightInPixels()));
-        std::condition_variable cv;
-        std::mutex mutex;
         GraphicsDevice& device = m_Window->GetGraphicsDevice();
         device.RequestSwapChainRebuild();
         while (m_Window->IsRunning())
@@ -43,9 +42,12 @@ namespace BeeEngine
             {
                 Renderer::RebuildSwapchain();
             }
-            std::unique_lock lock(mutex);
-            auto frameJob = Jobs::CreateJob<Jobs::Priority::Normal, 1024 * 1024>(
-                [this](std::condition_variable& cv)
+            // Frame job is high priority, so the main thread picks it up itself
+            // instead of sleeping while a worker runs it
+            Jobs::Counter frameCounter;
+            auto frameJob = Jobs::CreateJob<Jobs::Priority::High, 1024 * 1024>(
+                frameCounter,
+                [this]()
                 {
                     BeeCoreTrace("Dispatching events");
                     m_EventQueue.Dispatch();
@@ -57,7 +59,6 @@ namespace BeeEngine
                     {
                         auto error = BeeMove(result).Error();
                         BeeCoreAssert(error == RendererAPI::Error::SwapchainOutdated, "Unhandled RenderedAPI error");
-                        cv.notify_one();
                         return;
                     }
                     auto frameData = BeeMove(result).Value();
@@ -75,13 +76,11 @@ namespace BeeEngine
                     Renderer::EndFrame(frameData);
                     BeeCoreTrace("Flush frame queue");
                     DeletionQueue::Frame().Flush();
+                    FrameAllocator::NextFrame();
                     BeeCoreTrace("Flushed");
-
-                    cv.notify_one();
-                },
-                cv);
-            Jobs::Schedule(frameJob);
-            cv.wait(lock);
+                });
+            Jobs::Schedule(BeeMove(frameJob));
+            Jobs::WaitForJobsToCompleteAndHelp(frameCounter, Jobs::Priority::High);
             BeeCoreTrace("End Frame");
         }
         DeletionQueue::Main().Flush();
@@ -151,6 +150,8 @@ namespace BeeEngine
             case RenderAPI::WebGPU:
                 return;
 #endif
+            case RenderAPI::Null:
+                return;
             default:
                 BeeCoreWarn("Unable to use {} as render API", ToString(properties.PreferredRenderAPI));
                 // properties.PreferredRenderAPI = RenderAPI::WebGPU;
@@ -5,17 +5,56 @@
 #include "MeshSource.h"
 
 #include "Core/Application.h"
+#include "Core/CodeSafety/Expects.h"
+#include <algorithm>
 
 namespace BeeEngine
 {
-    MeshSource::MeshSource(std::vector<Ref<Mesh>>&& meshes) : m_Meshes(std::move(meshes))
+    MeshSource::MeshSource(std::vector<Ref<Mesh>>&& meshes, std::vector<std::vector<Ref<Mesh>>>&& lods)
+        : m_Meshes(std::move(meshes)), m_LodMeshes(std::move(lods))
     {
+        BeeExpects(m_LodMeshes.empty() || m_LodMeshes.size() == m_Meshes.size());
+        m_LodMeshes.resize(m_Meshes.size());
         m_Models.reserve(m_Meshes.size());
+        m_LodModels.resize(m_Meshes.size());
         auto& meshDefaultMaterial =
             Application::GetInstance().GetAssetManager().GetMaterial("Renderer_DefaultMeshMaterial");
-        for (auto& mesh : m_Meshes)
+        for (size_t i = 0; i < m_Meshes.size(); ++i)
         {
-            m_Models.emplace_back(*mesh, meshDefaultMaterial);
+            m_Models.emplace_back(*m_Meshes[i], meshDefaultMaterial);
+            BeeExpects(m_LodMeshes[i].size() < MaxLodLevels);
+            m_LodModels[i].reserve(m_LodMeshes[i].size());
+            for (auto& lod : m_LodMeshes[i])
+            {
+                m_LodModels[i].emplace_back(*lod, meshDefaultMaterial);
+            }
         }
     }
+
+    Model& MeshSource::GetModel(size_t mesh, uint32_t lod)
+    {
+        BeeExpects(mesh < m_Models.size());
+        auto& lods = m_LodModels[mesh];
+        if (lod == 0 || lods.empty())
+        {
+            return m_Models[mesh];
+        }
+        return lods[std::min<size_t>(lod, lods.size()) - 1];
+    }
+
+    uint32_t MeshSource::GetLodCount(size_t mesh) const
+    {
+        BeeExpects(mesh < m_Models.size());
+        return static_cast<uint32_t>(m_LodModels[mesh].size()) + 1;
+    }
+
+    uint32_t MeshSource::SelectLod(float screenSize)
+    {
+        uint32_t lod = 0;
+        while (lod < LodScreenSizes.size() && screenSize <= LodScreenSizes[lod])
+        {
+            ++lod;
+        }
+        return lod;
+    }
 } // namespace BeeEngine
@@ -7,20 +7,41 @@
 #include "Core/TypeDefines.h"
 #include "Renderer/Mesh.h"
 #include "Renderer/Model.h"
+#include "Renderer/RendererStatistics.h"
+#include <array>
 
 namespace BeeEngine
 {
     class MeshSource final : public Asset
     {
     public:
-        MeshSource(std::vector<Ref<Mesh>>&& meshes);
+        static constexpr uint32_t MaxLodLevels = RendererStatistics::MaxLodLevels;
+        // Level i + 1 is selected, when the projected size of the mesh is at most LodScreenSizes[i] of the screen
+        static constexpr std::array<float, MaxLodLevels - 1> LodScreenSizes = {0.25f, 0.125f, 0.0625f};
+
+        /**
+         * @param lods simplified versions of every mesh, that are ordered from detailed to coarse.
+         * Level 0 is the mesh itself and is not stored in lods
+         */
+        MeshSource(std::vector<Ref<Mesh>>&& meshes, std::vector<std::vector<Ref<Mesh>>>&& lods = {});
 
         constexpr AssetType GetType() const override { return AssetType::MeshSource; }
 
         [[nodiscard]] auto& GetModels() { return m_Models; }
+        /**
+         * @brief Model of the mesh at the level of detail, or at the coarsest level, that the mesh has
+         */
+        [[nodiscard]] Model& GetModel(size_t mesh, uint32_t lod);
+        [[nodiscard]] uint32_t GetLodCount(size_t mesh) const;
+        /**
+         * @brief Level of detail for a mesh, that covers screenSize of the screen (see GetScreenSize)
+         */
+        [[nodiscard]] static uint32_t SelectLod(float screenSize);
 
     private:
         std::vector<Ref<Mesh>> m_Meshes;
         std::vector<Model> m_Models;
+        std::vector<std::vector<Ref<Mesh>>> m_LodMeshes;
+        std::vector<std::vector<Model>> m_LodModels;
     };
 } // namespace BeeEngine
@@ -3,7 +3,11 @@
 //
 
 #include "MeshSourceImporter.h"
+#include "Debug/Instrumentor.h"
+#include "Renderer/MeshSimplifier.h"
+#include <algorithm>
 #include <fastgltf/core.hpp>
+#include <limits>
 
 #include "fastgltf/tools.hpp"
 #include <fastgltf/glm_element_traits.hpp>
@@ -25,6 +29,96 @@ namespace BeeEngine
             return MeshSourceFormat::GLTF_BINARY;
         return MeshSourceFormat::Unknown;
     }
+
+    namespace
+    {
+        // Error of the first level of detail relative to the mesh size. Every next level is selected at the half
+        // of the screen size of the previous one, so it may have twice the error
+        constexpr float FirstLodError = 0.005f;
+        // Levels, that remove less than a quarter of the triangles of the previous level, are not worth a mesh
+        constexpr float MinLodReduction = 0.75f;
+
+        /**
+         * @brief Builds simplified versions of the mesh, every level has about half of the triangles of the previous
+         * one. Surfaces are simplified separately, so they keep their materials. Every level is a separate mesh
+         * with only the vertices, that it uses
+         */
+        std::vector<Ref<Mesh>> GenerateLods(const std::vector<MeshDefaultVertex>& vertices,
+                                            const std::vector<uint32_t>& indices,
+                                            const std::vector<GeoSurface>& surfaces,
+                                            const Math::AABB& bounds,
+                                            std::string_view name)
+        {
+            BEE_PROFILE_FUNCTION();
+            std::vector<Ref<Mesh>> lods;
+            std::vector<glm::vec3> positions;
+            positions.reserve(vertices.size());
+            for (const auto& vertex : vertices)
+            {
+                positions.push_back(vertex.position);
+            }
+
+            std::vector<uint32_t> previousIndices = indices;
+            std::vector<GeoSurface> previousSurfaces = surfaces;
+            if (previousSurfaces.empty())
+            {
+                previousSurfaces.push_back({0, static_cast<uint32_t>(indices.size())});
+            }
+            float maxError = FirstLodError;
+            for (uint32_t level = 1; level < MeshSource::MaxLodLevels; ++level, maxError *= 2.0f)
+            {
+                std::vector<uint32_t> lodIndices;
+                std::vector<GeoSurface> lodSurfaces;
+                for (const auto& surface : previousSurfaces)
+                {
+                    const std::span<const uint32_t> surfaceIndices{previousIndices.data() + surface.startIndex,
+                                                                   surface.count};
+                    const size_t target = std::max<size_t>(surface.count / 6 * 3, 3);
+                    auto simplified = SimplifyMesh(surfaceIndices, positions, target, maxError);
+                    if (simplified.Indices.empty())
+                    {
+                        continue;
+                    }
+                    lodSurfaces.push_back(
+                        {static_cast<uint32_t>(lodIndices.size()), static_cast<uint32_t>(simplified.Indices.size())});
+                    lodIndices.insert(lodIndices.end(), simplified.Indices.begin(), simplified.Indices.end());
+                }
+                if (lodIndices.empty() || lodIndices.size() > previousIndices.size() * MinLodReduction)
+                {
+                    break;
+                }
+
+                // Levels reference the vertices of the full mesh, only the used ones are copied
+                std::vector<uint32_t> remap(vertices.size(), std::numeric_limits<uint32_t>::max());
+                std::vector<MeshDefaultVertex> lodVertices;
+                std::vector<uint32_t> compactIndices;
+                compactIndices.reserve(lodIndices.size());
+                for (uint32_t index : lodIndices)
+                {
+                    if (remap[index] == std::numeric_limits<uint32_t>::max())
+                    {
+                        remap[index] = static_cast<uint32_t>(lodVertices.size());
+                        lodVertices.push_back(vertices[index]);
+                    }
+                    compactIndices.push_back(remap[index]);
+                }
+                Ref<Mesh> lod = Mesh::Create(lodVertices.data(),
+                                             lodVertices.size() * sizeof(MeshDefaultVertex),
+                                             lodVertices.size(),
+                                             compactIndices);
+                lod->Surfaces = lodSurfaces;
+                // Same bounds as the full mesh, so the level does not change the culling of the instance
+                lod->SetLocalBounds(bounds);
+                lod->Name = name;
+                lods.emplace_back(std::move(lod));
+
+                previousIndices = std::move(lodIndices);
+                previousSurfaces = std::move(lodSurfaces);
+            }
+            return lods;
+        }
+    } // namespace
+
     Ref<MeshSource> MeshSourceImporter::ImportMeshSource(AssetHandle handle, const AssetMetadata& metadata)
     {
         BeeExpects(metadata.Type == AssetType::MeshSource);
@@ -81,6 +175,7 @@ namespace BeeEngine
 
             }*/
             std::vector<Ref<Mesh>> meshes;
+            std::vector<std::vector<Ref<Mesh>>> lods;
 
             std::vector<uint32_t> indices;
             std::vector<MeshDefaultVertex> vertices;
@@ -179,11 +274,15 @@ namespace BeeEngine
                 Ref<Mesh> newMesh = Mesh::Create(
                     vertices.data(), vertices.size() * sizeof(MeshDefaultVertex), vertices.size(), indices);
                 newMesh->Surfaces = std::move(surfaces);
+                newMesh->SetLocalBounds(Math::AABB::FromVertices(std::span<const MeshDefaultVertex>{vertices},
+                                                                 &MeshDefaultVertex::position));
                 newMesh->Name = mesh.name;
+                lods.push_back(
+                    GenerateLods(vertices, indices, newMesh->Surfaces, newMesh->GetLocalBounds(), newMesh->Name));
                 // newMesh->Location = AssetLocation::MeshSource;
                 meshes.emplace_back(std::move(newMesh));
             }
-            auto result = CreateRef<MeshSource>(std::move(meshes));
+            auto result = CreateRef<MeshSource>(std::move(meshes), std::move(lods));
             result->Handle = handle;
             result->Name = std::string_view{metadata.Name};
             return result;
@@ -0,0 +1,200 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#pragma once
+#include "Core/Coroutines/Task.h"
+#include "JobSystem/JobScheduler.h"
+#include <coroutine>
+#include <tuple>
+#include <vector>
+
+namespace BeeEngine
+{
+    namespace Jobs
+    {
+        /**
+         * @brief Awaiter, that suspends the coroutine and resumes it in a new job.
+         * Use Jobs::ResumeOnWorker to create it
+         */
+        struct ResumeOnWorkerAwaiter
+        {
+            Jobs::Priority Priority;
+            size_t StackSize;
+
+            bool await_ready() const noexcept { return false; }
+
+            void await_suspend(std::coroutine_handle<> handle) const
+            {
+                // The coroutine may be resumed before this function returns, don't touch the awaiter after Schedule
+                Internal::Schedule(Internal::JobWrapper([handle]() { handle.resume(); }, Priority, StackSize, nullptr));
+            }
+
+            void await_resume() const noexcept {}
+        };
+
+        /**
+         * @brief Awaiter, that resumes the coroutine, when the counter reaches zero.
+         * Use Jobs::WaitFor or co_await on a counter to create it
+         */
+        struct CounterAwaiter
+        {
+            Jobs::Counter& Counter;
+            Jobs::Priority Priority;
+
+            bool await_ready() const
+            {
+                if (!Counter.IsZero())
+                {
+                    return false;
+                }
+                // Returns immediately, but lets the last Decrement stop touching the counter
+                Jobs::WaitForJobsToComplete(Counter);
+                return true;
+            }
+
+            void await_suspend(std::coroutine_handle<> handle) const
+            {
+                // Waiting job is parked on the counter and doesn't occupy a worker
+                Internal::Schedule(Internal::JobWrapper(
+                    [handle, &counter = Counter]()
+                    {
+                        Jobs::WaitForJobsToComplete(counter);
+                        handle.resume();
+                    },
+                    Priority,
+                    DefaultStackSize,
+                    nullptr));
+            }
+
+            void await_resume() const noexcept {}
+        };
+
+        /**
+         * @brief Awaiter, that resumes the coroutine in a job after at least the given amount of time.
+         * Use Jobs::Delay to create it
+         */
+        struct DelayAwaiter
+        {
+            Time::millisecondsD Duration;
+            Jobs::Priority Priority;
+
+            bool await_ready() const noexcept { return Duration.count() <= 0.0; }
+
+            void await_suspend(std::coroutine_handle<> handle) const
+            {
+                Internal::Schedule(Internal::JobWrapper(
+                    [handle, time = Duration]()
+                    {
+                        this_job::SleepFor(time);
+                        handle.resume();
+                    },
+                    Priority,
+                    DefaultStackSize,
+                    nullptr));
+            }
+
+            void await_resume() const noexcept {}
+        };
+
+        /**
+         * @brief co_await Jobs::ResumeOnWorker() moves the rest of the coroutine to a worker of the job system.
+         * The coroutine continues in a job with the given priority and stack size,
+         * so it can use job system functions (WaitForJobsToComplete, this_job::SleepFor etc.)
+         * @param priority priority of the job, that resumes the coroutine
+         * @param stackSize stack size of the job, that resumes the coroutine
+         */
+        inline ResumeOnWorkerAwaiter ResumeOnWorker(Jobs::Priority priority = Jobs::Priority::Normal,
+                                                    size_t stackSize = DefaultStackSize)
+        {
+            return {priority, stackSize};
+        }
+
+        /**
+         * @brief co_await Jobs::WaitFor(counter) suspends the coroutine without blocking the thread,
+         * until all jobs of the counter are completed. The coroutine continues in a job with the given priority
+         */
+        inline CounterAwaiter WaitFor(Jobs::Counter& counter, Jobs::Priority priority = Jobs::Priority::Normal)
+        {
+            return {counter, priority};
+        }
+
+        inline CounterAwaiter operator co_await(Jobs::Counter& counter)
+        {
+            return WaitFor(counter);
+        }
+
+        /**
+         * @brief co_await Jobs::Delay(time) suspends the coroutine without blocking the thread
+         * for at least the given amount of time. The coroutine continues in a job with the given priority
+         */
+        inline DelayAwaiter Delay(Time::millisecondsD time, Jobs::Priority priority = Jobs::Priority::Normal)
+        {
+            return {time, priority};
+        }
+    } // namespace Jobs
+
+    namespace Internal
+    {
+        // Runs the task in a job of the counter. Exceptions stay in the task
+        template <typename T>
+        void ScheduleTask(Task<T>& task, Jobs::Counter& counter, Jobs::Priority priority)
+        {
+            Internal::Schedule(
+                Internal::JobWrapper([&task]() { task.Wait(); }, priority, Jobs::DefaultStackSize, &counter));
+        }
+    } // namespace Internal
+
+    /**
+     * @brief Runs all tasks concurrently on the job system and finishes, when all of them are finished.
+     * If one of the tasks throws, the exception of the first such task is rethrown by when_all
+     * after all tasks are finished.
+     * @return tuple with results of the tasks in the same order
+     */
+    template <typename... Ts>
+        requires(sizeof...(Ts) > 0 && (!std::is_void_v<Ts> && ...))
+    Task<std::tuple<Ts...>> when_all(Task<Ts>... tasks)
+    {
+        Jobs::Counter counter;
+        (Internal::ScheduleTask(tasks, counter, Jobs::Priority::Normal), ...);
+        co_await Jobs::WaitFor(counter);
+        co_return std::tuple<Ts...>{tasks.await_resume()...};
+    }
+
+    /**
+     * @brief Runs all tasks concurrently on the job system and finishes, when all of them are finished.
+     * @return results of the tasks in the same order
+     */
+    template <typename T>
+        requires(!std::is_void_v<T>)
+    Task<std::vector<T>> when_all(std::vector<Task<T>> tasks, Jobs::Priority priority = Jobs::Priority::Normal)
+    {
+        Jobs::Counter counter;
+        for (auto& task : tasks)
+        {
+            Internal::ScheduleTask(task, counter, priority);
+        }
+        co_await Jobs::WaitFor(counter, priority);
+        std::vector<T> results;
+        results.reserve(tasks.size());
+        for (auto& task : tasks)
+        {
+            results.push_back(task.await_resume());
+        }
+        co_return results;
+    }
+
+    inline Task<> when_all(std::vector<Task<>> tasks, Jobs::Priority priority = Jobs::Priority::Normal)
+    {
+        Jobs::Counter counter;
+        for (auto& task : tasks)
+        {
+            Internal::ScheduleTask(task, counter, priority);
+        }
+        co_await Jobs::WaitFor(counter, priority);
+        for (auto& task : tasks)
+        {
+            task.await_resume();
+        }
+    }
+} // namespace BeeEngine
@@ -4,14 +4,104 @@
 
 #pragma once
 
+#include "JobSystem/JobScheduler.h"
 #include <coroutine>
 #include <exception>
 #include <functional>
 #include <future>
 #include <thread>
+#include <utility>
 
 namespace BeeEngine
 {
+    namespace Internal
+    {
+        /**
+         * @brief Part of the promise, that is shared by Task<T> and Task<void>.
+         *
+         * A task may finish on a different thread, than the one, that started it
+         * (e.g. after co_await Jobs::ResumeOnWorker()), so completion is tracked with a Jobs::Counter.
+         * Waiting on it parks the job or blocks the thread, that is not a job.
+         */
+        struct TaskPromiseBase
+        {
+            std::exception_ptr m_Exception;
+            std::coroutine_handle<> m_AwaitingCoroutine;
+            Jobs::Counter m_Completion;
+
+            TaskPromiseBase() { m_Completion.Increment(); }
+
+            struct FinalAwaiter
+            {
+                bool await_ready() const noexcept { return false; }
+
+                template <typename Promise>
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept
+                {
+                    auto& promise = handle.promise();
+                    // Read everything before the decrement: after it the frame may be destroyed by the waiter
+                    std::coroutine_handle<> continuation = promise.m_AwaitingCoroutine;
+                    promise.m_Completion.Decrement();
+                    if (continuation)
+                    {
+                        return continuation;
+                    }
+                    return std::noop_coroutine();
+                }
+
+                void await_resume() const noexcept {}
+            };
+
+            std::suspend_always initial_suspend() { return {}; }
+
+            FinalAwaiter final_suspend() noexcept { return {}; }
+
+            void unhandled_exception() { m_Exception = std::current_exception(); }
+
+            // Checks the counter of a started task. Lets the final Decrement stop touching the frame, so the task
+            // can be destroyed right after it returns true
+            bool IsFinished()
+            {
+                if (!m_Completion.IsZero())
+                {
+                    return false;
+                }
+                Jobs::WaitForJobsToComplete(m_Completion);
+                return true;
+            }
+
+            std::coroutine_handle<> Await(std::coroutine_handle<> task,
+                                          std::coroutine_handle<> awaitingCoroutine,
+                                          bool alreadyStarted)
+            {
+                if (!alreadyStarted)
+                {
+                    m_AwaitingCoroutine = awaitingCoroutine;
+                    // Symmetric transfer: the awaiting coroutine is resumed by the final suspend of the task
+                    return task;
+                }
+                // The task is running somewhere else (e.g. was started with Start), it is too late to
+                // become its continuation. The awaiting coroutine is resumed by a job, that waits for it
+                Internal::Schedule(Internal::JobWrapper(
+                    [this, awaitingCoroutine]()
+                    {
+                        Jobs::WaitForJobsToComplete(m_Completion);
+                        awaitingCoroutine.resume();
+                    },
+                    Jobs::Priority::Normal,
+                    Jobs::DefaultStackSize,
+                    nullptr));
+                return std::noop_coroutine();
+            }
+        };
+    } // namespace Internal
+
+    /**
+     * @brief Lazily started coroutine, that may continue on the job system.
+     * IsReady, Wait and get go through Jobs::WaitForJobsToComplete, so they need the running job system,
+     * even if the task has finished on the calling thread. An exception of the task, also of Task<void>,
+     * is rethrown by get and by co_await
+     */
     template <typename T = void>
     class Task
     {
@@ -31,7 +121,7 @@ namespace BeeEngine
 
         Task& operator=(const Task&) = delete;
 
-        Task(Task&& t) noexcept : m_Handle(t.m_Handle) { t.m_Handle = nullptr; }
+        Task(Task&& t) noexcept : m_Handle(t.m_Handle), m_Started(t.m_Started) { t.m_Handle = nullptr; }
 
         Task& operator=(Task&& t) noexcept
         {
@@ -40,42 +130,66 @@ namespace BeeEngine
                 if (m_Handle)
                     m_Handle.destroy();
                 m_Handle = t.m_Handle;
+                m_Started = t.m_Started;
                 t.m_Handle = nullptr;
             }
             return *this;
         }
 
-        T get()
+        /**
+         * @brief Runs the task on the calling thread until its first suspension point.
+         * Does nothing, if the task has already been started
+         */
+        void Start()
         {
-            if (!m_Handle.done())
+            if (!m_Started)
+            {
+                m_Started = true;
                 m_Handle.resume();
-            return m_Handle.promise().m_Value;
+            }
         }
 
-        struct promise_type
+        /**
+         * @brief Checks without blocking, if the started task has finished.
+         * Can be used to poll a task, that continues on the job system, every frame
+         */
+        [[nodiscard]] bool IsReady() const { return m_Started && m_Handle.promise().IsFinished(); }
+
+        /**
+         * @brief Starts the task if needed and waits until it finishes.
+         * Parks the current job or blocks the thread, if the task continues on other threads.
+         * Needs the running job system
+         */
+        void Wait()
         {
-            T m_Value;
-            std::exception_ptr m_Exception;
-            std::coroutine_handle<> m_AwaitingCoroutine;
+            Start();
+            Jobs::WaitForJobsToComplete(m_Handle.promise().m_Completion);
+        }
 
-            Task get_return_object() { return Task{handle_type::from_promise(*this)}; }
+        /**
+         * @brief Waits for the task and returns its result. Rethrows the exception of the task
+         */
+        T get()
+        {
+            Wait();
+            return await_resume();
+        }
 
-            std::suspend_always initial_suspend() { return {}; }
+        struct promise_type : Internal::TaskPromiseBase
+        {
+            T m_Value;
 
-            std::suspend_always final_suspend() noexcept { return {}; }
+            Task get_return_object() { return Task{handle_type::from_promise(*this)}; }
 
             void return_value(T&& val) { m_Value = std::move(val); }
             void return_value(const T& val) { m_Value = val; }
-
-            void unhandled_exception() { m_Exception = std::current_exception(); }
         };
 
-        bool await_ready() const noexcept { return m_Handle.done(); }
+        bool await_ready() { return m_Started && m_Handle.promise().IsFinished(); }
 
-        void await_suspend(std::coroutine_handle<> awaitingCoroutine) noexcept
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaitingCoroutine)
         {
-            m_Handle.promise().m_AwaitingCoroutine = awaitingCoroutine;
-            m_Handle.resume();
+            return m_Handle.promise().Await(m_Handle, awaitingCoroutine, std::exchange(m_Started, true));
         }
 
         T await_resume()
@@ -92,28 +206,22 @@ namespace BeeEngine
 
     private:
         handle_type m_Handle;
+        bool m_Started = false;
     };
 
     template <>
     struct Task<void>
     {
-        struct promise_type
+        struct promise_type : Internal::TaskPromiseBase
         {
-            std::exception_ptr m_Exception;
-            std::coroutine_handle<> m_AwaitingCoroutine;
             void return_void() {}
 
             Task get_return_object() { return {handle_type::from_promise(*this)}; }
-
-            std::suspend_always initial_suspend() { return {}; }
-
-            std::suspend_always final_suspend() noexcept { return {}; }
-
-            void unhandled_exception() {}
         };
 
         using handle_type = std::coroutine_handle<promise_type>;
         handle_type handle;
+        bool started = false;
 
         Task(handle_type h) : handle(h) {}
 
@@ -125,31 +233,52 @@ namespace BeeEngine
 
         Task(const Task&) = delete;
 
-        Task(Task&& other) : handle(other.handle) { other.handle = nullptr; }
+        Task(Task&& other) noexcept : handle(other.handle), started(other.started) { other.handle = nullptr; }
 
         Task& operator=(const Task&) = delete;
 
-        Task& operator=(Task&& other)
+        Task& operator=(Task&& other) noexcept
         {
             if (this != &other)
             {
+                if (handle)
+                    handle.destroy();
                 handle = other.handle;
+                started = other.started;
                 other.handle = nullptr;
             }
             return *this;
         }
 
-        void get()
+        void Start()
         {
-            if (!handle.done())
+            if (!started)
+            {
+                started = true;
                 handle.resume();
+            }
+        }
+
+        [[nodiscard]] bool IsReady() const { return started && handle.promise().IsFinished(); }
+
+        // Same as Task<T>::Wait, needs the running job system
+        void Wait()
+        {
+            Start();
+            Jobs::WaitForJobsToComplete(handle.promise().m_Completion);
+        }
+
+        // Waits for the task and rethrows its exception
+        void get()
+        {
+            Wait();
+            await_resume();
         }
-        bool await_ready() const noexcept { return handle.done(); }
+        bool await_ready() { return started && handle.promise().IsFinished(); }
 
-        void await_suspend(std::coroutine_handle<> awaitingCoroutine) noexcept
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaitingCoroutine)
         {
-            handle.promise().m_AwaitingCoroutine = awaitingCoroutine;
-            handle.resume();
+            return handle.promise().Await(handle, awaitingCoroutine, std::exchange(started, true));
         }
 
         void await_resume()
@@ -218,4 +347,4 @@ namespace BeeEngine
             return task.get();
         }
     }
-} // namespace BeeEngine
\ No newline at end of file
+} // namespace BeeEngine
@@ -13,6 +13,7 @@ namespace BeeEngine
     {
     public:
         FramePtr() = default;
+        // Takes ownership of a heap allocated object. CreateFrameScope, that uses the frame arena, is preferred
         FramePtr(T* ptr)
         {
             m_Ptr = ptr;
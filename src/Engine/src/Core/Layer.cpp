@@ -3,6 +3,7 @@
 //
 #include "Layer.h"
 
+#include "Platform/ImGui/ImGuiControllerNull.h"
 #include "Platform/ImGui/ImGuiControllerVulkan.h"
 #include "Platform/ImGui/ImGuiControllerWebGPU.h"
 #include "Renderer/Renderer.h"
@@ -32,6 +33,9 @@ namespace BeeEngine
                 s_Controller = std::make_unique<Internal::ImGuiControllerVulkan>();
                 break;
 #endif
+            case Null:
+                s_Controller = std::make_unique<Internal::ImGuiControllerNull>();
+                break;
             default:
                 BeeCoreAssert(false, "Renderer API not supported!");
                 break;
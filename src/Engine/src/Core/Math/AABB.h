@@ -0,0 +1,70 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#pragma once
+#include <glm/glm.hpp>
+#include <limits>
+#include <span>
+
+namespace BeeEngine::Math
+{
+    /**
+     * @brief Axis aligned bounding box.
+     * Default constructed box is empty and contains nothing
+     */
+    struct AABB
+    {
+        glm::vec3 Min{std::numeric_limits<float>::max()};
+        glm::vec3 Max{std::numeric_limits<float>::lowest()};
+
+        [[nodiscard]] bool IsEmpty() const { return Min.x > Max.x || Min.y > Max.y || Min.z > Max.z; }
+        [[nodiscard]] glm::vec3 GetCenter() const { return (Min + Max) * 0.5f; }
+        [[nodiscard]] glm::vec3 GetExtents() const { return (Max - Min) * 0.5f; }
+
+        void Expand(const glm::vec3& point)
+        {
+            Min = glm::min(Min, point);
+            Max = glm::max(Max, point);
+        }
+        void Expand(const AABB& other)
+        {
+            Min = glm::min(Min, other.Min);
+            Max = glm::max(Max, other.Max);
+        }
+
+        /**
+         * @brief Returns the smallest axis aligned box, that contains this box after the transformation.
+         * Empty box stays empty
+         */
+        [[nodiscard]] AABB Transformed(const glm::mat4& transform) const
+        {
+            if (IsEmpty())
+            {
+                return *this;
+            }
+            const glm::vec3 center = transform * glm::vec4(GetCenter(), 1.0f);
+            const glm::vec3 extents = GetExtents();
+            // Extents of the rotated and scaled box along each world axis
+            const glm::vec3 worldExtents{
+                glm::abs(transform[0][0]) * extents.x + glm::abs(transform[1][0]) * extents.y +
+                    glm::abs(transform[2][0]) * extents.z,
+                glm::abs(transform[0][1]) * extents.x + glm::abs(transform[1][1]) * extents.y +
+                    glm::abs(transform[2][1]) * extents.z,
+                glm::abs(transform[0][2]) * extents.x + glm::abs(transform[1][2]) * extents.y +
+                    glm::abs(transform[2][2]) * extents.z};
+            return {center - worldExtents, center + worldExtents};
+        }
+
+        template <typename Vertex>
+        [[nodiscard]] static AABB FromVertices(std::span<const Vertex> vertices, glm::vec3 Vertex::* position)
+        {
+            AABB result;
+            for (const auto& vertex : vertices)
+            {
+                result.Expand(vertex.*position);
+            }
+            return result;
+        }
+    };
+} // namespace BeeEngine::Math
@@ -4,6 +4,8 @@
 
 #pragma once
 #include <concepts>
+#include <cstddef>
+#include <cstdint>
 
 namespace BeeEngine
 {
@@ -5,6 +5,11 @@
 #pragma once
 #include "AllocatorPrimitives.h"
 #include "Core/Logging/Log.h"
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+#include <new>
+#include <vector>
 #undef max
 namespace BeeEngine
 {
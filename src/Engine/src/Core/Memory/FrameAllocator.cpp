@@ -0,0 +1,206 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#include "FrameAllocator.h"
+#include "Core/CodeSafety/Expects.h"
+#include <algorithm>
+#include <array>
+#include <mutex>
+
+namespace BeeEngine
+{
+    LinearArena::LinearArena(size_t pageSize) : m_PageSize(pageSize)
+    {
+        BeeExpects(pageSize > 0);
+    }
+
+    std::byte* LinearArena::Page::TryAllocate(size_t size, size_t alignment)
+    {
+        const auto base = reinterpret_cast<uintptr_t>(Memory.get());
+        size_t offset = Offset.load(std::memory_order_relaxed);
+        while (true)
+        {
+            const size_t aligned = AlignMemoryAddress(base + offset, alignment) - base;
+            if (aligned + size > Size)
+            {
+                return nullptr;
+            }
+            // Memory is handed to one thread only and nothing is published through the offset
+            if (Offset.compare_exchange_weak(offset, aligned + size, std::memory_order_relaxed))
+            {
+                return Memory.get() + aligned;
+            }
+        }
+    }
+
+    MemoryBlock LinearArena::Allocate(size_t size, size_t alignment)
+    {
+        BeeExpects(alignment > 0 && (alignment & (alignment - 1)) == 0);
+        Page* page = m_CurrentPage.load(std::memory_order_acquire);
+        if (page)
+        {
+            if (std::byte* ptr = page->TryAllocate(size, alignment))
+            {
+                return {ptr, size};
+            }
+        }
+        return AllocateFromNextPage(page, size, alignment);
+    }
+
+    MemoryBlock LinearArena::AllocateFromNextPage(Page* full, size_t size, size_t alignment)
+    {
+        std::unique_lock lock(m_Lock);
+        Page* current = m_CurrentPage.load(std::memory_order_relaxed);
+        // Other thread could have switched the page, while this one was waiting for the lock
+        if (current && current != full)
+        {
+            if (std::byte* ptr = current->TryAllocate(size, alignment))
+            {
+                return {ptr, size};
+            }
+        }
+        if (current)
+        {
+            ++m_CurrentPageIndex;
+        }
+        // Memory of a page is aligned only to the default alignment
+        const size_t required = size + std::max(alignment, DefaultAlignment) - DefaultAlignment;
+        if (m_CurrentPageIndex == m_Pages.size() || m_Pages[m_CurrentPageIndex]->Size < required)
+        {
+            m_Pages.emplace(m_Pages.begin() + static_cast<ptrdiff_t>(m_CurrentPageIndex),
+                            std::make_unique<Page>(std::max(m_PageSize, required)));
+        }
+        Page* next = m_Pages[m_CurrentPageIndex].get();
+        // Nobody else allocates from the page before it is published
+        std::byte* ptr = next->TryAllocate(size, alignment);
+        BeeEnsures(ptr != nullptr);
+        m_CurrentPage.store(next, std::memory_order_release);
+        return {ptr, size};
+    }
+
+    void LinearArena::Deallocate(MemoryBlock block)
+    {
+        Page* page = m_CurrentPage.load(std::memory_order_acquire);
+        if (!page || !block.Ptr)
+        {
+            return;
+        }
+        const auto base = reinterpret_cast<uintptr_t>(page->Memory.get());
+        const auto begin = reinterpret_cast<uintptr_t>(block.Ptr);
+        if (begin < base || begin + block.Size > base + page->Size)
+        {
+            return;
+        }
+        size_t end = begin + block.Size - base;
+        page->Offset.compare_exchange_strong(end, begin - base, std::memory_order_relaxed);
+    }
+
+    bool LinearArena::Owns(const void* ptr) const
+    {
+        std::unique_lock lock(m_Lock);
+        const auto address = reinterpret_cast<uintptr_t>(ptr);
+        return std::ranges::any_of(m_Pages,
+                                   [address](const auto& page)
+                                   {
+                                       const auto base = reinterpret_cast<uintptr_t>(page->Memory.get());
+                                       return address >= base && address < base + page->Size;
+                                   });
+    }
+
+    void LinearArena::Reset()
+    {
+        std::unique_lock lock(m_Lock);
+        m_HighWaterMark = std::max(m_HighWaterMark, GetUsedSizeLocked());
+        for (size_t i = 0; i < m_Pages.size() && i <= m_CurrentPageIndex; ++i)
+        {
+            m_Pages[i]->Offset.store(0, std::memory_order_relaxed);
+        }
+        m_CurrentPageIndex = 0;
+        m_CurrentPage.store(m_Pages.empty() ? nullptr : m_Pages.front().get(), std::memory_order_release);
+    }
+
+    size_t LinearArena::GetUsedSize() const
+    {
+        std::unique_lock lock(m_Lock);
+        return GetUsedSizeLocked();
+    }
+
+    size_t LinearArena::GetUsedSizeLocked() const
+    {
+        size_t used = 0;
+        for (size_t i = 0; i < m_Pages.size() && i <= m_CurrentPageIndex; ++i)
+        {
+            used += m_Pages[i]->Offset.load(std::memory_order_relaxed);
+        }
+        return used;
+    }
+
+    size_t LinearArena::GetHighWaterMark() const
+    {
+        std::unique_lock lock(m_Lock);
+        return std::max(m_HighWaterMark, GetUsedSizeLocked());
+    }
+
+    size_t LinearArena::GetReservedSize() const
+    {
+        std::unique_lock lock(m_Lock);
+        size_t reserved = 0;
+        for (const auto& page : m_Pages)
+        {
+            reserved += page->Size;
+        }
+        return reserved;
+    }
+
+    namespace
+    {
+        struct FrameArenas
+        {
+            std::array<LinearArena, FrameAllocator::FramesInFlight> Arenas;
+            std::atomic<size_t> Current = 0;
+            size_t LastFrameUsed = 0;
+        };
+
+        FrameArenas& GetFrameArenas()
+        {
+            static FrameArenas arenas;
+            return arenas;
+        }
+    } // namespace
+
+    bool FrameAllocator::Owns(MemoryBlock block)
+    {
+        return std::ranges::any_of(GetFrameArenas().Arenas,
+                                   [&block](const LinearArena& arena) { return arena.Owns(block.Ptr); });
+    }
+
+    LinearArena& FrameAllocator::GetCurrentArena()
+    {
+        auto& arenas = GetFrameArenas();
+        return arenas.Arenas[arenas.Current.load(std::memory_order_acquire)];
+    }
+
+    void FrameAllocator::NextFrame()
+    {
+        auto& arenas = GetFrameArenas();
+        const size_t current = arenas.Current.load(std::memory_order_relaxed);
+        arenas.LastFrameUsed = arenas.Arenas[current].GetUsedSize();
+        // The next arena was used FramesInFlight - 1 frames ago, so nothing can reference its memory anymore
+        const size_t next = (current + 1) % FramesInFlight;
+        arenas.Arenas[next].Reset();
+        arenas.Current.store(next, std::memory_order_release);
+    }
+
+    FrameAllocatorStatistics FrameAllocator::GetStatistics()
+    {
+        auto& arenas = GetFrameArenas();
+        FrameAllocatorStatistics statistics{.LastFrameUsed = arenas.LastFrameUsed};
+        for (const auto& arena : arenas.Arenas)
+        {
+            statistics.HighWaterMark = std::max(statistics.HighWaterMark, arena.GetHighWaterMark());
+            statistics.Reserved += arena.GetReservedSize();
+        }
+        return statistics;
+    }
+} // namespace BeeEngine
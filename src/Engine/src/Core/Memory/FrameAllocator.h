@@ -0,0 +1,123 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#pragma once
+#include "AllocatorPrimitives.h"
+#include "Allocators.h"
+#include "JobSystem/SpinLock.h"
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace BeeEngine
+{
+    /**
+     * @brief Thread safe linear allocator. Memory is allocated from pages, that are never moved,
+     * and is freed all at once by Reset. Pages are kept after Reset and reused,
+     * so in a steady state nothing is allocated from the system
+     */
+    class LinearArena
+    {
+    public:
+        static constexpr size_t DefaultPageSize = 1024 * 1024;
+        static constexpr size_t DefaultAlignment = alignof(std::max_align_t);
+
+        explicit LinearArena(size_t pageSize = DefaultPageSize);
+        LinearArena(const LinearArena&) = delete;
+        LinearArena& operator=(const LinearArena&) = delete;
+
+        /**
+         * @brief Lock free unless the current page is full.
+         * Requests bigger than a page get a page of their own
+         */
+        [[nodiscard]] MemoryBlock Allocate(size_t size, size_t alignment = DefaultAlignment);
+        /**
+         * @brief Gives the memory back only if it is the last allocation of the current page,
+         * so a growing vector does not leave its old storage behind. Otherwise does nothing
+         */
+        void Deallocate(MemoryBlock block);
+        [[nodiscard]] bool Owns(const void* ptr) const;
+        /**
+         * @brief Frees all allocations. Must not be called concurrently with Allocate
+         */
+        void Reset();
+
+        // Bytes allocated since the last Reset including alignment padding
+        [[nodiscard]] size_t GetUsedSize() const;
+        // Biggest used size between two resets
+        [[nodiscard]] size_t GetHighWaterMark() const;
+        [[nodiscard]] size_t GetReservedSize() const;
+
+    private:
+        struct Page
+        {
+            std::unique_ptr<std::byte[]> Memory;
+            size_t Size;
+            std::atomic<size_t> Offset = 0;
+
+            Page(size_t size) : Memory(std::make_unique_for_overwrite<std::byte[]>(size)), Size(size) {}
+            std::byte* TryAllocate(size_t size, size_t alignment);
+        };
+
+        MemoryBlock AllocateFromNextPage(Page* full, size_t size, size_t alignment);
+        size_t GetUsedSizeLocked() const;
+
+        std::vector<std::unique_ptr<Page>> m_Pages;
+        std::atomic<Page*> m_CurrentPage = nullptr;
+        size_t m_CurrentPageIndex = 0;
+        size_t m_HighWaterMark = 0;
+        size_t m_PageSize;
+        mutable Jobs::SpinLock m_Lock;
+    };
+
+    struct FrameAllocatorStatistics
+    {
+        // Used bytes of the last finished frame
+        size_t LastFrameUsed = 0;
+        // Most bytes used by one frame so far
+        size_t HighWaterMark = 0;
+        // Memory of all pages of all frame arenas
+        size_t Reserved = 0;
+    };
+
+    /**
+     * @brief Allocator for memory, that is needed only during the current frame.
+     * There is one arena per frame in flight. An arena is reset, when it becomes current again in NextFrame,
+     * so memory of the previous frame also stays valid. This is needed, because functions, that are
+     * pushed to DeletionQueue::Frame() while it is flushed, run only at the end of the next frame.
+     * Stateless, so it can be used with StdAllocator. Deallocation is not needed
+     */
+    class FrameAllocator
+    {
+    public:
+        static constexpr size_t FramesInFlight = 2;
+
+        MemoryBlock Allocate(size_t size) { return GetCurrentArena().Allocate(size); }
+        MemoryBlock AllocateAligned(size_t size, size_t alignment) { return GetCurrentArena().Allocate(size, alignment); }
+        void Deallocate(MemoryBlock block) { GetCurrentArena().Deallocate(block); }
+        void DeallocateAligned(MemoryBlock block, size_t alignment) { GetCurrentArena().Deallocate(block); }
+        bool Owns(MemoryBlock block);
+        // Memory is freed by NextFrame
+        void DeallocateAll() {}
+
+        static LinearArena& GetCurrentArena();
+        /**
+         * @brief Switches to the next arena and resets it. Called once at the end of every frame
+         * after DeletionQueue::Frame() is flushed, when no jobs of the frame are running
+         */
+        static void NextFrame();
+        [[nodiscard]] static FrameAllocatorStatistics GetStatistics();
+    };
+    static_assert(MemoryAllocator<FrameAllocator>);
+
+    template <typename T>
+    using FrameStdAllocator = StdAllocator<T, FrameAllocator>;
+
+    /**
+     * @brief Vector, that allocates from the frame arena. Must not outlive the next frame
+     */
+    template <typename T>
+    using FrameVector = std::vector<T, FrameStdAllocator<T>>;
+} // namespace BeeEngine
@@ -1,5 +1,6 @@
 #pragma once
 #include "Core/CodeSafety/Expects.h"
+#include "Core/Memory/FrameAllocator.h"
 #include "FramePtr.h"
 #include "SharedPointer.h"
 #include "ToString.h"
@@ -24,11 +25,20 @@ namespace BeeEngine
     template <typename T>
     using FrameScope = FramePtr<T>;
 
+    /**
+     * @brief Creates the object in the frame arena. Only its destructor is deferred to the end of the frame,
+     * the memory is freed together with the whole arena
+     */
     template <typename T, typename... Args>
-    constexpr FrameScope<T> CreateFrameScope(Args&&... args)
+    FrameScope<T> CreateFrameScope(Args&&... args)
     {
-        T* ptr = new T(std::forward<Args>(args)...);
-        return FramePtr<T>(ptr);
+        MemoryBlock block = FrameAllocator().AllocateAligned(sizeof(T), alignof(T));
+        T* ptr = new (block.Ptr) T(std::forward<Args>(args)...);
+        if constexpr (!std::is_trivially_destructible_v<T>)
+        {
+            DeletionQueue::Frame().PushFunction([ptr]() { ptr->~T(); });
+        }
+        return FramePtr<T>(ptr, true);
     }
 
     template <typename T, typename... Args>
@@ -5,6 +5,9 @@
 #include "DebugLayer.h"
 #include "Allocator/AllocatorStatistics.h"
 #include "Instrumentor.h"
+#include "JobSystem/JobScheduler.h"
+#include <chrono>
+#include <cstdio>
 #include <imgui.h>
 
 namespace BeeEngine
@@ -17,10 +20,43 @@ namespace BeeEngine
 
         void DebugLayer::OnDetach() {}
 
+        static void WriteJobStatisticsToProfiler(const Jobs::JobSystemFrameStatistics& jobs)
+        {
+            auto timestamp = std::chrono::time_point_cast<std::chrono::microseconds>(
+                                 std::chrono::high_resolution_clock::now())
+                                 .time_since_epoch()
+                                 .count();
+            auto& instrumentor = Instrumentor::Get();
+            instrumentor.WriteCounter("Job utilization",
+                                      timestamp,
+                                      {{"average", jobs.AverageUtilization * 100.0},
+                                       {"helpers", jobs.Helpers.Utilization * 100.0}});
+            instrumentor.WriteCounter(
+                "Job queues",
+                timestamp,
+                {{"high", static_cast<double>(jobs.QueueDepths[static_cast<size_t>(Jobs::Priority::High)])},
+                 {"normal", static_cast<double>(jobs.QueueDepths[static_cast<size_t>(Jobs::Priority::Normal)])},
+                 {"low", static_cast<double>(jobs.QueueDepths[static_cast<size_t>(Jobs::Priority::Low)])},
+                 {"waiting", static_cast<double>(jobs.WaitingJobs)}});
+            uint64_t steals = jobs.Helpers.Steals, resumes = jobs.Helpers.Resumes;
+            for (auto& worker : jobs.Workers)
+            {
+                steals += worker.Steals;
+                resumes += worker.Resumes;
+            }
+            instrumentor.WriteCounter("Jobs",
+                                      timestamp,
+                                      {{"completed", static_cast<double>(jobs.JobsCompleted)},
+                                       {"resumes", static_cast<double>(resumes)},
+                                       {"steals", static_cast<double>(steals)}});
+        }
+
         void DebugLayer::OnUpdate(FrameData& frameData)
         {
+            m_RendererStatisticsGUI.Update();
             if (Instrumentor::Get().IsSessionActive())
             {
+                WriteJobStatisticsToProfiler(m_RendererStatisticsGUI.GetJobStatistics().GetLastFrame());
                 frameCounter++;
                 if (frameCounter >= numberOfFramesToCapture)
                 {
@@ -71,9 +107,75 @@ namespace BeeEngine
             // ImGui::Text("Memory pages: %llu", stats.totalMemoryPages.load());
             ImGui::End();
 
+            RenderJobSystemStatistics();
             m_RendererStatisticsGUI.Render();
         }
 
+        void DebugLayer::RenderJobSystemStatistics()
+        {
+            auto& sampler = m_RendererStatisticsGUI.GetJobStatistics();
+            auto& jobs = sampler.GetLastFrame();
+            ImGui::Begin("Job System");
+            ImGui::Text("Frame time: %.3f ms", jobs.FrameTime * 1000.0);
+            ImGui::Text("Average utilization: %.1f%%", jobs.AverageUtilization * 100.0);
+            ImGui::PlotLines("##utilization",
+                             sampler.GetUtilizationHistory().data(),
+                             static_cast<int>(sampler.GetUtilizationHistory().size()),
+                             static_cast<int>(sampler.GetHistoryOffset()),
+                             nullptr,
+                             0.0f,
+                             1.0f,
+                             ImVec2(0, 60));
+            ImGui::Text("Queued jobs: high %llu, normal %llu, low %llu",
+                        static_cast<unsigned long long>(jobs.QueueDepths[static_cast<size_t>(Jobs::Priority::High)]),
+                        static_cast<unsigned long long>(jobs.QueueDepths[static_cast<size_t>(Jobs::Priority::Normal)]),
+                        static_cast<unsigned long long>(jobs.QueueDepths[static_cast<size_t>(Jobs::Priority::Low)]));
+            ImGui::Text("Waiting jobs: %llu, sleeping jobs: %llu, sleeping workers: %u",
+                        static_cast<unsigned long long>(jobs.WaitingJobs),
+                        static_cast<unsigned long long>(jobs.SleepingJobs),
+                        jobs.SleepingWorkers);
+            if (ImGui::BeginTable("Workers", 7, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+            {
+                ImGui::TableSetupColumn("Worker");
+                ImGui::TableSetupColumn("Busy");
+                ImGui::TableSetupColumn("Idle");
+                ImGui::TableSetupColumn("Jobs");
+                ImGui::TableSetupColumn("Resumes");
+                ImGui::TableSetupColumn("Yields/Waits");
+                ImGui::TableSetupColumn("Steals");
+                ImGui::TableHeadersRow();
+                auto row = [](const char* name, const Jobs::JobSystemFrameStatistics::Worker& worker)
+                {
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn();
+                    ImGui::TextUnformatted(name);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.1f%%", worker.Utilization * 100.0);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.1f%%", worker.Idle * 100.0);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%llu", static_cast<unsigned long long>(worker.JobsCompleted));
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%llu", static_cast<unsigned long long>(worker.Resumes));
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%llu/%llu",
+                                static_cast<unsigned long long>(worker.Yields),
+                                static_cast<unsigned long long>(worker.Waits));
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%llu", static_cast<unsigned long long>(worker.Steals));
+                };
+                for (size_t i = 0; i < jobs.Workers.size(); ++i)
+                {
+                    char name[16];
+                    std::snprintf(name, sizeof(name), "%zu", i);
+                    row(name, jobs.Workers[i]);
+                }
+                row("Helpers", jobs.Helpers);
+                ImGui::EndTable();
+            }
+            ImGui::End();
+        }
+
         void DebugLayer::OnEvent(EventDispatcher& e) {}
     } // namespace Debug
 } // namespace BeeEngine
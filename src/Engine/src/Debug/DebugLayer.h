@@ -23,6 +23,8 @@ namespace BeeEngine
             void OnEvent(EventDispatcher& e) override;
 
         private:
+            void RenderJobSystemStatistics();
+
             Internal::RendererStatisticsGUI m_RendererStatisticsGUI;
         };
     } // namespace Debug
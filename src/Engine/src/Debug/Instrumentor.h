@@ -46,7 +46,9 @@
 #include <chrono>
 #include <fstream>
 #include <gsl/gsl>
+#include <initializer_list>
 #include <string>
+#include <utility>
 
 #include <thread>
 
@@ -117,6 +119,34 @@ namespace BeeEngine
                 m_OutputStream.flush();
             }
 
+            // Writes a counter event, that is shown as a graph in chrome://tracing
+            void WriteCounter(const std::string& name,
+                              long long timestamp,
+                              std::initializer_list<std::pair<const char*, double>> values)
+            {
+                if (m_ProfileCount++ > 0)
+                    m_OutputStream << ",";
+
+                m_OutputStream << "{";
+                m_OutputStream << "\"cat\":\"counter\",";
+                m_OutputStream << "\"name\":\"" << name << "\",";
+                m_OutputStream << "\"ph\":\"C\",";
+                m_OutputStream << "\"pid\":0,";
+                m_OutputStream << "\"ts\":" << timestamp << ",";
+                m_OutputStream << "\"args\":{";
+                bool first = true;
+                for (auto& [key, value] : values)
+                {
+                    if (!first)
+                        m_OutputStream << ",";
+                    first = false;
+                    m_OutputStream << "\"" << key << "\":" << value;
+                }
+                m_OutputStream << "}}";
+
+                m_OutputStream.flush();
+            }
+
             void WriteHeader()
             {
                 m_OutputStream << "{\"otherData\": {},\"traceEvents\":[";
@@ -3,6 +3,8 @@
 //
 
 #include "RendererStatisticsGUI.h"
+#include "Core/Memory/FrameAllocator.h"
+#include "JobSystem/JobScheduler.h"
 
 namespace BeeEngine::Internal
 {
@@ -10,6 +12,10 @@ namespace BeeEngine::Internal
     {
         return (double)bytes / 1024.0 / 1024.0;
     }
+    void RendererStatisticsGUI::Update()
+    {
+        m_JobStatistics.Sample();
+    }
     void RendererStatisticsGUI::Render()
     {
         auto& stats = Renderer::GetStatistics();
@@ -18,11 +24,44 @@ namespace BeeEngine::Internal
         ImGui::Text("Total Instance count: %zu", stats.TotalInstanceCount);
         ImGui::Text("Opaque Instances: %zu", stats.OpaqueInstanceCount);
         ImGui::Text("Transparent Instances: %zu", stats.TransparentInstanceCount);
+        ImGui::Text("Visible Instances: %zu", stats.VisibleInstanceCount);
+        ImGui::Text("Culled Instances: %zu", stats.CulledInstanceCount);
+        ImGui::Text("Static Instances: %zu", stats.StaticInstanceCount);
+        ImGui::Text("GPU-driven Instances: %zu", stats.GPUDrivenInstanceCount);
+        ImGui::Text("Compute dispatches: %zu", stats.ComputeDispatchCount);
+        // GPU-driven meshes are culled after their level of detail is counted
+        ImGui::TextUnformatted(Renderer::SupportsIndirectDrawing() ? "Levels of detail (before GPU culling):"
+                                                                   : "Levels of detail:");
+        for (size_t lod = 0; lod < RendererStatistics::MaxLodLevels; ++lod)
+        {
+            ImGui::Text("LOD %zu: %zu instances, %zu triangles",
+                        lod,
+                        stats.LodInstanceCounts[lod],
+                        stats.LodTriangleCounts[lod]);
+        }
         ImGui::Text("Vertex count: %zu", stats.VertexCount);
         ImGui::Text("Index count: %zu", stats.IndexCount);
+        ImGui::Text("Pipeline changes: %zu", stats.PipelineChangeCount);
+        ImGui::Text("Binding set changes: %zu", stats.BindingSetChangeCount);
+        ImGui::Text("Estimated overdraw: %.2fx", stats.EstimatedOverdraw);
+        ImGui::Text("Uploaded: %.3f MB", ConvertFromBytesToMegabytes(stats.UploadedBytes));
         ImGui::Text("Allocated GPU memory: %.3f MB", ConvertFromBytesToMegabytes(stats.AllocatedGPUMemory));
         ImGui::Text("Allocated CPU memory: %.3f MB", ConvertFromBytesToMegabytes(stats.AllocatedCPUMemory));
         ImGui::Text("Allocated GPU buffers: %zu", stats.AllocatedGPUBuffers);
+        auto frameMemory = FrameAllocator::GetStatistics();
+        ImGui::Separator();
+        ImGui::Text("Frame arena used: %.3f MB", ConvertFromBytesToMegabytes(frameMemory.LastFrameUsed));
+        ImGui::Text("Frame arena high water mark: %.3f MB", ConvertFromBytesToMegabytes(frameMemory.HighWaterMark));
+        ImGui::Text("Frame arena reserved: %.3f MB", ConvertFromBytesToMegabytes(frameMemory.Reserved));
+        auto& jobs = m_JobStatistics.GetLastFrame();
+        ImGui::Separator();
+        ImGui::Text("Jobs per frame: %llu", static_cast<unsigned long long>(jobs.JobsCompleted));
+        ImGui::Text("Worker utilization: %.1f%%", jobs.AverageUtilization * 100.0);
+        ImGui::Text("Queued jobs (high/normal/low): %llu/%llu/%llu",
+                    static_cast<unsigned long long>(jobs.QueueDepths[static_cast<size_t>(Jobs::Priority::High)]),
+                    static_cast<unsigned long long>(jobs.QueueDepths[static_cast<size_t>(Jobs::Priority::Normal)]),
+                    static_cast<unsigned long long>(jobs.QueueDepths[static_cast<size_t>(Jobs::Priority::Low)]));
+        ImGui::Text("Waiting jobs: %llu", static_cast<unsigned long long>(jobs.WaitingJobs));
         ImGui::End();
     }
 } // namespace BeeEngine::Internal
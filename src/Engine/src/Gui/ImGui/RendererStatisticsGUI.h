@@ -5,15 +5,22 @@
 #pragma once
 
 #include "IImGuiElement.h"
+#include "JobSystem/JobStatistics.h"
 
 namespace BeeEngine::Internal
 {
     class RendererStatisticsGUI final : public IImGuiElement
     {
     public:
-        void Update() override {};
+        // Samples per frame statistics. Must be called once per frame
+        void Update() override;
         void Render() override;
         void OnEvent(EventDispatcher& event) override {};
         ~RendererStatisticsGUI() override = default;
+
+        const Jobs::JobStatisticsSampler& GetJobStatistics() const { return m_JobStatistics; }
+
+    private:
+        Jobs::JobStatisticsSampler m_JobStatistics;
     };
 } // namespace BeeEngine::Internal
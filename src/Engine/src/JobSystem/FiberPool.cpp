@@ -0,0 +1,154 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#include "FiberPool.h"
+#include "InternalJobScheduler.h"
+
+#include <boost/context/fixedsize_stack.hpp>
+#include <boost/context/protected_fixedsize_stack.hpp>
+#include <mutex>
+#include <new>
+
+#include <Core/Move.h>
+
+namespace BeeEngine::Internal
+{
+#if !defined(DEBUG)
+    using OSStackAllocator = boost::context::protected_fixedsize_stack;
+#else
+    using OSStackAllocator = boost::context::fixedsize_stack;
+#endif
+
+    FiberPool::FiberPool() : FiberPool(Config{}) {}
+
+    FiberPool::FiberPool(const Config& config) : m_Config(config) {}
+
+    FiberPool::~FiberPool()
+    {
+        for (auto& bucket : m_Buckets)
+        {
+            for (auto& stack : bucket.FreeStacks)
+            {
+                FreeStack(bucket.StackSize, stack);
+            }
+        }
+        for (void* storage : m_FreeFibers)
+        {
+            ::operator delete(storage, std::align_val_t{alignof(Fiber)});
+        }
+    }
+
+    Fiber* FiberPool::AcquireFiber(JobWrapper&& job)
+    {
+        void* storage = nullptr;
+        {
+            std::unique_lock lock(m_FiberLock);
+            if (!m_FreeFibers.empty())
+            {
+                storage = m_FreeFibers.back();
+                m_FreeFibers.pop_back();
+            }
+        }
+        if (storage)
+        {
+            m_FiberReuses.fetch_add(1, std::memory_order_relaxed);
+        }
+        else
+        {
+            storage = ::operator new(sizeof(Fiber), std::align_val_t{alignof(Fiber)});
+            m_FiberAllocations.fetch_add(1, std::memory_order_relaxed);
+        }
+        return new (storage) Fiber(BeeMove(job), *this);
+    }
+
+    void FiberPool::ReleaseFiber(Fiber* fiber)
+    {
+        fiber->~Fiber();
+        {
+            std::unique_lock lock(m_FiberLock);
+            if (m_FreeFibers.size() < m_Config.MaxCachedFibers)
+            {
+                m_FreeFibers.push_back(fiber);
+                return;
+            }
+        }
+        ::operator delete(static_cast<void*>(fiber), std::align_val_t{alignof(Fiber)});
+    }
+
+    FiberPool::Bucket& FiberPool::GetBucket(size_t size)
+    {
+        // There are only a few different stack sizes in practice, so linear search is the fastest
+        for (auto& bucket : m_Buckets)
+        {
+            if (bucket.StackSize == size)
+            {
+                return bucket;
+            }
+        }
+        return m_Buckets.emplace_back(Bucket{size, {}});
+    }
+
+    boost::context::stack_context FiberPool::AllocateStack(size_t size)
+    {
+        {
+            std::unique_lock lock(m_StackLock);
+            auto& bucket = GetBucket(size);
+            if (!bucket.FreeStacks.empty())
+            {
+                auto stack = bucket.FreeStacks.back();
+                bucket.FreeStacks.pop_back();
+                m_CachedStackMemory -= stack.size;
+                m_StackReuses.fetch_add(1, std::memory_order_relaxed);
+                return stack;
+            }
+        }
+        m_StackAllocations.fetch_add(1, std::memory_order_relaxed);
+        return OSStackAllocator(size).allocate();
+    }
+
+    void FiberPool::DeallocateStack(size_t size, boost::context::stack_context& stack)
+    {
+        {
+            std::unique_lock lock(m_StackLock);
+            auto& bucket = GetBucket(size);
+            if (bucket.FreeStacks.size() < m_Config.MaxCachedStacksPerSize &&
+                m_CachedStackMemory + stack.size <= m_Config.MaxCachedStackMemory)
+            {
+                bucket.FreeStacks.push_back(stack);
+                m_CachedStackMemory += stack.size;
+                return;
+            }
+        }
+        m_StacksFreed.fetch_add(1, std::memory_order_relaxed);
+        FreeStack(size, stack);
+    }
+
+    void FiberPool::FreeStack(size_t size, boost::context::stack_context& stack)
+    {
+        OSStackAllocator(size).deallocate(stack);
+    }
+
+    Jobs::FiberPoolStatistics FiberPool::GetStatistics() const
+    {
+        Jobs::FiberPoolStatistics statistics;
+        statistics.StackAllocations = m_StackAllocations.load(std::memory_order_relaxed);
+        statistics.StackReuses = m_StackReuses.load(std::memory_order_relaxed);
+        statistics.StacksFreed = m_StacksFreed.load(std::memory_order_relaxed);
+        statistics.FiberAllocations = m_FiberAllocations.load(std::memory_order_relaxed);
+        statistics.FiberReuses = m_FiberReuses.load(std::memory_order_relaxed);
+        {
+            std::unique_lock lock(m_StackLock);
+            for (auto& bucket : m_Buckets)
+            {
+                statistics.CachedStacks += bucket.FreeStacks.size();
+            }
+            statistics.CachedStackMemory = m_CachedStackMemory;
+        }
+        {
+            std::unique_lock lock(m_FiberLock);
+            statistics.CachedFibers = m_FreeFibers.size();
+        }
+        return statistics;
+    }
+} // namespace BeeEngine::Internal
@@ -0,0 +1,115 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#pragma once
+#include "JobSystem/SpinLock.h"
+#include <atomic>
+#include <boost/context/stack_context.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace BeeEngine::Jobs
+{
+    struct FiberPoolStatistics
+    {
+        // Stacks, that had to be allocated from the OS
+        uint64_t StackAllocations = 0;
+        // Stacks, that were taken from the pool
+        uint64_t StackReuses = 0;
+        // Stacks, that were returned to the OS, because the pool was full
+        uint64_t StacksFreed = 0;
+        uint64_t CachedStacks = 0;
+        uint64_t CachedStackMemory = 0; // in bytes
+        uint64_t FiberAllocations = 0;
+        uint64_t FiberReuses = 0;
+        uint64_t CachedFibers = 0;
+
+        double StackHitRate() const
+        {
+            const uint64_t total = StackAllocations + StackReuses;
+            return total == 0 ? 0.0 : static_cast<double>(StackReuses) / static_cast<double>(total);
+        }
+        double FiberHitRate() const
+        {
+            const uint64_t total = FiberAllocations + FiberReuses;
+            return total == 0 ? 0.0 : static_cast<double>(FiberReuses) / static_cast<double>(total);
+        }
+    };
+} // namespace BeeEngine::Jobs
+
+namespace BeeEngine::Internal
+{
+    class Fiber;
+    struct JobWrapper;
+    /**
+     * @brief Recycles fiber objects and their stacks.
+     *
+     * Stacks are bucketed by the requested stack size, so jobs with
+     * Jobs::DefaultStackSize never share a bucket with large stacks
+     * (e.g. the 1 MiB frame job). Every bucket and the whole pool
+     * are capped, stacks above the cap are returned to the OS.
+     */
+    class FiberPool
+    {
+    public:
+        struct Config
+        {
+            size_t MaxCachedStacksPerSize = 256;
+            size_t MaxCachedStackMemory = 64 * 1024 * 1024; // in bytes
+            size_t MaxCachedFibers = 1024;
+        };
+        FiberPool();
+        explicit FiberPool(const Config& config);
+        ~FiberPool();
+        FiberPool(const FiberPool&) = delete;
+        FiberPool& operator=(const FiberPool&) = delete;
+
+        Fiber* AcquireFiber(JobWrapper&& job);
+        void ReleaseFiber(Fiber* fiber);
+
+        boost::context::stack_context AllocateStack(size_t size);
+        void DeallocateStack(size_t size, boost::context::stack_context& stack);
+
+        Jobs::FiberPoolStatistics GetStatistics() const;
+
+    private:
+        struct Bucket
+        {
+            size_t StackSize;
+            std::vector<boost::context::stack_context> FreeStacks;
+        };
+        Bucket& GetBucket(size_t size);
+        static void FreeStack(size_t size, boost::context::stack_context& stack);
+
+        Config m_Config;
+        std::vector<Bucket> m_Buckets;
+        size_t m_CachedStackMemory = 0;
+        mutable Jobs::SpinLock m_StackLock;
+        std::vector<void*> m_FreeFibers;
+        mutable Jobs::SpinLock m_FiberLock;
+
+        std::atomic<uint64_t> m_StackAllocations = 0;
+        std::atomic<uint64_t> m_StackReuses = 0;
+        std::atomic<uint64_t> m_StacksFreed = 0;
+        std::atomic<uint64_t> m_FiberAllocations = 0;
+        std::atomic<uint64_t> m_FiberReuses = 0;
+    };
+
+    /**
+     * @brief boost::context StackAllocator, that takes stacks from FiberPool
+     * and gives them back, when the fiber finishes
+     */
+    class PooledStackAllocator
+    {
+    public:
+        PooledStackAllocator(FiberPool& pool, size_t size) : m_Pool(&pool), m_Size(size) {}
+        boost::context::stack_context allocate() { return m_Pool->AllocateStack(m_Size); }
+        void deallocate(boost::context::stack_context& stack) { m_Pool->DeallocateStack(m_Size, stack); }
+
+    private:
+        FiberPool* m_Pool;
+        size_t m_Size;
+    };
+} // namespace BeeEngine::Internal
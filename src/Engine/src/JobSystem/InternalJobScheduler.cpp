@@ -25,14 +25,20 @@ namespace BeeEngine
 
     namespace Internal
     {
-        thread_local Ref<Internal::Fiber> JobScheduler::s_CurrentFiber = nullptr;
+        thread_local Internal::Fiber* JobScheduler::s_CurrentFiber = nullptr;
+        thread_local JobScheduler::Worker* JobScheduler::s_CurrentWorker = nullptr;
         thread_local boost::context::continuation JobScheduler::s_MainContext{};
 
-        Ref<Internal::Fiber>& JobScheduler::GetCurrentFiber()
+        Internal::Fiber*& JobScheduler::GetCurrentFiber()
         {
             return s_CurrentFiber;
         }
 
+        JobScheduler::Worker*& JobScheduler::GetCurrentWorker()
+        {
+            return s_CurrentWorker;
+        }
+
         boost::context::continuation& JobScheduler::GetMainContext()
         {
             return s_MainContext;
@@ -3,10 +3,17 @@
 //
 
 #pragma once
+#include <array>
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
 #include <cstddef>
+#include <deque>
+#include <functional>
+#include <limits>
 #include <mutex>
 #include <queue>
+#include <thread>
 #include <type_traits>
 #include <variant>
 #include <vector>
@@ -14,6 +21,8 @@
 #include "Core/TypeDefines.h"
 #include "JobScheduler.h"
 #include "JobSystem/JobScheduler.h"
+#include "FiberPool.h"
+#include "WorkStealingDeque.h"
 
 namespace BeeEngine
 {
@@ -22,19 +31,34 @@ namespace BeeEngine
         class Fiber
         {
         public:
-            Fiber(JobWrapper&& job);
+            enum class State : uint8_t
+            {
+                Ready,
+                Running,
+                Yielded,
+                Waiting,
+                Completed
+            };
+            Fiber(JobWrapper&& job, FiberPool& pool);
 
             Fiber(Fiber&& other) noexcept;
 
             // Запускает или возобновляет выполнение файбера
             void Resume();
+            // Возвращает управление планировщику. Вызывается только из самого файбера
+            void Suspend(State state);
+            void Suspend(Jobs::ConditionType condition);
 
-            bool isCompleted() const { return m_IsCompleted; }
+            bool isCompleted() const { return m_State == State::Completed; }
+            State GetState() const { return m_State; }
+            const Jobs::ConditionType& GetWaitCondition() const { return m_WaitCondition; }
 
-            void MarkIncomplete() { m_IsCompleted = false; }
-            void MarkCompleted() { m_IsCompleted = true; }
+            // Intrusive list of fibers parked on the same Jobs::Counter
+            Fiber* GetNextWaiter() const { return m_NextWaiter; }
+            void SetNextWaiter(Fiber* fiber) { m_NextWaiter = fiber; }
 
-            JobWrapper GetJob() { return m_Job; }
+            const JobWrapper& GetJob() const { return m_Job; }
+            Jobs::Priority GetPriority() const { return m_Job.Priority; }
 
             boost::context::continuation& GetContext() { return m_Continuation; }
 
@@ -44,12 +68,15 @@ namespace BeeEngine
 
         private:
             JobWrapper m_Job;
+            FiberPool* m_Pool;
             void* m_StackPointer = nullptr;
             void* m_StackTop = nullptr;
             void* m_StackBottom = nullptr;
             size_t m_StackSize = 0;
             boost::context::continuation m_Continuation;
-            std::atomic<bool> m_IsCompleted = false;
+            Jobs::ConditionType m_WaitCondition = static_cast<Jobs::Counter*>(nullptr);
+            State m_State = State::Ready;
+            Fiber* m_NextWaiter = nullptr;
         };
         class JobScheduler
         {
@@ -58,109 +85,122 @@ namespace BeeEngine
             friend size_t BeeEngine::Jobs::this_job::TotalStackSize();
             friend size_t BeeEngine::Jobs::this_job::AvailableStackSize();
             friend void Jobs::this_job::SleepFor(Time::millisecondsD time);
-            struct WaitingContext
+            friend uint32_t Jobs::this_job::GetWorkerIndex();
+            friend class Jobs::Counter;
+            friend class WaitList;
+            friend class Wakeups;
+            using Clock = std::chrono::high_resolution_clock;
+            struct Timer
             {
-                Ref<::BeeEngine::Internal::Fiber> fiber;
-                std::variant<::BeeEngine::Jobs::Counter*, std::chrono::high_resolution_clock::time_point> condition;
-                WaitingContext(::BeeEngine::Ref<::BeeEngine::Internal::Fiber>&& fiber, Jobs::ConditionType condition);
-                WaitingContext(const Ref<::BeeEngine::Internal::Fiber>& fiber, Jobs::ConditionType condition);
+                Clock::time_point Deadline;
+                ::BeeEngine::Internal::Fiber* fiber;
+                bool operator>(const Timer& other) const { return Deadline > other.Deadline; }
             };
-
-        public:
-            JobScheduler(uint32_t numberOfThreads = Hardware::GetNumberOfCores());
-            ~JobScheduler()
-            {
-                if (!m_Done)
-                    Stop();
-            }
-            void Schedule(JobWrapper&& job);
-            void ScheduleAll(std::ranges::range auto& jobs)
+            static constexpr size_t NumberOfPriorities = Jobs::NumberOfPriorities;
+            /**
+             * Telemetry counters. Workers update only their own counters,
+             * so relaxed increments stay cheap and never contend.
+             */
+            struct Counters
             {
-                if (std::ranges::size(jobs) == 0)
-                {
-                    return;
-                }
-                std::unique_lock lock(m_QueueMutex);
-                for (auto& job : jobs)
-                {
-                    auto& queue = GetQueue(job.Priority);
-                    if (jobs.Counter)
-                    {
-                        jobs.Counter->Increment();
-                    }
-                    queue.push(&job);
-                }
-                m_ConditionVariable.notify_all();
-            }
-            void ScheduleAll(std::vector<JobWrapper> jobs)
-            {
-                if (jobs.empty())
-                {
-                    return;
-                }
-                std::unique_lock lock(m_QueueMutex);
-                for (auto& job : jobs)
+                std::atomic<uint64_t> JobsCompleted = 0;
+                std::atomic<uint64_t> Resumes = 0;
+                std::atomic<uint64_t> Yields = 0;
+                std::atomic<uint64_t> Waits = 0;
+                std::atomic<uint64_t> Steals = 0;
+                std::atomic<uint64_t> BusyTime = 0; // in nanoseconds
+                std::atomic<uint64_t> IdleTime = 0; // in nanoseconds
+
+                static void Add(std::atomic<uint64_t>& counter, uint64_t value = 1)
                 {
-                    auto& queue = GetQueue(job.Priority);
-                    if (job.Counter)
-                    {
-                        job.Counter->Increment();
-                    }
-                    queue.push(job);
+                    counter.fetch_add(value, std::memory_order_relaxed);
                 }
-                m_ConditionVariable.notify_all();
-            }
-            void Stop()
+                Jobs::WorkerStatistics Load() const;
+            };
+            /**
+             * Every worker owns one lock-free deque per priority.
+             * Jobs scheduled from a worker go to its own deque,
+             * idle workers steal from the others.
+             */
+            struct Worker
             {
+                JobScheduler* Owner = nullptr;
+                uint32_t Index = 0;
+                uint32_t RandomState = 0;
+                std::array<WorkStealingDeque<::BeeEngine::Internal::Fiber*>, NumberOfPriorities> Queues;
+                Counters Statistics;
+                uint32_t NextRandom()
                 {
-                    std::unique_lock<std::mutex> lock(m_QueueMutex);
-                    m_Done = true;
-                }
-                m_ConditionVariable.notify_all();
-                for (auto& thread : m_Threads)
-                {
-                    thread.join();
+                    // xorshift32
+                    RandomState ^= RandomState << 13;
+                    RandomState ^= RandomState >> 17;
+                    RandomState ^= RandomState << 5;
+                    return RandomState;
                 }
-            }
+            };
+
+        public:
+            JobScheduler(uint32_t numberOfThreads = Hardware::GetNumberOfCores());
+            ~JobScheduler();
+            void Schedule(JobWrapper&& job);
+            void ScheduleAll(std::vector<JobWrapper> jobs);
+            void Stop();
             void WaitForJobsToComplete(Jobs::Counter& counter);
+            void WaitForJobsToCompleteAndHelp(Jobs::Counter& counter, Jobs::Priority minimalPriority);
+            uint32_t GetNumberOfWorkers() const { return static_cast<uint32_t>(m_Workers.size()); }
+            Jobs::FiberPoolStatistics GetFiberPoolStatistics() const { return m_FiberPool.GetStatistics(); }
+            Jobs::JobSystemStatistics GetStatistics() const;
 
         private:
-            // void Schedule(Ref<Internal::Fiber>&& fiber);
+            static constexpr size_t PriorityIndex(Jobs::Priority priority) { return static_cast<size_t>(priority); }
 
-            std::queue<JobWrapper>& GetQueue(Jobs::Priority priority)
-            {
-                switch (priority)
-                {
-                    case Jobs::Priority::High:
-                        return m_HighPriorityJobs;
-                    case Jobs::Priority::Low:
-                        return m_LowPriorityJobs;
-                    default:
-                        return m_MediumPriorityJobs;
-                }
-            }
+            void WorkerThread(uint32_t index);
+            void RunFiber(::BeeEngine::Internal::Fiber* fiber);
+            void Push(::BeeEngine::Internal::Fiber* fiber);
+            void PushToGlobalQueue(::BeeEngine::Internal::Fiber* fiber);
+            ::BeeEngine::Internal::Fiber* FindWork(Worker& worker);
+            ::BeeEngine::Internal::Fiber* PopGlobalQueue(size_t priorityIndex);
+            ::BeeEngine::Internal::Fiber* Steal(Worker& thief, size_t priorityIndex);
+            ::BeeEngine::Internal::Fiber* Steal(const Worker* thief, uint32_t firstVictim, size_t priorityIndex);
+            // Work for threads, that are not workers, but wait for a counter
+            ::BeeEngine::Internal::Fiber* FindHelpWork(Jobs::Priority minimalPriority);
+            // Schedules a fiber, that was parked, again
+            void MakeReady(::BeeEngine::Internal::Fiber* fiber);
+            void Park(::BeeEngine::Internal::Fiber* fiber, Jobs::Counter* counter);
+            void AddTimer(::BeeEngine::Internal::Fiber* fiber, Clock::time_point deadline);
+            ::BeeEngine::Internal::Fiber* PopExpiredTimer();
+            bool HasWork() const;
+            // Returns false if scheduler is stopping
+            bool WaitForWork();
+            void WakeWorkers(uint32_t count = 1);
 
-            void WorkerThread();
-            inline bool AllQueuesEmpty() const
-            {
-                return m_HighPriorityJobs.empty() && m_MediumPriorityJobs.empty() && m_LowPriorityJobs.empty() &&
-                       m_WaitingJobs.empty();
-            }
-            bool GetNextFiber(Ref<::BeeEngine::Internal::Fiber>& fiber);
-            Ref<::BeeEngine::Internal::Fiber> PopJob(std::queue<JobWrapper>& queue);
+            // Must outlive all fibers
+            FiberPool m_FiberPool;
+            std::vector<Scope<Worker>> m_Workers;
             std::vector<std::thread> m_Threads;
-            std::queue<JobWrapper> m_LowPriorityJobs;
-            std::queue<JobWrapper> m_MediumPriorityJobs;
-            std::queue<JobWrapper> m_HighPriorityJobs;
-            std::mutex m_QueueMutex;
-            std::vector<WaitingContext> m_WaitingJobs;
-            std::mutex m_WaitingJobsMutex;
-            std::condition_variable m_ConditionVariable;
-            bool m_Done = false;
-            Ref<::BeeEngine::Internal::Fiber>& GetCurrentFiber();
+            // Jobs, that were scheduled outside of workers or yielded
+            std::array<std::deque<::BeeEngine::Internal::Fiber*>, NumberOfPriorities> m_GlobalQueues;
+            mutable std::mutex m_GlobalQueueMutex;
+            std::atomic<uint32_t> m_GlobalQueueSize = 0;
+            // Sleeping fibers ordered by deadline
+            std::priority_queue<Timer, std::vector<Timer>, std::greater<>> m_Timers;
+            mutable std::mutex m_TimersMutex;
+            std::atomic<Clock::rep> m_NextTimerDeadline = std::numeric_limits<Clock::rep>::max();
+            // Fibers, that are parked on Jobs::Counter
+            std::atomic<uint32_t> m_ParkedFibers = 0;
+            std::mutex m_SleepMutex;
+            std::condition_variable m_SleepConditionVariable;
+            uint32_t m_WakeEpoch = 0;
+            std::atomic<uint32_t> m_SleepingWorkers = 0;
+            std::atomic<bool> m_Done = false;
+            // Counters of threads, that are not workers, but run jobs in WaitForJobsToCompleteAndHelp
+            Counters m_HelperStatistics;
+            ::BeeEngine::Internal::Fiber*& GetCurrentFiber();
+            Worker*& GetCurrentWorker();
             boost::context::continuation& GetMainContext();
-            thread_local static Ref<::BeeEngine::Internal::Fiber> s_CurrentFiber;
+            thread_local static ::BeeEngine::Internal::Fiber* s_CurrentFiber;
+            thread_local static Worker* s_CurrentWorker;
             thread_local static boost::context::continuation s_MainContext;
         };
     } // namespace Internal
-} // namespace BeeEngine
+} // namespace BeeEngine
\ No newline at end of file
@@ -0,0 +1,101 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#include "JobArena.h"
+
+#include <bit>
+#include <mutex>
+#include <new>
+
+namespace BeeEngine::Internal
+{
+    JobArena::~JobArena()
+    {
+        for (size_t i = 0; i < NumberOfSizeClasses; ++i)
+        {
+            auto* block = m_SizeClasses[i].FreeList;
+            while (block)
+            {
+                auto* next = block->Next;
+                ::operator delete(static_cast<void*>(block), MinBlockSize << i);
+                block = next;
+            }
+        }
+    }
+
+    JobArena& JobArena::Get()
+    {
+        static JobArena arena;
+        return arena;
+    }
+
+    size_t JobArena::SizeClassIndex(size_t size)
+    {
+        if (size <= MinBlockSize)
+        {
+            return 0;
+        }
+        return std::bit_width(size - 1) - std::bit_width(MinBlockSize - 1);
+    }
+
+    void* JobArena::Allocate(size_t size, size_t alignment)
+    {
+        if (!FitsInBlock(size, alignment))
+        {
+            m_LargeAllocations.fetch_add(1, std::memory_order_relaxed);
+            return ::operator new(size, std::align_val_t{alignment});
+        }
+        const size_t index = SizeClassIndex(size);
+        auto& sizeClass = m_SizeClasses[index];
+        {
+            std::unique_lock lock(sizeClass.Lock);
+            if (auto* block = sizeClass.FreeList)
+            {
+                sizeClass.FreeList = block->Next;
+                --sizeClass.CachedBlocks;
+                m_BlockReuses.fetch_add(1, std::memory_order_relaxed);
+                return block;
+            }
+        }
+        m_BlockAllocations.fetch_add(1, std::memory_order_relaxed);
+        return ::operator new(MinBlockSize << index);
+    }
+
+    void JobArena::Deallocate(void* ptr, size_t size, size_t alignment)
+    {
+        if (!FitsInBlock(size, alignment))
+        {
+            ::operator delete(ptr, size, std::align_val_t{alignment});
+            return;
+        }
+        const size_t index = SizeClassIndex(size);
+        auto& sizeClass = m_SizeClasses[index];
+        {
+            std::unique_lock lock(sizeClass.Lock);
+            if (sizeClass.CachedBlocks < MaxCachedBlocksPerSize)
+            {
+                auto* block = new (ptr) FreeBlock{sizeClass.FreeList};
+                sizeClass.FreeList = block;
+                ++sizeClass.CachedBlocks;
+                return;
+            }
+        }
+        ::operator delete(ptr, MinBlockSize << index);
+    }
+
+    Jobs::JobArenaStatistics JobArena::GetStatistics() const
+    {
+        Jobs::JobArenaStatistics statistics;
+        statistics.BlockAllocations = m_BlockAllocations.load(std::memory_order_relaxed);
+        statistics.BlockReuses = m_BlockReuses.load(std::memory_order_relaxed);
+        statistics.LargeAllocations = m_LargeAllocations.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < NumberOfSizeClasses; ++i)
+        {
+            std::unique_lock lock(m_SizeClasses[i].Lock);
+            statistics.CachedBlocks += m_SizeClasses[i].CachedBlocks;
+            statistics.CachedMemory += m_SizeClasses[i].CachedBlocks * (MinBlockSize << i);
+        }
+        return statistics;
+    }
+} // namespace BeeEngine::Internal
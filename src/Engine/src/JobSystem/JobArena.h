@@ -0,0 +1,88 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#pragma once
+#include "JobSystem/SpinLock.h"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace BeeEngine::Jobs
+{
+    struct JobArenaStatistics
+    {
+        // Blocks, that had to be allocated from the heap
+        uint64_t BlockAllocations = 0;
+        // Blocks, that were taken from the arena
+        uint64_t BlockReuses = 0;
+        // Callables, that were too big or overaligned for the arena
+        uint64_t LargeAllocations = 0;
+        uint64_t CachedBlocks = 0;
+        uint64_t CachedMemory = 0; // in bytes
+
+        double HitRate() const
+        {
+            const uint64_t total = BlockAllocations + BlockReuses + LargeAllocations;
+            return total == 0 ? 0.0 : static_cast<double>(BlockReuses) / static_cast<double>(total);
+        }
+    };
+} // namespace BeeEngine::Jobs
+
+namespace BeeEngine::Internal
+{
+    /**
+     * @brief Storage for job callables, that don't fit into the inline buffer of JobWrapper.
+     *
+     * Blocks are grouped in power of two size classes and are recycled, when the job
+     * is destroyed, so after the first few frames jobs with big captures allocate nothing.
+     * Blocks are never reset all at once, because some jobs (asset loading, file watchers)
+     * live longer than a frame.
+     */
+    class JobArena
+    {
+    public:
+        static constexpr size_t MinBlockSize = 256;
+        static constexpr size_t MaxBlockSize = 4096;
+        static constexpr size_t MaxCachedBlocksPerSize = 1024;
+
+        JobArena() = default;
+        ~JobArena();
+        JobArena(const JobArena&) = delete;
+        JobArena& operator=(const JobArena&) = delete;
+
+        void* Allocate(size_t size, size_t alignment);
+        void Deallocate(void* ptr, size_t size, size_t alignment);
+
+        Jobs::JobArenaStatistics GetStatistics() const;
+
+        static JobArena& Get();
+
+    private:
+        struct FreeBlock
+        {
+            FreeBlock* Next;
+        };
+        struct SizeClass
+        {
+            FreeBlock* FreeList = nullptr;
+            size_t CachedBlocks = 0;
+            mutable Jobs::SpinLock Lock;
+        };
+        static constexpr size_t NumberOfSizeClasses = 5; // 256, 512, 1024, 2048, 4096
+        static_assert(MinBlockSize << (NumberOfSizeClasses - 1) == MaxBlockSize);
+
+        static size_t SizeClassIndex(size_t size);
+        static bool FitsInBlock(size_t size, size_t alignment)
+        {
+            return size <= MaxBlockSize && alignment <= alignof(std::max_align_t);
+        }
+
+        std::array<SizeClass, NumberOfSizeClasses> m_SizeClasses;
+
+        std::atomic<uint64_t> m_BlockAllocations = 0;
+        std::atomic<uint64_t> m_BlockReuses = 0;
+        std::atomic<uint64_t> m_LargeAllocations = 0;
+    };
+} // namespace BeeEngine::Internal
@@ -0,0 +1,152 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#include "JobGraph.h"
+#include "Core/CodeSafety/Expects.h"
+
+#include <Core/Move.h>
+
+namespace BeeEngine::Jobs
+{
+    JobGraph::Node::Node(std::string_view name,
+                         std::function<void()>&& function,
+                         Jobs::Priority priority,
+                         size_t stackSize)
+        : Name(name), Function(BeeMove(function)), Priority(priority), StackSize(stackSize)
+    {
+    }
+
+    JobGraph::Node::Node(Node&& other) noexcept
+        : Name(BeeMoveAlways(other.Name)),
+          Function(BeeMoveAlways(other.Function)),
+          Priority(other.Priority),
+          StackSize(other.StackSize),
+          Successors(BeeMoveAlways(other.Successors)),
+          NumberOfDependencies(other.NumberOfDependencies),
+          RemainingDependencies(other.RemainingDependencies.load(std::memory_order_relaxed))
+    {
+    }
+
+    JobGraph::~JobGraph()
+    {
+        BeeExpects(!IsRunning());
+    }
+
+    JobGraph::NodeID JobGraph::AddNode(std::string_view name,
+                                       std::function<void()> function,
+                                       Jobs::Priority priority,
+                                       size_t stackSize)
+    {
+        BeeExpects(!IsRunning());
+        BeeExpects(function);
+        m_Nodes.emplace_back(name, BeeMove(function), priority, stackSize);
+        return static_cast<NodeID>(m_Nodes.size() - 1);
+    }
+
+    void JobGraph::AddDependency(NodeID before, NodeID after)
+    {
+        BeeExpects(!IsRunning());
+        BeeExpects(before < m_Nodes.size() && after < m_Nodes.size());
+        BeeExpects(before != after);
+        m_Nodes[before].Successors.push_back(after);
+        ++m_Nodes[after].NumberOfDependencies;
+        m_Validated = false;
+    }
+
+    void JobGraph::Clear()
+    {
+        BeeExpects(!IsRunning());
+        m_Nodes.clear();
+        m_Validated = false;
+    }
+
+    bool JobGraph::HasCycle() const
+    {
+        // Kahn's algorithm: if not every node can be visited in topological order, there is a cycle
+        std::vector<uint32_t> dependencies(m_Nodes.size());
+        std::vector<NodeID> ready;
+        ready.reserve(m_Nodes.size());
+        for (NodeID node = 0; node < m_Nodes.size(); ++node)
+        {
+            dependencies[node] = m_Nodes[node].NumberOfDependencies;
+            if (dependencies[node] == 0)
+            {
+                ready.push_back(node);
+            }
+        }
+        size_t visited = 0;
+        while (!ready.empty())
+        {
+            NodeID node = ready.back();
+            ready.pop_back();
+            ++visited;
+            for (NodeID successor : m_Nodes[node].Successors)
+            {
+                if (--dependencies[successor] == 0)
+                {
+                    ready.push_back(successor);
+                }
+            }
+        }
+        return visited != m_Nodes.size();
+    }
+
+    void JobGraph::Run(Jobs::Counter& counter)
+    {
+        BeeExpects(!IsRunning());
+        if (!m_Validated)
+        {
+            BeeExpects(!HasCycle());
+            m_Validated = true;
+        }
+        if (m_Nodes.empty())
+        {
+            return;
+        }
+        for (auto& node : m_Nodes)
+        {
+            node.RemainingDependencies.store(node.NumberOfDependencies, std::memory_order_relaxed);
+        }
+        m_Counter = &counter;
+        // Release pairs with the acquire in the worker, that pops the first scheduled node
+        m_RunningNodes.store(static_cast<uint32_t>(m_Nodes.size()), std::memory_order_release);
+        for (NodeID node = 0; node < m_Nodes.size(); ++node)
+        {
+            if (m_Nodes[node].NumberOfDependencies == 0)
+            {
+                ScheduleNode(node);
+            }
+        }
+    }
+
+    void JobGraph::RunAndWait()
+    {
+        Jobs::Counter counter;
+        Run(counter);
+        Jobs::WaitForJobsToComplete(counter);
+    }
+
+    void JobGraph::ScheduleNode(NodeID node)
+    {
+        auto& data = m_Nodes[node];
+        Jobs::Schedule(
+            Jobs::CreateJob(*m_Counter, data.Priority, data.StackSize, [this, node]() { RunNode(node); }));
+    }
+
+    void JobGraph::RunNode(NodeID node)
+    {
+        auto& data = m_Nodes[node];
+        data.Function();
+        // Successors are scheduled before this job decrements the counter,
+        // so the counter can't reach zero while the graph is still running
+        for (NodeID successor : data.Successors)
+        {
+            if (m_Nodes[successor].RemainingDependencies.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                ScheduleNode(successor);
+            }
+        }
+        m_RunningNodes.fetch_sub(1, std::memory_order_release);
+    }
+} // namespace BeeEngine::Jobs
@@ -0,0 +1,100 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#pragma once
+#include "JobSystem/JobScheduler.h"
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace BeeEngine::Jobs
+{
+    /**
+     * @brief Declarative graph of jobs. Nodes are jobs, edges are dependencies.
+     *
+     * When the graph is run, nodes without dependencies are scheduled at once,
+     * every other node is scheduled by the last of its dependencies to finish,
+     * so no fiber waits in between. The graph is built once and can be run
+     * every frame: running it does not allocate.
+     *
+     * @code
+     * Jobs::JobGraph frame;
+     * auto physics = frame.AddNode("Physics", [] { ... });
+     * auto transforms = frame.AddNode("Transforms", [] { ... });
+     * auto extraction = frame.AddNode("Extraction", [] { ... });
+     * frame.AddDependency(physics, transforms);
+     * frame.AddDependency(transforms, extraction);
+     * ...
+     * frame.RunAndWait();
+     * @endcode
+     */
+    class JobGraph
+    {
+    public:
+        using NodeID = uint32_t;
+
+        JobGraph() = default;
+        JobGraph(const JobGraph&) = delete;
+        JobGraph& operator=(const JobGraph&) = delete;
+        ~JobGraph();
+
+        NodeID AddNode(std::string_view name,
+                       std::function<void()> function,
+                       Jobs::Priority priority = Jobs::Priority::Normal,
+                       size_t stackSize = DefaultStackSize);
+        /**
+         * @brief Node after will be scheduled only after node before has finished
+         */
+        void AddDependency(NodeID before, NodeID after);
+
+        /**
+         * @brief Schedules the graph. Counter reaches zero, when every node has finished.
+         * The graph must not be modified, run again or destroyed until then.
+         */
+        void Run(Jobs::Counter& counter);
+        /**
+         * @brief Runs the graph and waits for it to finish.
+         * Parks the fiber if called in a job, blocks the thread otherwise.
+         */
+        void RunAndWait();
+
+        /**
+         * @brief Returns true if the graph has a cycle and could never finish
+         */
+        bool HasCycle() const;
+        bool IsRunning() const { return m_RunningNodes.load(std::memory_order_acquire) > 0; }
+        size_t GetNumberOfNodes() const { return m_Nodes.size(); }
+        std::string_view GetNodeName(NodeID node) const { return m_Nodes[node].Name; }
+
+        void Clear();
+
+    private:
+        struct Node
+        {
+            std::string Name;
+            std::function<void()> Function;
+            Jobs::Priority Priority;
+            size_t StackSize;
+            std::vector<NodeID> Successors;
+            uint32_t NumberOfDependencies = 0;
+            // Reset from NumberOfDependencies on every run
+            std::atomic<uint32_t> RemainingDependencies = 0;
+
+            Node(std::string_view name, std::function<void()>&& function, Jobs::Priority priority, size_t stackSize);
+            Node(Node&& other) noexcept;
+        };
+        void ScheduleNode(NodeID node);
+        void RunNode(NodeID node);
+
+        std::vector<Node> m_Nodes;
+        Jobs::Counter* m_Counter = nullptr;
+        // Cycle check is done once after the graph was changed
+        bool m_Validated = false;
+        // Nodes of the current run, that have not finished yet
+        std::atomic<uint32_t> m_RunningNodes = 0;
+    };
+} // namespace BeeEngine::Jobs
@@ -7,17 +7,16 @@
 #include "InternalJobScheduler.h"
 
 #include <boost/context/preallocated.hpp>
-#include <boost/context/protected_fixedsize_stack.hpp>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <algorithm>
 #include <optional>
 #include <type_traits>
 #include <utility>
 #include <variant>
 #undef GetJob
 #include <mutex>
-#include <queue>
 
 #include "Core/TypeDefines.h"
 #include "Platform/Platform.h"
@@ -27,24 +26,21 @@ namespace BeeEngine
 {
     void Internal::Fiber::Resume()
     {
+        m_State = State::Running;
         if (!m_Continuation)
         {
 // Первый запуск
-#if !defined(DEBUG)
-            boost::context::protected_fixedsize_stack stack_alloc(m_Job.StackSize);
-#else
-            boost::context::fixedsize_stack stack_alloc(m_Job.StackSize);
-#endif
+            PooledStackAllocator stack_alloc(*m_Pool, m_Job.StackSize);
             auto stackContext = stack_alloc.allocate();
             auto func = [this](boost::context::continuation&& c)
             {
                 m_Continuation = std::move(c);
-                m_IsCompleted = true;
                 m_Job();
-                if (m_Job.Counter && m_IsCompleted)
+                if (m_Job.Counter)
                 {
                     m_Job.Counter->Decrement();
                 }
+                m_State = State::Completed;
                 return std::move(m_Continuation);
             };
             boost::context::preallocated prealloc{stackContext.sp, stackContext.size, stackContext};
@@ -69,63 +65,506 @@ namespace BeeEngine
         else
         {
             // Возобновление
-            m_IsCompleted = true;
             m_Continuation = m_Continuation.resume();
         }
     }
 
-    Internal::Fiber::Fiber(JobWrapper&& job) : m_Job(BeeMove(job)), m_IsCompleted(false)
+    void Internal::Fiber::Suspend(State state)
+    {
+        m_State = state;
+        m_Continuation = m_Continuation.resume();
+    }
+
+    void Internal::Fiber::Suspend(Jobs::ConditionType condition)
+    {
+        m_WaitCondition = condition;
+        Suspend(State::Waiting);
+    }
+
+    Internal::Fiber::Fiber(JobWrapper&& job, FiberPool& pool) : m_Job(BeeMove(job)), m_Pool(&pool) {}
+
+    Internal::Fiber::Fiber(BeeEngine::Internal::Fiber&& other) noexcept
+        : m_Job(BeeMove(other).m_Job),
+          m_Pool(other.m_Pool),
+          m_Continuation(std::move(other.m_Continuation)),
+          m_WaitCondition(other.m_WaitCondition),
+          m_State(other.m_State)
     {
-        /*if (auto counter = job->Counter)
-        {
-            counter->Increment();
-        }*/
     }
 
     void Internal::JobScheduler::Schedule(JobWrapper&& job)
     {
+        if (job.Counter)
+        {
+            job.Counter->Increment();
+        }
+        Push(m_FiberPool.AcquireFiber(BeeMove(job)));
+        WakeWorkers();
+    }
+
+    void Internal::JobScheduler::ScheduleAll(std::vector<JobWrapper> jobs)
+    {
+        if (jobs.empty())
+        {
+            return;
+        }
+        for (auto& job : jobs)
         {
-            std::unique_lock<std::mutex> lock(m_QueueMutex);
-            auto& queue = GetQueue(job.Priority);
             if (job.Counter)
             {
                 job.Counter->Increment();
             }
-            queue.push(BeeMove(job));
+            Push(m_FiberPool.AcquireFiber(BeeMoveAlways(job)));
         }
-        m_ConditionVariable.notify_one();
+        WakeWorkers(static_cast<uint32_t>(jobs.size()));
     }
 
-    void Internal::JobScheduler::WorkerThread()
+    void Internal::JobScheduler::Push(Internal::Fiber* fiber)
+    {
+        auto* worker = GetCurrentWorker();
+        if (worker && worker->Owner == this)
+        {
+            worker->Queues[PriorityIndex(fiber->GetPriority())].Push(fiber);
+            return;
+        }
+        PushToGlobalQueue(fiber);
+    }
+
+    void Internal::JobScheduler::PushToGlobalQueue(Internal::Fiber* fiber)
+    {
+        std::unique_lock lock(m_GlobalQueueMutex);
+        m_GlobalQueues[PriorityIndex(fiber->GetPriority())].push_back(fiber);
+        m_GlobalQueueSize.fetch_add(1, std::memory_order_release);
+    }
+
+    void Internal::JobScheduler::WakeWorkers(uint32_t count)
+    {
+        // Pairs with the fence in WaitForWork: either the sleeping worker sees the new job
+        // or we see the sleeping worker
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_SleepingWorkers.load(std::memory_order_relaxed) == 0)
+        {
+            return;
+        }
+        {
+            std::unique_lock lock(m_SleepMutex);
+            ++m_WakeEpoch;
+        }
+        if (count == 1)
+        {
+            m_SleepConditionVariable.notify_one();
+        }
+        else
+        {
+            m_SleepConditionVariable.notify_all();
+        }
+    }
+
+    void Internal::JobScheduler::Stop()
+    {
+        if (m_Done.exchange(true))
+        {
+            return;
+        }
+        {
+            std::unique_lock lock(m_SleepMutex);
+            ++m_WakeEpoch;
+        }
+        m_SleepConditionVariable.notify_all();
+        for (auto& thread : m_Threads)
+        {
+            thread.join();
+        }
+    }
+
+    Internal::JobScheduler::~JobScheduler()
+    {
+        Stop();
+        auto statistics = m_FiberPool.GetStatistics();
+        BeeCoreInfo("JobScheduler: {} stacks allocated, {} reused (hit rate {:.1f}%), {} fibers allocated, {} reused",
+                    statistics.StackAllocations,
+                    statistics.StackReuses,
+                    statistics.StackHitRate() * 100.0,
+                    statistics.FiberAllocations,
+                    statistics.FiberReuses);
+        if (auto parked = m_ParkedFibers.load(); parked > 0)
+        {
+            BeeCoreWarn("JobScheduler: {} jobs are still waiting for their counters on shutdown", parked);
+        }
+        for (auto& worker : m_Workers)
+        {
+            for (auto& queue : worker->Queues)
+            {
+                while (auto fiber = queue.Pop())
+                {
+                    m_FiberPool.ReleaseFiber(*fiber);
+                }
+            }
+        }
+        for (auto& queue : m_GlobalQueues)
+        {
+            for (auto* fiber : queue)
+            {
+                m_FiberPool.ReleaseFiber(fiber);
+            }
+        }
+        while (!m_Timers.empty())
+        {
+            m_FiberPool.ReleaseFiber(m_Timers.top().fiber);
+            m_Timers.pop();
+        }
+    }
+
+    void Internal::JobScheduler::WorkerThread(uint32_t index)
     {
         GetMainContext() = boost::context::callcc(
-            [this](boost::context::continuation&& c)
+            [this, index](boost::context::continuation&& c)
             {
                 BeeCoreTrace("JobScheduler::WorkerThread: Starting thread {0}", std::this_thread::get_id());
                 GetMainContext() = std::move(c);
-                while (!m_Done)
+                Worker& worker = *m_Workers[index];
+                GetCurrentWorker() = &worker;
+                while (!m_Done.load(std::memory_order_acquire))
                 {
+                    auto* fiber = FindWork(worker);
+                    if (!fiber)
                     {
-                        std::unique_lock lock(m_QueueMutex);
-                        // BeeCoreTrace("Waiting on job {0}", std::this_thread::get_id());
-                        m_ConditionVariable.wait(lock, [this] { return !AllQueuesEmpty() || m_Done; });
-                        if (AllQueuesEmpty() || m_Done)
+                        const auto idleStart = Clock::now();
+                        const bool running = WaitForWork();
+                        Counters::Add(worker.Statistics.IdleTime,
+                                      std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - idleStart)
+                                          .count());
+                        if (!running)
                         {
                             break;
                         }
-
-                        if (!GetNextFiber(GetCurrentFiber()))
-                        {
-                            continue;
-                        }
+                        continue;
                     }
                     // BeeCoreTrace("Starting job {0}", std::this_thread::get_id());
-                    GetCurrentFiber()->Resume();
+                    RunFiber(fiber);
                 }
+                GetCurrentWorker() = nullptr;
                 BeeCoreTrace("JobScheduler::WorkerThread: Exiting thread {0}", std::this_thread::get_id());
                 return std::move(GetMainContext());
             });
     }
+
+    void Internal::JobScheduler::RunFiber(Internal::Fiber* fiber)
+    {
+        auto* worker = GetCurrentWorker();
+        auto& statistics = worker && worker->Owner == this ? worker->Statistics : m_HelperStatistics;
+        const auto start = Clock::now();
+        GetCurrentFiber() = fiber;
+        fiber->Resume();
+        GetCurrentFiber() = nullptr;
+        Counters::Add(statistics.Resumes);
+        Counters::Add(statistics.BusyTime,
+                      std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+        // Fiber is published only after it fully switched back to this thread,
+        // otherwise another worker could resume it while its context is still being saved
+        switch (fiber->GetState())
+        {
+            case Fiber::State::Completed:
+                Counters::Add(statistics.JobsCompleted);
+                m_FiberPool.ReleaseFiber(fiber);
+                break;
+            case Fiber::State::Yielded:
+                Counters::Add(statistics.Yields);
+                // Global queue is checked after the local one, so other jobs get a chance to run
+                PushToGlobalQueue(fiber);
+                WakeWorkers();
+                break;
+            case Fiber::State::Waiting:
+                Counters::Add(statistics.Waits);
+                std::visit(
+                    [this, fiber](auto&& condition)
+                    {
+                        using T = std::remove_cvref_t<decltype(condition)>;
+                        if constexpr (std::is_same_v<Jobs::Counter*, T>)
+                        {
+                            if (condition)
+                            {
+                                Park(fiber, condition);
+                            }
+                            else
+                            {
+                                Push(fiber);
+                            }
+                        }
+                        else if constexpr (std::is_same_v<Clock::time_point, T>)
+                        {
+                            AddTimer(fiber, condition);
+                        }
+                        else if constexpr (std::is_same_v<Jobs::SpinLock*, T>)
+                        {
+                            // Fiber is already in a wait list. It can be woken only after the lock is released,
+                            // so nobody can resume it before the switch is complete
+                            m_ParkedFibers.fetch_add(1, std::memory_order_relaxed);
+                            condition->unlock();
+                        }
+                        else
+                        {
+                            BeeEnsures(false);
+                            std::unreachable();
+                        }
+                    },
+                    fiber->GetWaitCondition());
+                break;
+            default:
+                BeeEnsures(false);
+                std::unreachable();
+        }
+    }
+
+    Internal::Fiber* Internal::JobScheduler::FindWork(Worker& worker)
+    {
+        if (auto* fiber = PopExpiredTimer())
+        {
+            return fiber;
+        }
+        for (size_t priority = NumberOfPriorities; priority-- > 0;)
+        {
+            if (auto fiber = worker.Queues[priority].Pop())
+            {
+                return *fiber;
+            }
+            if (auto* fiber = PopGlobalQueue(priority))
+            {
+                return fiber;
+            }
+            if (auto* fiber = Steal(worker, priority))
+            {
+                return fiber;
+            }
+        }
+        return nullptr;
+    }
+
+    Internal::Fiber* Internal::JobScheduler::PopGlobalQueue(size_t priorityIndex)
+    {
+        if (m_GlobalQueueSize.load(std::memory_order_acquire) == 0)
+        {
+            return nullptr;
+        }
+        std::unique_lock lock(m_GlobalQueueMutex);
+        auto& queue = m_GlobalQueues[priorityIndex];
+        if (queue.empty())
+        {
+            return nullptr;
+        }
+        auto* fiber = queue.front();
+        queue.pop_front();
+        m_GlobalQueueSize.fetch_sub(1, std::memory_order_relaxed);
+        return fiber;
+    }
+
+    Internal::Fiber* Internal::JobScheduler::Steal(Worker& thief, size_t priorityIndex)
+    {
+        // Start from random victim to spread contention between workers
+        auto* fiber = Steal(&thief, thief.NextRandom(), priorityIndex);
+        if (fiber)
+        {
+            Counters::Add(thief.Statistics.Steals);
+        }
+        return fiber;
+    }
+
+    Internal::Fiber*
+    Internal::JobScheduler::Steal(const Worker* thief, uint32_t firstVictim, size_t priorityIndex)
+    {
+        const uint32_t numberOfWorkers = GetNumberOfWorkers();
+        const uint32_t start = firstVictim % numberOfWorkers;
+        for (uint32_t i = 0; i < numberOfWorkers; ++i)
+        {
+            auto& victim = *m_Workers[(start + i) % numberOfWorkers];
+            if (&victim == thief)
+            {
+                continue;
+            }
+            if (auto fiber = victim.Queues[priorityIndex].Steal())
+            {
+                return *fiber;
+            }
+        }
+        return nullptr;
+    }
+
+    Internal::Fiber* Internal::JobScheduler::FindHelpWork(Jobs::Priority minimalPriority)
+    {
+        for (size_t priority = NumberOfPriorities; priority-- > PriorityIndex(minimalPriority);)
+        {
+            if (auto* fiber = PopGlobalQueue(priority))
+            {
+                return fiber;
+            }
+            if (auto* fiber = Steal(nullptr, 0, priority))
+            {
+                Counters::Add(m_HelperStatistics.Steals);
+                return fiber;
+            }
+        }
+        return nullptr;
+    }
+
+    Jobs::WorkerStatistics Internal::JobScheduler::Counters::Load() const
+    {
+        Jobs::WorkerStatistics statistics;
+        statistics.JobsCompleted = JobsCompleted.load(std::memory_order_relaxed);
+        statistics.Resumes = Resumes.load(std::memory_order_relaxed);
+        statistics.Yields = Yields.load(std::memory_order_relaxed);
+        statistics.Waits = Waits.load(std::memory_order_relaxed);
+        statistics.Steals = Steals.load(std::memory_order_relaxed);
+        statistics.BusyTime = BusyTime.load(std::memory_order_relaxed);
+        statistics.IdleTime = IdleTime.load(std::memory_order_relaxed);
+        return statistics;
+    }
+
+    Jobs::JobSystemStatistics Internal::JobScheduler::GetStatistics() const
+    {
+        Jobs::JobSystemStatistics statistics;
+        statistics.Workers.reserve(m_Workers.size());
+        for (auto& worker : m_Workers)
+        {
+            statistics.Workers.push_back(worker->Statistics.Load());
+            for (size_t priority = 0; priority < NumberOfPriorities; ++priority)
+            {
+                statistics.QueueDepths[priority] += worker->Queues[priority].Size();
+            }
+        }
+        statistics.Helpers = m_HelperStatistics.Load();
+        {
+            std::unique_lock lock(m_GlobalQueueMutex);
+            for (size_t priority = 0; priority < NumberOfPriorities; ++priority)
+            {
+                statistics.QueueDepths[priority] += m_GlobalQueues[priority].size();
+            }
+        }
+        {
+            std::unique_lock lock(m_TimersMutex);
+            statistics.SleepingJobs = m_Timers.size();
+        }
+        statistics.WaitingJobs = m_ParkedFibers.load(std::memory_order_relaxed);
+        statistics.SleepingWorkers = m_SleepingWorkers.load(std::memory_order_relaxed);
+        return statistics;
+    }
+
+    void Internal::JobScheduler::MakeReady(Internal::Fiber* fiber)
+    {
+        m_ParkedFibers.fetch_sub(1, std::memory_order_relaxed);
+        Push(fiber);
+        WakeWorkers();
+    }
+
+    void Internal::JobScheduler::Park(Internal::Fiber* fiber, Jobs::Counter* counter)
+    {
+        m_ParkedFibers.fetch_add(1, std::memory_order_relaxed);
+        if (!counter->AddWaiter(fiber))
+        {
+            // Counter reached zero, while the fiber was switching out
+            m_ParkedFibers.fetch_sub(1, std::memory_order_relaxed);
+            Push(fiber);
+        }
+    }
+
+    void Internal::JobScheduler::AddTimer(Internal::Fiber* fiber, Clock::time_point deadline)
+    {
+        bool earliest;
+        {
+            std::unique_lock lock(m_TimersMutex);
+            m_Timers.push({deadline, fiber});
+            earliest = m_Timers.top().fiber == fiber;
+            m_NextTimerDeadline.store(m_Timers.top().Deadline.time_since_epoch().count(), std::memory_order_release);
+        }
+        if (earliest)
+        {
+            // Sleeping workers must recalculate, when they need to wake up
+            WakeWorkers();
+        }
+    }
+
+    Internal::Fiber* Internal::JobScheduler::PopExpiredTimer()
+    {
+        const auto nextDeadline = m_NextTimerDeadline.load(std::memory_order_acquire);
+        if (nextDeadline == std::numeric_limits<Clock::rep>::max())
+        {
+            return nullptr;
+        }
+        const auto now = Clock::now();
+        if (now.time_since_epoch().count() < nextDeadline)
+        {
+            return nullptr;
+        }
+        std::unique_lock lock(m_TimersMutex);
+        if (m_Timers.empty() || m_Timers.top().Deadline > now)
+        {
+            return nullptr;
+        }
+        auto* fiber = m_Timers.top().fiber;
+        m_Timers.pop();
+        m_NextTimerDeadline.store(m_Timers.empty() ? std::numeric_limits<Clock::rep>::max()
+                                                   : m_Timers.top().Deadline.time_since_epoch().count(),
+                                  std::memory_order_release);
+        return fiber;
+    }
+
+    bool Internal::JobScheduler::HasWork() const
+    {
+        if (m_GlobalQueueSize.load(std::memory_order_relaxed) > 0)
+        {
+            return true;
+        }
+        for (auto& worker : m_Workers)
+        {
+            for (auto& queue : worker->Queues)
+            {
+                if (!queue.Empty())
+                {
+                    return true;
+                }
+            }
+        }
+        const auto nextDeadline = m_NextTimerDeadline.load(std::memory_order_relaxed);
+        return nextDeadline != std::numeric_limits<Clock::rep>::max() &&
+               Clock::now().time_since_epoch().count() >= nextDeadline;
+    }
+
+    bool Internal::JobScheduler::WaitForWork()
+    {
+        constexpr uint32_t spinCount = 32;
+        for (uint32_t i = 0; i < spinCount; ++i)
+        {
+            if (m_Done.load(std::memory_order_relaxed))
+            {
+                return false;
+            }
+            if (HasWork())
+            {
+                return true;
+            }
+            std::this_thread::yield();
+        }
+        std::unique_lock lock(m_SleepMutex);
+        const uint32_t epoch = m_WakeEpoch;
+        m_SleepingWorkers.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (!m_Done.load(std::memory_order_relaxed) && !HasWork())
+        {
+            auto woken = [this, epoch] { return m_WakeEpoch != epoch || m_Done.load(std::memory_order_relaxed); };
+            const auto nextDeadline = m_NextTimerDeadline.load(std::memory_order_acquire);
+            if (nextDeadline == std::numeric_limits<Clock::rep>::max())
+            {
+                m_SleepConditionVariable.wait(lock, woken);
+            }
+            else
+            {
+                m_SleepConditionVariable.wait_until(
+                    lock, Clock::time_point(Clock::duration(nextDeadline)), woken);
+            }
+        }
+        m_SleepingWorkers.fetch_sub(1, std::memory_order_relaxed);
+        return !m_Done.load(std::memory_order_acquire);
+    }
+
     void Internal::Schedule(JobWrapper&& job)
     {
         Internal::Job::s_Instance->Schedule(BeeMove(job));
@@ -138,50 +577,57 @@ namespace BeeEngine
     {
         s_Instance = new Internal::JobScheduler(numberOfThreads);
     }
-    namespace Internal
-    {
-        Ref<Internal::Fiber> JobScheduler::PopJob(std::queue<JobWrapper>& queue)
-        {
-            auto job = CreateRef<Internal::Fiber>(std::move(queue.front()));
-            queue.pop();
-            return job;
-        }
-    } // namespace Internal
 
     void Jobs::WaitForJobsToComplete(Jobs::Counter& counter)
     {
         Internal::Job::s_Instance->WaitForJobsToComplete(counter);
     }
 
-    void Internal::Job::Shutdown()
+    void Jobs::WaitForJobsToCompleteAndHelp(Jobs::Counter& counter, Jobs::Priority minimalPriority)
     {
-        delete Internal::Job::s_Instance;
+        Internal::Job::s_Instance->WaitForJobsToCompleteAndHelp(counter, minimalPriority);
     }
 
-    Internal::Fiber::Fiber(BeeEngine::Internal::Fiber&& other) noexcept
-        : m_Job(BeeMove(other).m_Job),
-          m_Continuation(std::move(other.m_Continuation)),
-          m_IsCompleted(other.m_IsCompleted.load())
+    Jobs::FiberPoolStatistics Jobs::GetFiberPoolStatistics()
     {
+        return Internal::Job::s_Instance->GetFiberPoolStatistics();
     }
 
-    Internal::JobScheduler::WaitingContext::WaitingContext(BeeEngine::Ref<BeeEngine::Internal::Fiber>&& fiber,
-                                                           Jobs::ConditionType cond)
-        : fiber(BeeMove(fiber)), condition(BeeMove(cond))
+    Jobs::JobSystemStatistics Jobs::GetJobSystemStatistics()
     {
+        return Internal::Job::s_Instance->GetStatistics();
     }
 
-    Internal::JobScheduler::WaitingContext::WaitingContext(const BeeEngine::Ref<BeeEngine::Internal::Fiber>& fiber,
-                                                           Jobs::ConditionType cond)
-        : fiber(fiber), condition(BeeMove(cond))
+    uint32_t Jobs::GetNumberOfWorkers()
     {
+        return Internal::Job::s_Instance->GetNumberOfWorkers();
+    }
+
+    Jobs::JobArenaStatistics Jobs::GetJobArenaStatistics()
+    {
+        return Internal::JobArena::Get().GetStatistics();
+    }
+
+    void Internal::Job::Shutdown()
+    {
+        delete Internal::Job::s_Instance;
+        Internal::Job::s_Instance = nullptr;
     }
 
     Internal::JobScheduler::JobScheduler(uint32_t numberOfThreads)
     {
+        numberOfThreads = std::max(numberOfThreads, 1u);
+        m_Workers.reserve(numberOfThreads);
         for (uint32_t i = 0; i < numberOfThreads; ++i)
         {
-            auto& thread = m_Threads.emplace_back([this] { WorkerThread(); });
+            auto& worker = m_Workers.emplace_back(CreateScope<Worker>());
+            worker->Owner = this;
+            worker->Index = i;
+            worker->RandomState = 0x9E3779B9u * (i + 1);
+        }
+        for (uint32_t i = 0; i < numberOfThreads; ++i)
+        {
+            auto& thread = m_Threads.emplace_back([this, i] { WorkerThread(i); });
             ThreadSetAffinity(thread, i);
         }
     }
@@ -190,107 +636,110 @@ namespace BeeEngine
     {
         if (counter.IsZero())
         {
+            counter.WaitForRelease();
             return;
         }
         if (!Jobs::this_job::IsInJob())
         {
-            using namespace std::chrono_literals;
-            while (!counter.IsZero())
-            {
-                std::this_thread::sleep_for(10ms);
-            }
+            counter.BlockUntilZero();
+            counter.WaitForRelease();
+            return;
+        }
+        // Worker parks this fiber on the counter after the switch.
+        // The job, that brings the counter to zero, schedules it again
+        GetCurrentFiber()->Suspend(&counter);
+    }
+
+    void Internal::JobScheduler::WaitForJobsToCompleteAndHelp(Jobs::Counter& counter, Jobs::Priority minimalPriority)
+    {
+        if (Jobs::this_job::IsInJob())
+        {
+            WaitForJobsToComplete(counter);
             return;
         }
-        auto currentFiber = GetCurrentFiber();
-        currentFiber->MarkIncomplete();
+        while (!counter.IsZero())
         {
-            std::unique_lock<std::mutex> lock(m_WaitingJobsMutex);
-            m_WaitingJobs.emplace_back(currentFiber, &counter);
+            if (auto* fiber = FindHelpWork(minimalPriority))
+            {
+                RunFiber(fiber);
+                continue;
+            }
+            counter.BlockUntilZero();
+            break;
         }
-        m_ConditionVariable.notify_one();
-        currentFiber->GetContext() = std::move(currentFiber->GetContext().resume());
-        // GetMainContext() = GetMainContext().resume();
+        // Last decrementer may still hold the counter
+        counter.WaitForRelease();
     }
 
-    bool Internal::JobScheduler::GetNextFiber(Ref<BeeEngine::Internal::Fiber>& fiber)
+    void Jobs::Counter::BlockUntilZero()
     {
+        std::unique_lock lock(m_WaitersLock);
+        while (true)
         {
-            std::unique_lock lock(m_WaitingJobsMutex);
-            if (!m_WaitingJobs.empty())
+            const uint32_t value = m_Counter.load(std::memory_order_acquire);
+            if (value == 0)
             {
-                for (auto it = m_WaitingJobs.begin(); it != m_WaitingJobs.end(); ++it)
-                {
-                    auto& f = *it;
-                    bool takeThis = std::visit(
-                        [](auto&& arg) -> bool
-                        {
-                            using T = std::remove_cvref_t<decltype(arg)>;
-                            if constexpr (std::is_same_v<Jobs::Counter*, T>)
-                            {
-                                if (!arg || arg->IsZero())
-                                {
-                                    return true;
-                                }
-                            }
-                            else if constexpr (std::is_same_v<std::chrono::high_resolution_clock::time_point, T>)
-                            {
-                                auto now = std::chrono::high_resolution_clock::now();
-                                if (now >= arg)
-                                {
-                                    return true;
-                                }
-                            }
-                            else
-                            {
-                                BeeEnsures(false);
-                                std::unreachable();
-                            }
-
-                            return false;
-                        },
-                        f.condition);
-
-                    if (takeThis)
-                    {
-                        fiber = std::move(f.fiber);
-                        it = m_WaitingJobs.erase(it);
-                        return true;
-                    }
-                }
+                return;
             }
+            ++m_BlockedThreads;
+            lock.unlock();
+            // Returns immediately, if the value has already changed
+            m_Counter.wait(value, std::memory_order_acquire);
+            lock.lock();
+            --m_BlockedThreads;
         }
+    }
+
+    void Jobs::Counter::Decrement()
+    {
+        uint32_t value = m_Counter.load(std::memory_order_relaxed);
+        while (value > 1)
         {
-            // std::unique_lock lock(m_QueueMutex);
-            if (!m_HighPriorityJobs.empty())
+            if (m_Counter.compare_exchange_weak(value, value - 1, std::memory_order_acq_rel, std::memory_order_relaxed))
             {
-                fiber = PopJob(m_HighPriorityJobs);
-                return true;
+                return;
             }
-            if (!m_MediumPriorityJobs.empty())
+        }
+        Internal::Fiber* waiters = nullptr;
+        {
+            // Counter becomes zero only under the lock, so waiters can't destroy it while we use it
+            std::unique_lock lock(m_WaitersLock);
+            if (m_Counter.fetch_sub(1, std::memory_order_acq_rel) != 1)
             {
-                fiber = PopJob(m_MediumPriorityJobs);
-                return true;
+                return;
             }
-            if (!m_LowPriorityJobs.empty())
+            waiters = std::exchange(m_Waiters, nullptr);
+            if (m_BlockedThreads > 0)
             {
-                fiber = PopJob(m_LowPriorityJobs);
-                return true;
+                m_Counter.notify_all();
             }
         }
-        return false;
+        // The counter may be already destroyed here
+        while (waiters)
+        {
+            auto* next = waiters->GetNextWaiter();
+            waiters->SetNextWaiter(nullptr);
+            Internal::Job::s_Instance->MakeReady(waiters);
+            waiters = next;
+        }
     }
 
-    void Jobs::this_job::yield()
+    bool Jobs::Counter::AddWaiter(Internal::Fiber* fiber)
     {
-        BeeExpects(IsInJob());
-        auto ptr = Internal::Job::s_Instance->GetCurrentFiber();
-        auto& context = ptr->GetContext();
+        std::unique_lock lock(m_WaitersLock);
+        if (m_Counter.load(std::memory_order_acquire) == 0)
         {
-            auto* counter = ptr->GetJob().Counter;
-            std::unique_lock lock(Internal::Job::s_Instance->m_WaitingJobsMutex);
-            Internal::Job::s_Instance->m_WaitingJobs.emplace_back(std::move(ptr), counter);
+            return false;
         }
-        context = std::move(context.resume());
+        fiber->SetNextWaiter(m_Waiters);
+        m_Waiters = fiber;
+        return true;
+    }
+
+    void Jobs::this_job::yield()
+    {
+        BeeExpects(IsInJob());
+        Internal::Job::s_Instance->GetCurrentFiber()->Suspend(Internal::Fiber::State::Yielded);
     }
     bool Jobs::this_job::IsInJob()
     {
@@ -315,19 +764,19 @@ namespace BeeEngine
         return reinterpret_cast<uintptr_t>(Internal::Job::s_Instance->GetCurrentFiber()->GetStackBottom()) -
                reinterpret_cast<uintptr_t>(&test) - static_cast<uintptr_t>(1);
     }
+    uint32_t Jobs::this_job::GetWorkerIndex()
+    {
+        BeeExpects(IsInJob());
+        auto* worker = Internal::Job::s_Instance->GetCurrentWorker();
+        return worker ? worker->Index : Internal::Job::s_Instance->GetNumberOfWorkers();
+    }
     void Jobs::this_job::SleepFor(Time::millisecondsD time)
     {
         using std::chrono::high_resolution_clock;
         using std::chrono::time_point_cast;
         BeeExpects(IsInJob());
-        auto ptr = Internal::Job::s_Instance->GetCurrentFiber();
-        auto& context = ptr->GetContext();
-        {
-            std::unique_lock lock(Internal::Job::s_Instance->m_WaitingJobsMutex);
-            Internal::Job::s_Instance->m_WaitingJobs.emplace_back(
-                std::move(ptr), time_point_cast<high_resolution_clock::duration>(high_resolution_clock::now() + time));
-        }
-        context = std::move(context.resume());
+        Internal::Job::s_Instance->GetCurrentFiber()->Suspend(
+            time_point_cast<high_resolution_clock::duration>(high_resolution_clock::now() + time));
     }
 
 } // namespace BeeEngine
@@ -5,6 +5,10 @@
 #pragma once
 #include "Core/Time.h"
 #include "Hardware.h"
+#include "JobSystem/FiberPool.h"
+#include "JobSystem/JobArena.h"
+#include "JobSystem/JobStatistics.h"
+#include "JobSystem/SpinLock.h"
 #include <Core/Move.h>
 #include <array>
 #include <atomic>
@@ -13,15 +17,23 @@
 #include <cstddef>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <new>
 #include <ranges>
 #include <span>
 #include <thread>
+#include <type_traits>
 #include <utility>
 #include <variant>
 #include <vector>
 
 namespace BeeEngine
 {
+    namespace Internal
+    {
+        class Fiber;
+        class JobScheduler;
+    } // namespace Internal
     namespace Jobs
     {
         using ID = uint32_t;
@@ -69,21 +81,56 @@ namespace BeeEngine
              * @retval false The current code is not executing within a job.
              */
             bool IsInJob();
+            /**
+             * @brief Returns index of the worker thread, that runs the current job.
+             * Jobs, that are run by a thread helping in WaitForJobsToCompleteAndHelp,
+             * get Jobs::GetNumberOfWorkers(). The index may change after the job is suspended.
+             * Must be called only in a job
+             * @return uint32_t in range [0, Jobs::GetNumberOfWorkers()]
+             */
+            uint32_t GetWorkerIndex();
         }; // namespace this_job
 
+        /**
+         * @brief Counts unfinished jobs. Fibers, that wait for the counter,
+         * are parked on the counter itself and are scheduled again
+         * by the job, that brings the counter to zero.
+         */
         class Counter
         {
+            friend class ::BeeEngine::Internal::JobScheduler;
+
         public:
-            void Increment() { ++m_Counter; }
+            Counter() = default;
+            Counter(const Counter&) = delete;
+            Counter& operator=(const Counter&) = delete;
 
-            void Decrement() { --m_Counter; }
+            void Increment() { m_Counter.fetch_add(1, std::memory_order_relaxed); }
 
-            bool IsZero() const { return m_Counter == 0; }
+            void Decrement();
+
+            bool IsZero() const { return m_Counter.load(std::memory_order_acquire) == 0; }
 
         private:
+            // Returns false if the counter is already zero and the fiber must not be parked
+            bool AddWaiter(Internal::Fiber* fiber);
+            // Waits until a concurrent Decrement, that brought the counter to zero,
+            // stops touching this object, so it can be safely destroyed
+            void WaitForRelease() { std::unique_lock lock(m_WaitersLock); }
+            // Blocks the calling thread (not fiber) on the counter using atomic wait/notify
+            void BlockUntilZero();
+
             std::atomic<uint32_t> m_Counter = 0;
+            Jobs::SpinLock m_WaitersLock;
+            Internal::Fiber* m_Waiters = nullptr;
+            // Threads, that are blocked in BlockUntilZero. Guarded by m_WaitersLock
+            uint32_t m_BlockedThreads = 0;
         };
-        using ConditionType = std::variant<::BeeEngine::Jobs::Counter*, std::chrono::high_resolution_clock::time_point>;
+        // Counter: wait until it reaches zero. time_point: sleep until it passes.
+        // SpinLock: the job is already in a wait list guarded by this lock, the lock is released after the switch
+        using ConditionType = std::variant<::BeeEngine::Jobs::Counter*,
+                                           std::chrono::high_resolution_clock::time_point,
+                                           ::BeeEngine::Jobs::SpinLock*>;
         enum class Priority
         {
             Low,
@@ -93,7 +140,6 @@ namespace BeeEngine
     } // namespace Jobs
     namespace Internal
     {
-        class JobScheduler;
         struct Job
         {
             static void Initialize(uint32_t numberOfThreads = Hardware::GetNumberOfCores());
@@ -174,21 +220,103 @@ namespace BeeEngine
 
     namespace Internal
     {
+        /**
+         * @brief Type erased job, that is owned by a fiber.
+         *
+         * Callables up to InlineStorageSize bytes are stored inside the wrapper itself,
+         * bigger ones are placed in JobArena. Together with pooled fibers this makes
+         * scheduling of a typical job free of heap allocations.
+         */
         struct JobWrapper
         {
-            JobWrapper(std::function<void()>&& functionToCallJob,
+            static constexpr size_t InlineStorageSize = 128;
+
+            template <typename F>
+                requires(!std::same_as<std::remove_cvref_t<F>, JobWrapper> && std::invocable<std::decay_t<F>&>)
+            JobWrapper(F&& functionToCallJob,
                        BeeEngine::Jobs::Priority priority,
                        size_t stackSize,
                        Jobs::Counter* counter)
-                : Counter(counter),
-                  FunctionToCallJob(std::move(functionToCallJob)),
-                  Priority(priority),
-                  StackSize(stackSize){};
+                : Counter(counter), Priority(priority), StackSize(stackSize)
+            {
+                using Function = std::decay_t<F>;
+                if constexpr (FitsInline<Function>())
+                {
+                    new (m_Storage) Function(std::forward<F>(functionToCallJob));
+                    m_Operations = &s_InlineOperations<Function>;
+                }
+                else
+                {
+                    void* memory = JobArena::Get().Allocate(sizeof(Function), alignof(Function));
+                    *reinterpret_cast<Function**>(m_Storage) = new (memory) Function(std::forward<F>(functionToCallJob));
+                    m_Operations = &s_ArenaOperations<Function>;
+                }
+            }
+            JobWrapper(JobWrapper&& other) noexcept
+                : Counter(other.Counter),
+                  Priority(other.Priority),
+                  StackSize(other.StackSize),
+                  m_Operations(std::exchange(other.m_Operations, nullptr))
+            {
+                if (m_Operations)
+                {
+                    m_Operations->Move(m_Storage, other.m_Storage);
+                }
+            }
+            JobWrapper(const JobWrapper&) = delete;
+            JobWrapper& operator=(const JobWrapper&) = delete;
+            JobWrapper& operator=(JobWrapper&&) = delete;
+            ~JobWrapper()
+            {
+                if (m_Operations)
+                {
+                    m_Operations->Destroy(m_Storage);
+                }
+            }
             Jobs::Counter* Counter;
-            const std::function<void()> FunctionToCallJob;
             BeeEngine::Jobs::Priority Priority;
             size_t StackSize;
-            void operator()() { FunctionToCallJob(); }
+            void operator()() { m_Operations->Invoke(m_Storage); }
+
+            template <typename F>
+            static constexpr bool FitsInline()
+            {
+                return sizeof(F) <= InlineStorageSize && alignof(F) <= alignof(std::max_align_t) &&
+                       std::is_nothrow_move_constructible_v<F>;
+            }
+
+        private:
+            struct Operations
+            {
+                void (*Invoke)(void* storage);
+                // Moves the callable from source to destination and destroys the source
+                void (*Move)(void* destination, void* source) noexcept;
+                void (*Destroy)(void* storage) noexcept;
+            };
+            template <typename F>
+            static constexpr Operations s_InlineOperations = {
+                [](void* storage) { std::invoke(*static_cast<F*>(storage)); },
+                [](void* destination, void* source) noexcept
+                {
+                    new (destination) F(BeeMoveAlways(*static_cast<F*>(source)));
+                    static_cast<F*>(source)->~F();
+                },
+                [](void* storage) noexcept { static_cast<F*>(storage)->~F(); }};
+            // Storage holds only a pointer to the callable in JobArena
+            template <typename F>
+            static constexpr Operations s_ArenaOperations = {
+                [](void* storage) { std::invoke(**static_cast<F**>(storage)); },
+                [](void* destination, void* source) noexcept
+                { *static_cast<F**>(destination) = *static_cast<F**>(source); },
+                [](void* storage) noexcept
+                {
+                    F* function = *static_cast<F**>(storage);
+                    function->~F();
+                    JobArena::Get().Deallocate(function, sizeof(F), alignof(F));
+                }};
+
+            const Operations* m_Operations = nullptr;
+            alignas(std::max_align_t) std::byte m_Storage[InlineStorageSize];
         };
 
         JobWrapper WrapJob(auto&& job)
@@ -227,7 +355,7 @@ namespace BeeEngine
             {
                 jobWrappers.emplace_back(Internal::WrapJob(std::move(job)));
             }
-            Internal::ScheduleAll(jobWrappers);
+            Internal::ScheduleAll(BeeMove(jobWrappers));
         }
         /**
          * @brief Waits for all jobs associated with the given counter to complete.
@@ -245,6 +373,40 @@ namespace BeeEngine
          *       a deadlock may occur. It is recommended to avoid such circular dependencies.
          */
         void WaitForJobsToComplete(Jobs::Counter& counter);
+        /**
+         * @brief Waits for all jobs associated with the given counter to complete.
+         * If in a job, behaves exactly like WaitForJobsToComplete.
+         * If not in a job, the calling thread runs queued jobs with at least
+         * the given priority while it waits, and blocks on the counter, when there are none.
+         *
+         * @param counter A valid reference to the Jobs::Counter object associated with the jobs to wait for.
+         * @param minimalPriority Lowest priority of jobs, that the calling thread is allowed to run.
+         *
+         * @return void
+         *
+         * @note Long running jobs (e.g. file watchers) must not be scheduled with the helped
+         *       priority, otherwise the waiting thread can be stuck in them long after the counter reached zero.
+         */
+        void WaitForJobsToCompleteAndHelp(Jobs::Counter& counter, Jobs::Priority minimalPriority = Priority::High);
+        /**
+         * @brief Returns allocation counters of the fiber and stack pool
+         * of the job system. Useful to tune pool limits.
+         */
+        FiberPoolStatistics GetFiberPoolStatistics();
+        /**
+         * @brief Returns allocation counters of the arena, that stores
+         * job callables too big for the inline buffer of a job.
+         */
+        JobArenaStatistics GetJobArenaStatistics();
+        /**
+         * @brief Returns telemetry counters of every worker and current queue depths.
+         * Use Jobs::JobStatisticsSampler to get per frame values.
+         */
+        JobSystemStatistics GetJobSystemStatistics();
+        /**
+         * @brief Returns number of worker threads of the job system
+         */
+        uint32_t GetNumberOfWorkers();
         constexpr size_t DefaultStackSize = 1024 * 64; // in bytes
 
         template <typename F, typename... Args>
@@ -287,8 +449,20 @@ namespace BeeEngine
             std::size_t ElementIndex;
             std::size_t PackIndex;
         };
+    } // namespace Jobs
+    namespace Internal
+    {
+        template <typename F, typename... Args>
+        constexpr auto CreateJob(Jobs::Counter* counter, F&& func, Args&&... args)
+        {
+            return Jobs::Job<F, Args...>(counter,
+                                         Jobs::Priority::Normal,
+                                         Jobs::DefaultStackSize,
+                                         std::forward<F>(func),
+                                         std::forward<Args>(args)...);
+        }
         template <typename Func, typename... Args>
-        constexpr auto ForEach(std::ranges::range auto&& container, Jobs::Counter& counter, Func&& func, Args&&... args)
+        constexpr void ForEach(std::ranges::range auto&& container, Jobs::Counter* counter, Func&& func, Args&&... args)
         {
             size_t maxNumber = container.size();
             if (maxNumber == 0)
@@ -309,11 +483,11 @@ namespace BeeEngine
                         for (size_t i = start; i < end; ++i)
                         {
                             if constexpr (requires {
-                                              func(container[i], std::declval<Indices>(), std::forward<Args>(args)...);
+                                              func(container[i], std::declval<Jobs::Indices>(), std::forward<Args>(args)...);
                                           })
                             {
                                 func(container[i],
-                                     Indices{.ElementIndex = i, .PackIndex = core},
+                                     Jobs::Indices{.ElementIndex = i, .PackIndex = core},
                                      std::forward<Args>(args)...);
                             }
                             else if constexpr (requires { func(container[i], std::forward<Args>(args)...); })
@@ -328,17 +502,28 @@ namespace BeeEngine
                     },
                     func,
                     args...);
-                Schedule(BeeMove(job));
+                Jobs::Schedule(BeeMove(job));
                 start = end;
             }
         }
+    } // namespace Internal
+    namespace Jobs
+    {
+        /**
+         * @brief Splits the container into GetNumberOfCores() equal parts and
+         * schedules one job per part. PackIndex of Jobs::Indices is the index of the part,
+         * so it can be used to index per thread buffers.
+         * For grain size control and reductions see JobSystem/ParallelAlgorithms.h
+         */
+        template <typename Func, typename... Args>
+        constexpr auto ForEach(std::ranges::range auto&& container, Jobs::Counter& counter, Func&& func, Args&&... args)
+        {
+            return Internal::ForEach(container, &counter, std::forward<Func>(func), std::forward<Args>(args)...);
+        }
         template <typename Func, typename... Args>
         constexpr auto ForEach(std::ranges::range auto&& container, Func&& func, Args&&... args)
         {
-            return ForEach(container,
-                           *static_cast<Jobs::Counter*>(nullptr),
-                           std::forward<Func>(func),
-                           std::forward<Args>(args)...);
+            return Internal::ForEach(container, nullptr, std::forward<Func>(func), std::forward<Args>(args)...);
         }
     } // namespace Jobs
 
@@ -0,0 +1,71 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#include "JobStatistics.h"
+#include "JobScheduler.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace BeeEngine::Jobs
+{
+    static JobSystemFrameStatistics::Worker
+    Difference(const WorkerStatistics& current, const WorkerStatistics& previous, double frameTime)
+    {
+        JobSystemFrameStatistics::Worker worker;
+        const double frameNanoseconds = frameTime * 1e9;
+        if (frameNanoseconds > 0.0)
+        {
+            worker.Utilization =
+                std::clamp(static_cast<double>(current.BusyTime - previous.BusyTime) / frameNanoseconds, 0.0, 1.0);
+            worker.Idle =
+                std::clamp(static_cast<double>(current.IdleTime - previous.IdleTime) / frameNanoseconds, 0.0, 1.0);
+        }
+        worker.JobsCompleted = current.JobsCompleted - previous.JobsCompleted;
+        worker.Resumes = current.Resumes - previous.Resumes;
+        worker.Yields = current.Yields - previous.Yields;
+        worker.Waits = current.Waits - previous.Waits;
+        worker.Steals = current.Steals - previous.Steals;
+        return worker;
+    }
+
+    void JobStatisticsSampler::Sample()
+    {
+        const auto now = std::chrono::steady_clock::now();
+        m_Current = GetJobSystemStatistics();
+        if (!m_HasPrevious || m_Previous.Workers.size() != m_Current.Workers.size())
+        {
+            // First sample only establishes the baseline
+            m_Previous = BeeMove(m_Current);
+            m_PreviousTime = now;
+            m_HasPrevious = true;
+            return;
+        }
+        const double frameTime = std::chrono::duration<double>(now - m_PreviousTime).count();
+        m_LastFrame.FrameTime = frameTime;
+        m_LastFrame.Workers.resize(m_Current.Workers.size());
+        m_LastFrame.JobsCompleted = 0;
+        double utilization = 0.0;
+        for (size_t i = 0; i < m_Current.Workers.size(); ++i)
+        {
+            m_LastFrame.Workers[i] = Difference(m_Current.Workers[i], m_Previous.Workers[i], frameTime);
+            m_LastFrame.JobsCompleted += m_LastFrame.Workers[i].JobsCompleted;
+            utilization += m_LastFrame.Workers[i].Utilization;
+        }
+        m_LastFrame.Helpers = Difference(m_Current.Helpers, m_Previous.Helpers, frameTime);
+        m_LastFrame.JobsCompleted += m_LastFrame.Helpers.JobsCompleted;
+        m_LastFrame.AverageUtilization =
+            m_Current.Workers.empty() ? 0.0 : utilization / static_cast<double>(m_Current.Workers.size());
+        m_LastFrame.QueueDepths = m_Current.QueueDepths;
+        m_LastFrame.WaitingJobs = m_Current.WaitingJobs;
+        m_LastFrame.SleepingJobs = m_Current.SleepingJobs;
+        m_LastFrame.SleepingWorkers = m_Current.SleepingWorkers;
+
+        m_UtilizationHistory[m_HistoryOffset] = static_cast<float>(m_LastFrame.AverageUtilization);
+        m_HistoryOffset = (m_HistoryOffset + 1) % HistorySize;
+
+        std::swap(m_Previous, m_Current);
+        m_PreviousTime = now;
+    }
+} // namespace BeeEngine::Jobs
@@ -0,0 +1,106 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#pragma once
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace BeeEngine::Jobs
+{
+    constexpr size_t NumberOfPriorities = 3;
+
+    /**
+     * @brief Cumulative counters of one worker thread since the start of the job system.
+     * Times are in nanoseconds.
+     */
+    struct WorkerStatistics
+    {
+        uint64_t JobsCompleted = 0;
+        // Every time a fiber starts or continues running
+        uint64_t Resumes = 0;
+        uint64_t Yields = 0;
+        // Jobs, that were suspended to wait for a counter or to sleep
+        uint64_t Waits = 0;
+        // Jobs, that were taken from other workers
+        uint64_t Steals = 0;
+        uint64_t BusyTime = 0;
+        uint64_t IdleTime = 0;
+    };
+
+    /**
+     * @brief Snapshot of the whole job system. Counters are cumulative,
+     * queue depths and waiting jobs are current values.
+     */
+    struct JobSystemStatistics
+    {
+        std::vector<WorkerStatistics> Workers;
+        // Jobs, that were run by threads helping in WaitForJobsToCompleteAndHelp
+        WorkerStatistics Helpers;
+        // Indexed by Jobs::Priority. Local queues of all workers and the global queue
+        std::array<uint64_t, NumberOfPriorities> QueueDepths = {};
+        // Jobs, that are parked on Jobs::Counter
+        uint64_t WaitingJobs = 0;
+        // Jobs, that are suspended by this_job::SleepFor
+        uint64_t SleepingJobs = 0;
+        uint32_t SleepingWorkers = 0;
+    };
+
+    /**
+     * @brief Statistics of the job system for one frame
+     */
+    struct JobSystemFrameStatistics
+    {
+        struct Worker
+        {
+            // Part of the frame time, when the worker was running jobs [0, 1]
+            double Utilization = 0.0;
+            // Part of the frame time, when the worker was sleeping [0, 1]
+            double Idle = 0.0;
+            uint64_t JobsCompleted = 0;
+            uint64_t Resumes = 0;
+            uint64_t Yields = 0;
+            uint64_t Waits = 0;
+            uint64_t Steals = 0;
+        };
+        double FrameTime = 0.0; // in seconds
+        double AverageUtilization = 0.0;
+        uint64_t JobsCompleted = 0;
+        std::vector<Worker> Workers;
+        Worker Helpers;
+        std::array<uint64_t, NumberOfPriorities> QueueDepths = {};
+        uint64_t WaitingJobs = 0;
+        uint64_t SleepingJobs = 0;
+        uint32_t SleepingWorkers = 0;
+    };
+
+    /**
+     * @brief Turns cumulative job system counters into per frame values.
+     * Sample must be called once per frame from one thread.
+     */
+    class JobStatisticsSampler
+    {
+    public:
+        static constexpr size_t HistorySize = 120;
+
+        void Sample();
+
+        const JobSystemFrameStatistics& GetLastFrame() const { return m_LastFrame; }
+        // Average utilization of all workers for the last HistorySize frames.
+        // Oldest value is at GetHistoryOffset(), suitable for ImGui::PlotLines
+        const std::array<float, HistorySize>& GetUtilizationHistory() const { return m_UtilizationHistory; }
+        size_t GetHistoryOffset() const { return m_HistoryOffset; }
+
+    private:
+        JobSystemStatistics m_Previous;
+        JobSystemStatistics m_Current;
+        JobSystemFrameStatistics m_LastFrame;
+        std::chrono::steady_clock::time_point m_PreviousTime;
+        bool m_HasPrevious = false;
+        std::array<float, HistorySize> m_UtilizationHistory = {};
+        size_t m_HistoryOffset = 0;
+    };
+} // namespace BeeEngine::Jobs
@@ -4,31 +4,43 @@
 
 #pragma once
 #include "JobScheduler.h"
-#include <atomic>
+#include "JobSystem/SpinLock.h"
+#include "JobSystem/WaitList.h"
+#include <mutex>
 namespace BeeEngine::Jobs
 {
     /**
      * @brief A class representing a mutex for synchronization in a jobs environment.
      *
      * This class provides methods for acquiring and releasing ownership of the mutex.
-     * It uses atomic operations to ensure thread safety.
+     * Jobs, that wait for the mutex, are parked on it and don't use CPU.
+     * Threads, that are not running a job, are blocked.
+     * Unlock hands the ownership directly to the next waiter in FIFO order.
      */
     class Mutex
     {
     public:
+        Mutex() = default;
+        Mutex(const Mutex&) = delete;
+        Mutex& operator=(const Mutex&) = delete;
+
         /**
          * @brief Acquires ownership of the mutex.
          *
          * This tries to acquire ownership of the mutex. If the mutex
-         * is already owned, this function yields the current job.
-         * Meantime other jobs will be scheduled to run.
+         * is already owned, the current job is suspended until it is its turn
+         * to own the mutex. Meantime other jobs will be scheduled to run.
          */
         void lock()
         {
-            while (flag.test_and_set(std::memory_order_acquire))
+            std::unique_lock lock(m_Lock);
+            if (!m_Locked)
             {
-                this_job::yield();
+                m_Locked = true;
+                return;
             }
+            // Ownership is handed over by unlock
+            m_Waiters.Wait(lock);
         }
 
         /**
@@ -38,7 +50,15 @@ namespace BeeEngine::Jobs
          * It is assumed that the calling job currently owns the mutex.
          * If not, behavior is undefined
          */
-        void unlock() { flag.clear(std::memory_order_release); }
+        void unlock()
+        {
+            Internal::Wakeups wakeups;
+            std::unique_lock lock(m_Lock);
+            if (!m_Waiters.WakeOne(wakeups))
+            {
+                m_Locked = false;
+            }
+        }
 
         /**
          * @brief Attempts to acquire ownership of the mutex without blocking.
@@ -49,9 +69,232 @@ namespace BeeEngine::Jobs
          *
          * @return true if the mutex was successfully acquired, false otherwise.
          */
-        [[nodiscard]] bool try_lock() { return !flag.test_and_set(std::memory_order_acquire); }
+        [[nodiscard]] bool try_lock()
+        {
+            std::unique_lock lock(m_Lock);
+            if (m_Locked)
+            {
+                return false;
+            }
+            m_Locked = true;
+            return true;
+        }
+
+    private:
+        Jobs::SpinLock m_Lock;
+        bool m_Locked = false;
+        Internal::WaitList m_Waiters;
+    };
+
+    /**
+     * @brief Reader-writer lock for jobs. Many readers or one writer can own it at the same time.
+     *
+     * New readers don't overtake waiting writers, and a writer, that releases the lock,
+     * lets all waiting readers in before the next writer, so neither side can starve.
+     * Compatible with std::shared_lock and std::unique_lock.
+     */
+    class RWLock
+    {
+    public:
+        RWLock() = default;
+        RWLock(const RWLock&) = delete;
+        RWLock& operator=(const RWLock&) = delete;
+
+        void lock()
+        {
+            std::unique_lock lock(m_Lock);
+            if (!m_Writer && m_Readers == 0)
+            {
+                m_Writer = true;
+                return;
+            }
+            m_WaitingWriters.Wait(lock);
+        }
+
+        void unlock()
+        {
+            Internal::Wakeups wakeups;
+            std::unique_lock lock(m_Lock);
+            if (!m_WaitingReaders.Empty())
+            {
+                m_Writer = false;
+                m_Readers += m_WaitingReaders.WakeAll(wakeups);
+                return;
+            }
+            if (!m_WaitingWriters.WakeOne(wakeups))
+            {
+                m_Writer = false;
+            }
+        }
+
+        [[nodiscard]] bool try_lock()
+        {
+            std::unique_lock lock(m_Lock);
+            if (m_Writer || m_Readers > 0)
+            {
+                return false;
+            }
+            m_Writer = true;
+            return true;
+        }
+
+        void lock_shared()
+        {
+            std::unique_lock lock(m_Lock);
+            if (!m_Writer && m_WaitingWriters.Empty())
+            {
+                ++m_Readers;
+                return;
+            }
+            // Reader count is incremented by the writer, that wakes us
+            m_WaitingReaders.Wait(lock);
+        }
+
+        void unlock_shared()
+        {
+            Internal::Wakeups wakeups;
+            std::unique_lock lock(m_Lock);
+            if (--m_Readers == 0 && m_WaitingWriters.WakeOne(wakeups))
+            {
+                m_Writer = true;
+            }
+        }
+
+        [[nodiscard]] bool try_lock_shared()
+        {
+            std::unique_lock lock(m_Lock);
+            if (m_Writer || !m_WaitingWriters.Empty())
+            {
+                return false;
+            }
+            ++m_Readers;
+            return true;
+        }
+
+    private:
+        Jobs::SpinLock m_Lock;
+        size_t m_Readers = 0;
+        bool m_Writer = false;
+        Internal::WaitList m_WaitingReaders;
+        Internal::WaitList m_WaitingWriters;
+    };
+
+    /**
+     * @brief Counting semaphore for jobs. Acquire parks the job, while there are no permits.
+     * Release hands the permits directly to the waiters in FIFO order.
+     */
+    class Semaphore
+    {
+    public:
+        explicit Semaphore(size_t initialCount = 0) : m_Count(initialCount) {}
+        Semaphore(const Semaphore&) = delete;
+        Semaphore& operator=(const Semaphore&) = delete;
+
+        void acquire()
+        {
+            std::unique_lock lock(m_Lock);
+            if (m_Count > 0)
+            {
+                --m_Count;
+                return;
+            }
+            m_Waiters.Wait(lock);
+        }
+
+        [[nodiscard]] bool try_acquire()
+        {
+            std::unique_lock lock(m_Lock);
+            if (m_Count == 0)
+            {
+                return false;
+            }
+            --m_Count;
+            return true;
+        }
+
+        void release(size_t count = 1)
+        {
+            Internal::Wakeups wakeups;
+            std::unique_lock lock(m_Lock);
+            for (; count > 0 && m_Waiters.WakeOne(wakeups); --count)
+            {
+            }
+            m_Count += count;
+        }
+
+    private:
+        Jobs::SpinLock m_Lock;
+        size_t m_Count;
+        Internal::WaitList m_Waiters;
+    };
+
+    /**
+     * @brief Event for jobs. Jobs, that wait for the event, are parked until it is set.
+     *
+     * Manual reset event stays set and releases every waiter until Reset is called.
+     * Auto reset event releases exactly one waiter per Set and resets itself.
+     */
+    class Event
+    {
+    public:
+        enum class ResetMode
+        {
+            Manual,
+            Auto
+        };
+        explicit Event(ResetMode mode = ResetMode::Manual, bool initiallySet = false)
+            : m_Mode(mode), m_Set(initiallySet)
+        {
+        }
+        Event(const Event&) = delete;
+        Event& operator=(const Event&) = delete;
+
+        void Wait()
+        {
+            std::unique_lock lock(m_Lock);
+            if (m_Set)
+            {
+                if (m_Mode == ResetMode::Auto)
+                {
+                    m_Set = false;
+                }
+                return;
+            }
+            m_Waiters.Wait(lock);
+        }
+
+        void Set()
+        {
+            Internal::Wakeups wakeups;
+            std::unique_lock lock(m_Lock);
+            if (m_Mode == ResetMode::Manual)
+            {
+                m_Set = true;
+                m_Waiters.WakeAll(wakeups);
+                return;
+            }
+            if (!m_Waiters.WakeOne(wakeups))
+            {
+                m_Set = true;
+            }
+        }
+
+        void Reset()
+        {
+            std::unique_lock lock(m_Lock);
+            m_Set = false;
+        }
+
+        [[nodiscard]] bool IsSet() const
+        {
+            std::unique_lock lock(m_Lock);
+            return m_Set;
+        }
 
     private:
-        std::atomic_flag flag = {};
+        mutable Jobs::SpinLock m_Lock;
+        const ResetMode m_Mode;
+        bool m_Set;
+        Internal::WaitList m_Waiters;
     };
-} // namespace BeeEngine::Jobs
\ No newline at end of file
+} // namespace BeeEngine::Jobs
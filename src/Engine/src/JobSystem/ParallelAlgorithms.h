@@ -0,0 +1,356 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#pragma once
+#include "JobSystem/JobScheduler.h"
+#include "JobSystem/SpinLock.h"
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+namespace BeeEngine::Jobs
+{
+    /**
+     * @brief Controls how data parallel algorithms split their work.
+     */
+    struct ParallelOptions
+    {
+        // Maximal number of elements, that are processed by one job without splitting.
+        // 0 means, that the grain size is chosen automatically
+        size_t GrainSize = 0;
+        Jobs::Priority Priority = Jobs::Priority::Normal;
+        size_t StackSize = DefaultStackSize;
+    };
+} // namespace BeeEngine::Jobs
+
+namespace BeeEngine::Internal
+{
+    // Around 8 chunks per worker are enough to balance uneven work without too much scheduling overhead
+    inline size_t ChooseGrainSize(size_t count, size_t grainSize)
+    {
+        if (grainSize > 0)
+        {
+            return grainSize;
+        }
+        const size_t chunks = static_cast<size_t>(Jobs::GetNumberOfWorkers()) * 8;
+        return std::max<size_t>(1, count / chunks);
+    }
+
+    // Runs function in a job. Outside of jobs blocks until it is finished
+    template <typename Func>
+    void RunInJob(const Jobs::ParallelOptions& options, Func&& func)
+    {
+        if (Jobs::this_job::IsInJob())
+        {
+            func();
+            return;
+        }
+        Jobs::Counter counter;
+        Jobs::Schedule(Jobs::CreateJob(counter, options.Priority, options.StackSize, [&func]() { func(); }));
+        Jobs::WaitForJobsToComplete(counter);
+    }
+
+    // Runs both functions in parallel and returns, when they are finished. Must be called in a job
+    template <typename Left, typename Right>
+    void ParallelInvoke(const Jobs::ParallelOptions& options, Left&& left, Right&& right)
+    {
+        Jobs::Counter counter;
+        Jobs::Schedule(Jobs::CreateJob(counter, options.Priority, options.StackSize, [&right]() { right(); }));
+        left();
+        Jobs::WaitForJobsToComplete(counter);
+    }
+
+    /**
+     * Lazy binary splitting: the job keeps the left half of its range and
+     * schedules the right half, until the range is not bigger than grain size.
+     * Right halves are the first to be stolen, so idle workers take the biggest pieces.
+     */
+    template <typename Body>
+    void ParallelForSplit(size_t begin,
+                          size_t end,
+                          size_t grainSize,
+                          const Jobs::ParallelOptions& options,
+                          Jobs::Counter& counter,
+                          Body& body)
+    {
+        while (end - begin > grainSize)
+        {
+            const size_t middle = begin + (end - begin) / 2;
+            Jobs::Schedule(Jobs::CreateJob(counter,
+                                           options.Priority,
+                                           options.StackSize,
+                                           [middle, end, grainSize, &options, &counter, &body]()
+                                           { ParallelForSplit(middle, end, grainSize, options, counter, body); }));
+            end = middle;
+        }
+        body(begin, end);
+    }
+
+    template <typename Iterator, typename Compare>
+    void ParallelMerge(Iterator firstBegin,
+                       Iterator firstEnd,
+                       Iterator secondBegin,
+                       Iterator secondEnd,
+                       auto output,
+                       Compare& compare,
+                       size_t grainSize,
+                       const Jobs::ParallelOptions& options)
+    {
+        const auto firstSize = static_cast<size_t>(firstEnd - firstBegin);
+        const auto secondSize = static_cast<size_t>(secondEnd - secondBegin);
+        if (firstSize + secondSize <= grainSize)
+        {
+            std::merge(std::make_move_iterator(firstBegin),
+                       std::make_move_iterator(firstEnd),
+                       std::make_move_iterator(secondBegin),
+                       std::make_move_iterator(secondEnd),
+                       output,
+                       compare);
+            return;
+        }
+        if (firstSize < secondSize)
+        {
+            // Always split the bigger sequence, so both halves shrink
+            ParallelMerge(secondBegin, secondEnd, firstBegin, firstEnd, output, compare, grainSize, options);
+            return;
+        }
+        auto firstMiddle = firstBegin + firstSize / 2;
+        auto secondMiddle = std::lower_bound(secondBegin, secondEnd, *firstMiddle, compare);
+        auto outputMiddle = output + (firstMiddle - firstBegin) + (secondMiddle - secondBegin);
+        *outputMiddle = std::move(*firstMiddle);
+        ParallelInvoke(
+            options,
+            [&]() { ParallelMerge(firstBegin, firstMiddle, secondBegin, secondMiddle, output, compare, grainSize, options); },
+            [&]()
+            {
+                ParallelMerge(
+                    firstMiddle + 1, firstEnd, secondMiddle, secondEnd, outputMiddle + 1, compare, grainSize, options);
+            });
+    }
+
+    template <typename Iterator, typename Buffer, typename Compare>
+    void ParallelMergeSort(Iterator begin,
+                           Iterator end,
+                           Buffer buffer,
+                           Compare& compare,
+                           size_t grainSize,
+                           const Jobs::ParallelOptions& options)
+    {
+        const auto size = static_cast<size_t>(end - begin);
+        if (size <= grainSize)
+        {
+            std::sort(begin, end, compare);
+            return;
+        }
+        const auto middle = begin + size / 2;
+        const auto bufferMiddle = buffer + size / 2;
+        ParallelInvoke(
+            options,
+            [&]() { ParallelMergeSort(begin, middle, buffer, compare, grainSize, options); },
+            [&]() { ParallelMergeSort(middle, end, bufferMiddle, compare, grainSize, options); });
+        // Both halves are merged into the buffer and then moved back, because a merge
+        // can't write into the range, that other merge jobs are still reading
+        ParallelMerge(begin, middle, middle, end, buffer, compare, grainSize, options);
+        Jobs::Counter counter;
+        auto moveBack = [begin, buffer](size_t first, size_t last)
+        { std::move(buffer + first, buffer + last, begin + first); };
+        ParallelForSplit(0, size, grainSize, options, counter, moveBack);
+        Jobs::WaitForJobsToComplete(counter);
+    }
+} // namespace BeeEngine::Internal
+
+namespace BeeEngine::Jobs
+{
+    /**
+     * @brief Calls body for every index in [begin, end) using the job system
+     * and returns, when all calls are finished.
+     *
+     * The range is split recursively until pieces are not bigger than the grain size.
+     * Body is either called per index with (size_t index) or per piece with (size_t begin, size_t end).
+     * Can be called both in and outside of jobs.
+     */
+    template <typename Body>
+        requires std::invocable<Body&, size_t> || std::invocable<Body&, size_t, size_t>
+    void ParallelFor(size_t begin, size_t end, Body&& body, const ParallelOptions& options = {})
+    {
+        if (begin >= end)
+        {
+            return;
+        }
+        auto rangeBody = [&body](size_t first, size_t last)
+        {
+            if constexpr (std::invocable<Body&, size_t, size_t>)
+            {
+                body(first, last);
+            }
+            else
+            {
+                for (size_t i = first; i < last; ++i)
+                {
+                    body(i);
+                }
+            }
+        };
+        const size_t grainSize = Internal::ChooseGrainSize(end - begin, options.GrainSize);
+        if (end - begin <= grainSize)
+        {
+            rangeBody(begin, end);
+            return;
+        }
+        Internal::RunInJob(options,
+                           [&]()
+                           {
+                               Counter counter;
+                               Internal::ParallelForSplit(begin, end, grainSize, options, counter, rangeBody);
+                               WaitForJobsToComplete(counter);
+                           });
+    }
+
+    /**
+     * @brief Calls body for every element of a random access range in parallel.
+     * Body is called with (element) or (element, size_t index).
+     */
+    template <std::ranges::random_access_range Range, typename Body>
+    void ParallelFor(Range&& range, Body&& body, const ParallelOptions& options = {})
+    {
+        auto first = std::ranges::begin(range);
+        ParallelFor(
+            size_t{0},
+            static_cast<size_t>(std::ranges::size(range)),
+            [first, &body](size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    if constexpr (std::invocable<Body&, decltype(first[i]), size_t>)
+                    {
+                        body(first[i], i);
+                    }
+                    else
+                    {
+                        body(first[i]);
+                    }
+                }
+            },
+            options);
+    }
+
+    /**
+     * @brief Reduces [begin, end) in parallel.
+     *
+     * map(size_t begin, size_t end) returns partial result for a piece of the range.
+     * Partial results are accumulated per worker and then combined into the final result.
+     * combine must be associative and commutative, identity must be its neutral element.
+     */
+    template <typename T, typename Map, typename Combine>
+        requires std::invocable<Map&, size_t, size_t> && std::invocable<Combine&, T, T>
+    T ParallelReduce(size_t begin, size_t end, T identity, Map&& map, Combine&& combine, const ParallelOptions& options = {})
+    {
+        if (begin >= end)
+        {
+            return identity;
+        }
+        const size_t grainSize = Internal::ChooseGrainSize(end - begin, options.GrainSize);
+        if (end - begin <= grainSize)
+        {
+            return combine(BeeMoveAlways(identity), map(begin, end));
+        }
+        // Padded to avoid false sharing between workers
+        struct alignas(64) Partial
+        {
+            T Value;
+        };
+        // The last slot is used by threads, that help in WaitForJobsToCompleteAndHelp. There can be many of them
+        std::vector<Partial> partials(GetNumberOfWorkers() + 1, Partial{identity});
+        SpinLock helpersLock;
+        auto body = [&](size_t first, size_t last)
+        {
+            T value = map(first, last);
+            // Worker index is taken after map, because map may suspend this job
+            const uint32_t index = this_job::GetWorkerIndex();
+            auto& partial = partials[index];
+            if (index + 1 == partials.size())
+            {
+                std::unique_lock lock(helpersLock);
+                partial.Value = combine(BeeMoveAlways(partial.Value), BeeMoveAlways(value));
+                return;
+            }
+            partial.Value = combine(BeeMoveAlways(partial.Value), BeeMoveAlways(value));
+        };
+        Internal::RunInJob(options,
+                           [&]()
+                           {
+                               Counter counter;
+                               Internal::ParallelForSplit(begin, end, grainSize, options, counter, body);
+                               WaitForJobsToComplete(counter);
+                           });
+        T result = BeeMoveAlways(identity);
+        for (auto& partial : partials)
+        {
+            result = combine(BeeMoveAlways(result), BeeMoveAlways(partial.Value));
+        }
+        return result;
+    }
+
+    /**
+     * @brief Reduces elements of a random access range in parallel.
+     * Elements are folded with combine starting from identity.
+     */
+    template <std::ranges::random_access_range Range, typename T, typename Combine = std::plus<>>
+    T ParallelReduce(Range&& range, T identity, Combine&& combine = {}, const ParallelOptions& options = {})
+    {
+        auto first = std::ranges::begin(range);
+        return ParallelReduce(
+            size_t{0},
+            static_cast<size_t>(std::ranges::size(range)),
+            identity,
+            [first, &identity, &combine](size_t begin, size_t end)
+            {
+                T value = identity;
+                for (size_t i = begin; i < end; ++i)
+                {
+                    value = combine(BeeMoveAlways(value), first[i]);
+                }
+                return value;
+            },
+            combine,
+            options);
+    }
+
+    /**
+     * @brief Sorts a random access range in parallel using merge sort with parallel merge.
+     *
+     * Pieces not bigger than the grain size are sorted with std::sort. The sort is not stable.
+     * Needs a temporary buffer of the same size as the range, so elements must be default constructible.
+     */
+    template <std::ranges::random_access_range Range, typename Compare = std::ranges::less>
+        requires std::sortable<std::ranges::iterator_t<Range>, Compare> &&
+                 std::default_initializable<std::ranges::range_value_t<Range>>
+    void ParallelSort(Range&& range, Compare compare = {}, const ParallelOptions& options = {})
+    {
+        const auto size = static_cast<size_t>(std::ranges::size(range));
+        // Sorting is much cheaper per element than usual parallel work, so the pieces are bigger
+        const size_t grainSize = options.GrainSize > 0
+                                     ? options.GrainSize
+                                     : std::max<size_t>(Internal::ChooseGrainSize(size, 0), 2048);
+        auto begin = std::ranges::begin(range);
+        if (size <= grainSize)
+        {
+            std::sort(begin, begin + size, compare);
+            return;
+        }
+        std::vector<std::ranges::range_value_t<Range>> buffer(size);
+        Internal::RunInJob(options,
+                           [&]()
+                           {
+                               Internal::ParallelMergeSort(
+                                   begin, begin + size, buffer.begin(), compare, grainSize, options);
+                           });
+    }
+} // namespace BeeEngine::Jobs
@@ -0,0 +1,88 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#include "WaitList.h"
+#include "Core/CodeSafety/Expects.h"
+#include "InternalJobScheduler.h"
+
+namespace BeeEngine::Internal
+{
+    Wakeups::~Wakeups()
+    {
+        while (m_Fibers)
+        {
+            auto* next = m_Fibers->GetNextWaiter();
+            m_Fibers->SetNextWaiter(nullptr);
+            Job::s_Instance->MakeReady(m_Fibers);
+            m_Fibers = next;
+        }
+    }
+
+    void WaitList::Wait(std::unique_lock<Jobs::SpinLock>& lock)
+    {
+        BeeExpects(lock.owns_lock());
+        Waiter waiter;
+        waiter.WaitingFiber = Jobs::this_job::IsInJob() ? Job::s_Instance->GetCurrentFiber() : nullptr;
+        if (m_Tail)
+        {
+            m_Tail->Next = &waiter;
+        }
+        else
+        {
+            m_Head = &waiter;
+        }
+        m_Tail = &waiter;
+        ++m_Size;
+        if (waiter.WaitingFiber)
+        {
+            // The scheduler releases the lock after the fiber has switched out
+            waiter.WaitingFiber->Suspend(lock.release());
+            return;
+        }
+        lock.unlock();
+        waiter.Woken.wait(0, std::memory_order_acquire);
+        // The waker notifies under the lock, wait until it no longer touches the waiter
+        lock.lock();
+        lock.unlock();
+    }
+
+    void WaitList::Wake(Waiter* waiter, Wakeups& wakeups)
+    {
+        if (waiter->WaitingFiber)
+        {
+            waiter->WaitingFiber->SetNextWaiter(wakeups.m_Fibers);
+            wakeups.m_Fibers = waiter->WaitingFiber;
+            return;
+        }
+        waiter->Woken.store(1, std::memory_order_release);
+        waiter->Woken.notify_one();
+    }
+
+    bool WaitList::WakeOne(Wakeups& wakeups)
+    {
+        auto* waiter = m_Head;
+        if (!waiter)
+        {
+            return false;
+        }
+        m_Head = waiter->Next;
+        if (!m_Head)
+        {
+            m_Tail = nullptr;
+        }
+        --m_Size;
+        Wake(waiter, wakeups);
+        return true;
+    }
+
+    size_t WaitList::WakeAll(Wakeups& wakeups)
+    {
+        size_t woken = 0;
+        while (WakeOne(wakeups))
+        {
+            ++woken;
+        }
+        return woken;
+    }
+} // namespace BeeEngine::Internal
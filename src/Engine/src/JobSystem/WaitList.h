@@ -0,0 +1,80 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#pragma once
+#include "JobSystem/SpinLock.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+namespace BeeEngine::Internal
+{
+    class Fiber;
+    class WaitList;
+
+    /**
+     * @brief Collects jobs, that were woken under a lock, and schedules them,
+     * when it is destroyed. Declare it before the lock, so it is destroyed after the lock is released.
+     */
+    class Wakeups
+    {
+    public:
+        Wakeups() = default;
+        Wakeups(const Wakeups&) = delete;
+        Wakeups& operator=(const Wakeups&) = delete;
+        ~Wakeups();
+
+    private:
+        friend class WaitList;
+        Fiber* m_Fibers = nullptr;
+    };
+
+    /**
+     * @brief FIFO list of jobs and threads, that wait for a synchronization primitive.
+     *
+     * Jobs are parked: the fiber is removed from the scheduler until it is woken.
+     * Threads, that are not running a job, block with atomic wait.
+     * All functions must be called with the lock of the primitive held.
+     */
+    class WaitList
+    {
+    public:
+        WaitList() = default;
+        WaitList(const WaitList&) = delete;
+        WaitList& operator=(const WaitList&) = delete;
+
+        /**
+         * @brief Adds the caller to the end of the list, releases the lock and
+         * suspends the job (or blocks the thread) until it is woken. Returns without the lock.
+         */
+        void Wait(std::unique_lock<Jobs::SpinLock>& lock);
+
+        /**
+         * @brief Wakes the first waiter. Returns false if nobody waits
+         */
+        bool WakeOne(Wakeups& wakeups);
+        /**
+         * @brief Wakes every waiter. Returns the number of woken waiters
+         */
+        size_t WakeAll(Wakeups& wakeups);
+
+        bool Empty() const { return m_Head == nullptr; }
+        size_t Size() const { return m_Size; }
+
+    private:
+        // Lives on the stack of the waiting job or thread
+        struct Waiter
+        {
+            Waiter* Next = nullptr;
+            Fiber* WaitingFiber = nullptr;
+            std::atomic<uint32_t> Woken = 0;
+        };
+        void Wake(Waiter* waiter, Wakeups& wakeups);
+
+        Waiter* m_Head = nullptr;
+        Waiter* m_Tail = nullptr;
+        size_t m_Size = 0;
+    };
+} // namespace BeeEngine::Internal
@@ -0,0 +1,164 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+namespace BeeEngine::Internal
+{
+    /**
+     * @brief Lock-free single-owner, multi-thief deque (Chase-Lev).
+     *
+     * The owning worker pushes and pops at the bottom (LIFO, cache friendly),
+     * other workers steal from the top (FIFO). Only the owner is allowed to call
+     * Push and Pop. Steal can be called from any thread.
+     * Buffers grow geometrically and retired buffers are kept alive until the
+     * deque is destroyed, because a thief may still be reading from them.
+     *
+     * @tparam T must be trivially copyable (usually a pointer)
+     */
+    template <typename T>
+    class WorkStealingDeque
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "WorkStealingDeque can only store trivially copyable types");
+
+        class Buffer
+        {
+        public:
+            explicit Buffer(int64_t capacity)
+                : m_Capacity(capacity), m_Mask(capacity - 1), m_Data(std::make_unique<std::atomic<T>[]>(capacity))
+            {
+            }
+            int64_t Capacity() const { return m_Capacity; }
+            void Put(int64_t index, T item) { m_Data[index & m_Mask].store(item, std::memory_order_relaxed); }
+            T Get(int64_t index) const { return m_Data[index & m_Mask].load(std::memory_order_relaxed); }
+            std::unique_ptr<Buffer> Grow(int64_t bottom, int64_t top) const
+            {
+                auto buffer = std::make_unique<Buffer>(m_Capacity * 2);
+                for (int64_t i = top; i != bottom; ++i)
+                {
+                    buffer->Put(i, Get(i));
+                }
+                return buffer;
+            }
+
+        private:
+            int64_t m_Capacity;
+            int64_t m_Mask;
+            std::unique_ptr<std::atomic<T>[]> m_Data;
+        };
+
+    public:
+        explicit WorkStealingDeque(int64_t capacity = 1024)
+        {
+            // Capacity must be a power of two
+            int64_t realCapacity = 1;
+            while (realCapacity < capacity)
+            {
+                realCapacity <<= 1;
+            }
+            m_Buffers.emplace_back(std::make_unique<Buffer>(realCapacity));
+            m_Buffer.store(m_Buffers.back().get(), std::memory_order_relaxed);
+        }
+        WorkStealingDeque(const WorkStealingDeque&) = delete;
+        WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+        /**
+         * @brief Pushes an item to the bottom of the deque. Owner only.
+         */
+        void Push(T item)
+        {
+            int64_t bottom = m_Bottom.load(std::memory_order_relaxed);
+            int64_t top = m_Top.load(std::memory_order_acquire);
+            Buffer* buffer = m_Buffer.load(std::memory_order_relaxed);
+            if (bottom - top > buffer->Capacity() - 1)
+            {
+                m_Buffers.emplace_back(buffer->Grow(bottom, top));
+                buffer = m_Buffers.back().get();
+                m_Buffer.store(buffer, std::memory_order_release);
+            }
+            buffer->Put(bottom, item);
+            std::atomic_thread_fence(std::memory_order_release);
+            m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Pops the most recently pushed item. Owner only.
+         */
+        std::optional<T> Pop()
+        {
+            int64_t bottom = m_Bottom.load(std::memory_order_relaxed) - 1;
+            Buffer* buffer = m_Buffer.load(std::memory_order_relaxed);
+            m_Bottom.store(bottom, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            int64_t top = m_Top.load(std::memory_order_relaxed);
+            if (top > bottom)
+            {
+                // Deque was empty
+                m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+                return std::nullopt;
+            }
+            T item = buffer->Get(bottom);
+            if (top == bottom)
+            {
+                // Last item. Race against thieves
+                if (!m_Top.compare_exchange_strong(
+                        top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                {
+                    m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+                    return std::nullopt;
+                }
+                m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+            }
+            return item;
+        }
+
+        /**
+         * @brief Steals the oldest item. Can be called from any thread.
+         */
+        std::optional<T> Steal()
+        {
+            int64_t top = m_Top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            int64_t bottom = m_Bottom.load(std::memory_order_acquire);
+            if (top >= bottom)
+            {
+                return std::nullopt;
+            }
+            Buffer* buffer = m_Buffer.load(std::memory_order_acquire);
+            T item = buffer->Get(top);
+            if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            {
+                return std::nullopt;
+            }
+            return item;
+        }
+
+        /**
+         * @brief Approximate number of items. Exact only when called by the owner
+         * while no thieves are active.
+         */
+        size_t Size() const
+        {
+            int64_t bottom = m_Bottom.load(std::memory_order_relaxed);
+            int64_t top = m_Top.load(std::memory_order_relaxed);
+            return bottom > top ? static_cast<size_t>(bottom - top) : 0;
+        }
+
+        bool Empty() const { return Size() == 0; }
+
+    private:
+        alignas(64) std::atomic<int64_t> m_Top = 0;
+        alignas(64) std::atomic<int64_t> m_Bottom = 0;
+        alignas(64) std::atomic<Buffer*> m_Buffer = nullptr;
+        // Owned only by the owner thread. Old buffers are kept for thieves
+        std::vector<std::unique_ptr<Buffer>> m_Buffers;
+    };
+} // namespace BeeEngine::Internal
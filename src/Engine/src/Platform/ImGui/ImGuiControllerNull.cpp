@@ -0,0 +1,71 @@
+//
+// Created by alexl on 17.10.2026.
+//
+#include "ImGuiControllerNull.h"
+#include "Windowing/WindowHandler/WindowHandler.h"
+#include "imgui.h"
+#if defined(BEE_COMPILE_SDL)
+#include "backends/imgui_impl_sdl3.h"
+#endif
+
+namespace BeeEngine::Internal
+{
+    void ImGuiControllerNull::Initialize(uint16_t width, uint16_t height, uintptr_t windowHandle)
+    {
+        m_Window = (void*)windowHandle;
+        ImGui::CreateContext();
+        ImGuiController::SetupConfigPath();
+
+        ImGuiIO& io = ImGui::GetIO();
+        io.ConfigFlags |= ImGuiConfigFlags_DockingEnable;
+        io.DisplaySize = ImVec2(width, height);
+        SetDefaultTheme();
+
+        switch (WindowHandler::GetAPI())
+        {
+            case WindowHandlerAPI::SDL:
+#if defined(BEE_COMPILE_SDL)
+                ImGui_ImplSDL3_InitForOther((SDL_Window*)m_Window);
+                m_NewFrameBackend = ImGui_ImplSDL3_NewFrame;
+#endif
+                break;
+            case WindowHandlerAPI::WinAPI:
+                break;
+        }
+        // There is no renderer backend to upload the font atlas, but it must be built before the first frame
+        io.Fonts->Build();
+    }
+
+    void ImGuiControllerNull::Update()
+    {
+        if (m_NewFrameBackend)
+        {
+            m_NewFrameBackend();
+        }
+        else
+        {
+            ImGui::GetIO().DeltaTime = 1.0f / 60.0f;
+        }
+        ImGui::NewFrame();
+    }
+
+    void ImGuiControllerNull::Render(CommandBuffer& commandBuffer)
+    {
+        ImGui::Render();
+    }
+
+    void ImGuiControllerNull::Shutdown()
+    {
+        switch (WindowHandler::GetAPI())
+        {
+            case WindowHandlerAPI::SDL:
+#if defined(BEE_COMPILE_SDL)
+                ImGui_ImplSDL3_Shutdown();
+#endif
+                break;
+            case WindowHandlerAPI::WinAPI:
+                break;
+        }
+        ImGui::DestroyContext();
+    }
+} // namespace BeeEngine::Internal
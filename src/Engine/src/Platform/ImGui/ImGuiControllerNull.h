@@ -0,0 +1,26 @@
+//
+// Created by alexl on 17.10.2026.
+//
+#pragma once
+
+#include "ImGuiController.h"
+
+namespace BeeEngine::Internal
+{
+    /**
+     * @brief Builds ImGui frames without a renderer backend, the draw data is discarded.
+     * Lets the layers, that use ImGui, run with the null renderer
+     */
+    class ImGuiControllerNull : public ImGuiController
+    {
+    public:
+        void Initialize(uint16_t width, uint16_t height, uintptr_t windowHandle) override;
+        void Update() override;
+        void Render(CommandBuffer& commandBuffer) override;
+        void Shutdown() override;
+
+    private:
+        void* m_Window = nullptr;
+        void (*m_NewFrameBackend)() = nullptr;
+    };
+} // namespace BeeEngine::Internal
@@ -0,0 +1,17 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#pragma once
+#include "Renderer/BindingSet.h"
+
+namespace BeeEngine::Internal
+{
+    class NullBindingSet final : public BindingSet
+    {
+    public:
+        explicit NullBindingSet(std::vector<BindingSetElement> elements) : BindingSet(BeeMove(elements)) {}
+
+        void Bind(CommandBuffer& cmd, uint32_t index, Pipeline& pipeline) const override {}
+    };
+} // namespace BeeEngine::Internal
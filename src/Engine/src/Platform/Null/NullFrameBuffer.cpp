@@ -0,0 +1,126 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#include "NullFrameBuffer.h"
+#include "Core/CodeSafety/Expects.h"
+#include "NullBindingSet.h"
+#include "Renderer/CommandBuffer.h"
+
+namespace BeeEngine::Internal
+{
+    static uint32_t GetSizeOfPixel(FrameBufferTextureFormat format)
+    {
+        switch (format)
+        {
+            case FrameBufferTextureFormat::RGBA16F:
+                return 8;
+            case FrameBufferTextureFormat::RGBA8:
+            case FrameBufferTextureFormat::RedInteger:
+            case FrameBufferTextureFormat::Depth24:
+                return 4;
+            case FrameBufferTextureFormat::None:
+                break;
+        }
+        return 0;
+    }
+
+    NullFrameBuffer::NullFrameBuffer(const FrameBufferPreferences& preferences) : m_Preferences(preferences)
+    {
+        for (const auto& specification : m_Preferences.Attachments.Attachments)
+        {
+            if (!IsDepthFormat(specification.TextureFormat))
+            {
+                m_ColorAttachmentSpecification.push_back(specification);
+            }
+        }
+        Invalidate();
+    }
+
+    CommandBuffer NullFrameBuffer::Bind()
+    {
+        BeeExpects(!m_IsBound);
+        m_IsBound = true;
+        CommandBuffer commandBuffer{this, &m_RenderingQueue};
+        commandBuffer.BeginRecording();
+        return commandBuffer;
+    }
+
+    void NullFrameBuffer::Unbind(CommandBuffer& commandBuffer)
+    {
+        BeeExpects(m_IsBound && commandBuffer.GetBufferHandle() == this);
+        commandBuffer.EndRecording();
+        commandBuffer.Invalidate();
+        m_IsBound = false;
+    }
+
+    void NullFrameBuffer::Resize(uint32_t width, uint32_t height)
+    {
+        BeeExpects(width > 0 && height > 0);
+        if (m_Preferences.Width == width && m_Preferences.Height == height)
+        {
+            return;
+        }
+        m_Preferences.Width = width;
+        m_Preferences.Height = height;
+        Invalidate();
+    }
+
+    void NullFrameBuffer::Invalidate()
+    {
+        m_ColorAttachmentsTextures.clear();
+        m_DepthAttachmentTexture.reset();
+        std::vector<BindingSetElement> elements;
+        elements.reserve(m_ColorAttachmentSpecification.size());
+        for (uint32_t i = 0; i < m_ColorAttachmentSpecification.size(); ++i)
+        {
+            auto& texture = m_ColorAttachmentsTextures.emplace_back(
+                CreateScope<NullGPUTextureResource>(m_Preferences.Width, m_Preferences.Height));
+            elements.push_back({i, *texture});
+        }
+        if (m_ColorAttachmentSpecification.size() < m_Preferences.Attachments.Attachments.size())
+        {
+            m_DepthAttachmentTexture = CreateScope<NullGPUTextureResource>(m_Preferences.Width, m_Preferences.Height);
+        }
+        m_ColorBindingSet = CreateScope<NullBindingSet>(BeeMove(elements));
+    }
+
+    uintptr_t NullFrameBuffer::GetColorAttachmentImGuiRendererID(uint32_t index) const
+    {
+        BeeExpects(index < m_ColorAttachmentsTextures.size());
+        return m_ColorAttachmentsTextures[index]->GetRendererID();
+    }
+
+    uintptr_t NullFrameBuffer::GetDepthAttachmentImGuiRendererID() const
+    {
+        return m_DepthAttachmentTexture ? m_DepthAttachmentTexture->GetRendererID() : 0;
+    }
+
+    GPUTextureResource& NullFrameBuffer::GetColorAttachmentResource(size_t index)
+    {
+        BeeExpects(index < m_ColorAttachmentsTextures.size());
+        return *m_ColorAttachmentsTextures[index];
+    }
+
+    int NullFrameBuffer::ReadPixel(uint32_t attachmentIndex, int x, int y) const
+    {
+        BeeExpects(attachmentIndex < m_ColorAttachmentSpecification.size());
+        BeeExpects(x >= 0 && y >= 0 && x < static_cast<int>(m_Preferences.Width) &&
+                   y < static_cast<int>(m_Preferences.Height));
+        const auto& specification = m_ColorAttachmentSpecification[attachmentIndex];
+        if (specification.TextureFormat == FrameBufferTextureFormat::RedInteger)
+        {
+            return specification.ClearRedInteger;
+        }
+        return 0;
+    }
+
+    DumpedImage NullFrameBuffer::DumpAttachment(uint32_t attachmentIndex) const
+    {
+        BeeExpects(attachmentIndex < m_ColorAttachmentSpecification.size());
+        const auto format = m_ColorAttachmentSpecification[attachmentIndex].TextureFormat;
+        const uint32_t sizeOfPixel = GetSizeOfPixel(format);
+        std::vector<byte> pixels(static_cast<size_t>(m_Preferences.Width) * m_Preferences.Height * sizeOfPixel);
+        return {pixels.data(), m_Preferences.Width, m_Preferences.Height, sizeOfPixel, format};
+    }
+} // namespace BeeEngine::Internal
@@ -0,0 +1,51 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#pragma once
+#include "NullTexture2D.h"
+#include "Renderer/FrameBuffer.h"
+#include "Renderer/RenderingQueue.h"
+#include <vector>
+
+namespace BeeEngine::Internal
+{
+    /**
+     * @brief Nothing is drawn into the attachments, so they keep their clear values.
+     * Draw calls are still flushed from its rendering queue, when the frame buffer is unbound
+     */
+    class NullFrameBuffer final : public FrameBuffer
+    {
+    public:
+        NullFrameBuffer(const FrameBufferPreferences& preferences);
+
+        CommandBuffer Bind() override;
+
+        void Unbind(CommandBuffer& commandBuffer) override;
+
+        void Resize(uint32_t width, uint32_t height) override;
+
+        void Invalidate() override;
+
+        [[nodiscard]] uintptr_t GetColorAttachmentImGuiRendererID(uint32_t index) const override;
+
+        [[nodiscard]] uintptr_t GetDepthAttachmentImGuiRendererID() const override;
+
+        [[nodiscard]] GPUTextureResource& GetColorAttachmentResource(size_t index) override;
+
+        [[nodiscard]] BindingSet& GetColorBindingSet() override { return *m_ColorBindingSet; }
+
+        [[nodiscard]] int ReadPixel(uint32_t attachmentIndex, int x, int y) const override;
+
+        [[nodiscard]] DumpedImage DumpAttachment(uint32_t attachmentIndex) const override;
+
+    private:
+        RenderingQueue m_RenderingQueue;
+        FrameBufferPreferences m_Preferences;
+        std::vector<FrameBufferTextureSpecification> m_ColorAttachmentSpecification;
+        std::vector<Scope<NullGPUTextureResource>> m_ColorAttachmentsTextures;
+        Scope<NullGPUTextureResource> m_DepthAttachmentTexture{nullptr};
+        Scope<BindingSet> m_ColorBindingSet{nullptr};
+        bool m_IsBound{false};
+    };
+} // namespace BeeEngine::Internal
@@ -0,0 +1,33 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#pragma once
+#include "Renderer/GraphicsDevice.h"
+#include "Renderer/Instance.h"
+
+namespace BeeEngine::Internal
+{
+    class NullInstance final : public Instance
+    {
+    };
+
+    /**
+     * @brief Device without a GPU and a swap chain. Rebuild requests are remembered until the next resize,
+     * so the frame loop takes the same path as with a real device
+     */
+    class NullGraphicsDevice final : public GraphicsDevice
+    {
+    public:
+        void WindowResized(uint32_t width, uint32_t height) override { m_SwapChainRebuildRequested = false; }
+
+        void RequestSwapChainRebuild() override { m_SwapChainRebuildRequested = true; }
+
+        bool SwapChainRequiresRebuild() override { return m_SwapChainRebuildRequested; }
+
+        uint64_t GetVRAM() const override { return 0; }
+
+    private:
+        bool m_SwapChainRebuildRequested = false;
+    };
+} // namespace BeeEngine::Internal
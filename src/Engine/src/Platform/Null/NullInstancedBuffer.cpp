@@ -0,0 +1,29 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#include "NullInstancedBuffer.h"
+#include "Core/CodeSafety/Expects.h"
+#include "Renderer/CommandBuffer.h"
+#include "Renderer/RenderingQueue.h"
+
+namespace BeeEngine::Internal
+{
+    void NullInstancedBuffer::SetData(void* data, size_t size)
+    {
+        BeeExpects(size <= m_Size);
+        RenderingQueue::CountUploadedBytes(size);
+    }
+
+    void NullInstancedBuffer::UpdateRange(size_t offset, gsl::span<const byte> data)
+    {
+        BeeExpects(offset + data.size() <= m_Size);
+        RenderingQueue::CountUploadedBytes(data.size());
+    }
+
+    void NullInstancedBuffer::Bind(CommandBuffer& cmd, size_t offset)
+    {
+        BeeExpects(cmd.IsValid());
+        BeeExpects(offset < m_Size);
+    }
+} // namespace BeeEngine::Internal
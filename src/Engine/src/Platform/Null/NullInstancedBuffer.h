@@ -0,0 +1,28 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#pragma once
+#include "Renderer/InstancedBuffer.h"
+
+namespace BeeEngine::Internal
+{
+    /**
+     * @brief Keeps no data. Writes are checked against the size and counted as uploaded bytes
+     */
+    class NullInstancedBuffer final : public InstancedBuffer
+    {
+    public:
+        explicit NullInstancedBuffer(size_t size) : m_Size(size) {}
+
+        void SetData(void* data, size_t size) override;
+        void UpdateRange(size_t offset, gsl::span<const byte> data) override;
+
+        void Bind(CommandBuffer& cmd, size_t offset) override;
+
+        size_t GetSize() override { return m_Size; }
+
+    private:
+        size_t m_Size;
+    };
+} // namespace BeeEngine::Internal
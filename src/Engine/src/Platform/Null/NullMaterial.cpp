@@ -0,0 +1,17 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#include "NullMaterial.h"
+
+namespace BeeEngine::Internal
+{
+    NullMaterial::NullMaterial(const std::filesystem::path& vertexShader, const std::filesystem::path& fragmentShader)
+    {
+        // Shaders are still compiled, the layout of the instance data comes from their reflection
+        auto vertexShaderModule = ShaderModule::Create(vertexShader, ShaderType::Vertex);
+        auto fragmentShaderModule = ShaderModule::Create(fragmentShader, ShaderType::Fragment);
+        m_InstancedBuffer = vertexShaderModule->CreateInstancedBuffer();
+        m_Pipeline = Pipeline::Create(vertexShaderModule, fragmentShaderModule);
+    }
+} // namespace BeeEngine::Internal
@@ -0,0 +1,25 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#pragma once
+#include "Renderer/Material.h"
+#include "Renderer/Pipeline.h"
+
+namespace BeeEngine::Internal
+{
+    class NullMaterial final : public Material
+    {
+    public:
+        NullMaterial(const std::filesystem::path& vertexShader, const std::filesystem::path& fragmentShader);
+
+        [[nodiscard]] InstancedBuffer& GetInstancedBuffer() const override { return *m_InstancedBuffer; }
+        void Bind(CommandBuffer& cmd) override { m_Pipeline->Bind(cmd); }
+
+        [[nodiscard]] Pipeline& GetPipeline() const { return *m_Pipeline; }
+
+    private:
+        Ref<Pipeline> m_Pipeline;
+        Ref<InstancedBuffer> m_InstancedBuffer;
+    };
+} // namespace BeeEngine::Internal
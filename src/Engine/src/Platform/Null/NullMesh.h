@@ -0,0 +1,30 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#pragma once
+#include "Renderer/Mesh.h"
+
+namespace BeeEngine::Internal
+{
+    /**
+     * @brief Remembers only the counts of vertices and indices, that draw calls are accounted with
+     */
+    class NullMesh final : public Mesh
+    {
+    public:
+        NullMesh(size_t vertexCount, size_t indexCount) : m_VertexCount(vertexCount), m_IndexCount(indexCount) {}
+
+        [[nodiscard]] uint32_t GetVertexCount() const override { return m_VertexCount; }
+
+        [[nodiscard]] uint32_t GetIndexCount() const override { return m_IndexCount; }
+
+        void Bind(CommandBuffer& commandBuffer) override {}
+
+        [[nodiscard]] bool IsIndexed() const override { return m_IndexCount > 0; }
+
+    private:
+        size_t m_VertexCount;
+        size_t m_IndexCount;
+    };
+} // namespace BeeEngine::Internal
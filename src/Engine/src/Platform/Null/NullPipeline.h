@@ -0,0 +1,21 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#pragma once
+#include "Renderer/Pipeline.h"
+
+namespace BeeEngine::Internal
+{
+    class NullPipeline final : public Pipeline
+    {
+    public:
+        explicit NullPipeline(PipelineType type) : m_Type(type) {}
+
+        PipelineType GetType() const override { return m_Type; }
+        void Bind(CommandBuffer& commandBuffer) override {}
+
+    private:
+        PipelineType m_Type;
+    };
+} // namespace BeeEngine::Internal
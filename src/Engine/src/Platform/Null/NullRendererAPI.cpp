@@ -0,0 +1,111 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#include "NullRendererAPI.h"
+#include "Core/CodeSafety/Expects.h"
+#include "NullMaterial.h"
+#include "Renderer/FrameBuffer.h"
+#include "Renderer/Pipeline.h"
+#include "Renderer/StorageBuffer.h"
+#include "Windowing/WindowHandler/WindowHandler.h"
+
+namespace BeeEngine::Internal
+{
+    void NullRendererAPI::Init() {}
+
+    Expected<CommandBuffer, RendererAPI::Error> NullRendererAPI::BeginFrame()
+    {
+        return GetCurrentCommandBuffer();
+    }
+
+    void NullRendererAPI::EndFrame()
+    {
+        SubmitCommandBuffer(GetCurrentCommandBuffer());
+        m_Counters.FrameCount++;
+    }
+
+    void NullRendererAPI::RebuildSwapchain()
+    {
+        auto window = WindowHandler::GetInstance();
+        window->GetGraphicsDevice().WindowResized(window->GetWidthInPixels(), window->GetHeightInPixels());
+    }
+
+    void NullRendererAPI::StartMainCommandBuffer(CommandBuffer& commandBuffer)
+    {
+        BeeExpects(commandBuffer.GetBufferHandle() == this);
+        commandBuffer.BeginRecording();
+    }
+
+    void NullRendererAPI::EndMainCommandBuffer(CommandBuffer& commandBuffer)
+    {
+        BeeExpects(commandBuffer.GetBufferHandle() == this);
+        commandBuffer.EndRecording();
+        commandBuffer.Invalidate();
+    }
+
+    CommandBuffer NullRendererAPI::GetCurrentCommandBuffer()
+    {
+        // The handle is only compared, nothing is recorded into it
+        return CommandBuffer{this, &m_RenderingQueue};
+    }
+
+    void NullRendererAPI::DrawInstanced(CommandBuffer& commandBuffer,
+                                        Model& model,
+                                        InstancedBuffer& instancedBuffer,
+                                        const std::vector<BindingSet*>& bindingSets,
+                                        uint32_t instanceCount,
+                                        size_t instanceDataOffset)
+    {
+        BeeExpects(commandBuffer.IsValid());
+        BeeExpects(instanceCount > 0);
+        model.Bind(commandBuffer);
+        instancedBuffer.Bind(commandBuffer, instanceDataOffset);
+        uint32_t index = 0;
+        for (auto& bindingSet : bindingSets)
+        {
+            bindingSet->Bind(commandBuffer, index++, static_cast<NullMaterial&>(model.GetMaterial()).GetPipeline());
+        }
+        m_Counters.DrawCallCount++;
+        m_Counters.InstanceCount += instanceCount;
+        m_Counters.VertexCount += static_cast<size_t>(model.GetVertexCount()) * instanceCount;
+        m_Counters.IndexCount += static_cast<size_t>(model.GetIndexCount()) * instanceCount;
+    }
+
+    void NullRendererAPI::DrawIndexedIndirect(CommandBuffer& commandBuffer,
+                                              Model& model,
+                                              StorageBuffer& instances,
+                                              const std::vector<BindingSet*>& bindingSets,
+                                              StorageBuffer& commands,
+                                              size_t commandsOffset,
+                                              uint32_t drawCount)
+    {
+        BeeExpects(commandBuffer.IsValid());
+        BeeExpects(model.IsIndexed());
+        BeeExpects(commandsOffset + drawCount * sizeof(IndirectDrawCommand) <= commands.GetSize());
+        model.Bind(commandBuffer);
+        uint32_t index = 0;
+        for (auto& bindingSet : bindingSets)
+        {
+            bindingSet->Bind(commandBuffer, index++, static_cast<NullMaterial&>(model.GetMaterial()).GetPipeline());
+        }
+        m_Counters.IndirectDrawCallCount++;
+    }
+
+    void NullRendererAPI::Dispatch(Pipeline& computePipeline,
+                                   const std::vector<BindingSet*>& bindingSets,
+                                   uint32_t groupCountX)
+    {
+        BeeExpects(computePipeline.GetType() == PipelineType::Compute);
+        BeeExpects(groupCountX > 0);
+        m_Counters.DispatchCount++;
+    }
+
+    void NullRendererAPI::SubmitCommandBuffer(const CommandBuffer& commandBuffer)
+    {
+        BeeExpects(commandBuffer.GetBufferHandle() != nullptr);
+        m_Counters.SubmittedCommandBufferCount++;
+    }
+
+    void NullRendererAPI::CopyFrameBufferImageToSwapchain(FrameBuffer& framebuffer, uint32_t attachmentIndex) {}
+} // namespace BeeEngine::Internal
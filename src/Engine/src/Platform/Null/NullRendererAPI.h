@@ -0,0 +1,79 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#pragma once
+#include "Core/Expected.h"
+#include "Renderer/CommandBuffer.h"
+#include "Renderer/RendererAPI.h"
+#include "Renderer/RenderingQueue.h"
+
+namespace BeeEngine::Internal
+{
+    /**
+     * @brief Renderer API, that records nothing and counts the work, which is submitted to it.
+     * Frames run through the rendering queues as usual, so the renderer statistics stay meaningful
+     */
+    class NullRendererAPI final : public RendererAPI
+    {
+    public:
+        // Totals since the API was created
+        struct Counters
+        {
+            size_t FrameCount{0};
+            size_t DrawCallCount{0};
+            size_t InstanceCount{0};
+            size_t VertexCount{0};
+            size_t IndexCount{0};
+            size_t SubmittedCommandBufferCount{0};
+            size_t IndirectDrawCallCount{0};
+            size_t DispatchCount{0};
+        };
+
+        void Init() override;
+
+        Expected<CommandBuffer, RendererAPI::Error> BeginFrame() override;
+
+        void EndFrame() override;
+
+        void RebuildSwapchain() override;
+
+        void StartMainCommandBuffer(CommandBuffer& commandBuffer) override;
+
+        void EndMainCommandBuffer(CommandBuffer& commandBuffer) override;
+
+        [[nodiscard]] CommandBuffer GetCurrentCommandBuffer() override;
+
+        void DrawInstanced(CommandBuffer& commandBuffer,
+                           Model& model,
+                           InstancedBuffer& instancedBuffer,
+                           const std::vector<BindingSet*>& bindingSets,
+                           uint32_t instanceCount,
+                           size_t instanceDataOffset) override;
+
+        void DrawIndexedIndirect(CommandBuffer& commandBuffer,
+                                 Model& model,
+                                 StorageBuffer& instances,
+                                 const std::vector<BindingSet*>& bindingSets,
+                                 StorageBuffer& commands,
+                                 size_t commandsOffset,
+                                 uint32_t drawCount) override;
+
+        void Dispatch(Pipeline& computePipeline,
+                      const std::vector<BindingSet*>& bindingSets,
+                      uint32_t groupCountX) override;
+
+        // Nothing is executed, so the instance counts of indirect draws are unknown. Scenes use the CPU paths
+        [[nodiscard]] bool SupportsIndirectDrawing() const override { return false; }
+
+        void SubmitCommandBuffer(const CommandBuffer& commandBuffer) override;
+
+        void CopyFrameBufferImageToSwapchain(FrameBuffer& framebuffer, uint32_t attachmentIndex) override;
+
+        [[nodiscard]] const Counters& GetCounters() const { return m_Counters; }
+
+    private:
+        RenderingQueue m_RenderingQueue;
+        Counters m_Counters;
+    };
+} // namespace BeeEngine::Internal
@@ -0,0 +1,21 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#include "NullShaderModule.h"
+#include "Core/Logging/Log.h"
+#include "NullInstancedBuffer.h"
+
+namespace BeeEngine::Internal
+{
+    Scope<InstancedBuffer> NullShaderModule::CreateInstancedBuffer()
+    {
+        static constexpr size_t MAX_INSTANCED_BUFFER_COUNT = 10000;
+        if (m_Type != ShaderType::Vertex)
+        {
+            BeeCoreError("Instanced buffer can be created only for vertex shader");
+            return nullptr;
+        }
+        return CreateScope<NullInstancedBuffer>(MAX_INSTANCED_BUFFER_COUNT * m_Layout.GetStride());
+    }
+} // namespace BeeEngine::Internal
@@ -0,0 +1,23 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#pragma once
+#include "Renderer/ShaderModule.h"
+
+namespace BeeEngine::Internal
+{
+    class NullShaderModule final : public ShaderModule
+    {
+    public:
+        NullShaderModule(ShaderType type, BufferLayout&& layout) : m_Type(type), m_Layout(std::move(layout)) {}
+
+        [[nodiscard]] ShaderType GetType() const override { return m_Type; }
+
+        [[nodiscard]] Scope<InstancedBuffer> CreateInstancedBuffer() override;
+
+    private:
+        ShaderType m_Type;
+        BufferLayout m_Layout;
+    };
+} // namespace BeeEngine::Internal
@@ -0,0 +1,19 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#include "NullStorageBuffer.h"
+#include "Core/CodeSafety/Expects.h"
+#include "Renderer/RenderingQueue.h"
+#include <cstring>
+
+namespace BeeEngine::Internal
+{
+    void NullStorageBuffer::SetData(size_t offset, gsl::span<const byte> data)
+    {
+        BeeExpects(m_Usage == StorageBufferUsage::CPUToGPU);
+        BeeExpects(offset + data.size() <= m_Data.size());
+        memcpy(m_Data.data() + offset, data.data(), data.size());
+        RenderingQueue::CountUploadedBytes(data.size());
+    }
+} // namespace BeeEngine::Internal
@@ -0,0 +1,32 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#pragma once
+#include "Renderer/StorageBuffer.h"
+
+namespace BeeEngine::Internal
+{
+    /**
+     * @brief Keeps the data in CPU memory, so it can be read back. Writes are counted as uploaded bytes.
+     * Nothing is executed on the null renderer, so GPUOnly buffers stay zeroed
+     */
+    class NullStorageBuffer final : public StorageBuffer
+    {
+    public:
+        NullStorageBuffer(size_t size, StorageBufferUsage usage) : m_Data(size), m_Usage(usage) {}
+
+        std::vector<IBindable::BindGroupLayoutEntryType> GetBindGroupLayoutEntry() const override { return {Dummy{}}; }
+
+        std::vector<IBindable::BindGroupEntryType> GetBindGroupEntry() const override { return {Dummy{}}; }
+
+        void SetData(size_t offset, gsl::span<const byte> data) override;
+        std::vector<byte> ReadData() override { return m_Data; }
+        size_t GetSize() const override { return m_Data.size(); }
+        StorageBufferUsage GetUsage() const override { return m_Usage; }
+
+    private:
+        std::vector<byte> m_Data;
+        StorageBufferUsage m_Usage;
+    };
+} // namespace BeeEngine::Internal
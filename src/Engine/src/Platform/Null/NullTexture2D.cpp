@@ -0,0 +1,24 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#include "NullTexture2D.h"
+#include "Core/CodeSafety/Expects.h"
+#include <atomic>
+
+namespace BeeEngine::Internal
+{
+    NullGPUTextureResource::NullGPUTextureResource(uint32_t width, uint32_t height)
+    {
+        // Textures are compared by their IDs, so every texture gets its own one
+        static std::atomic<uintptr_t> s_NextRendererID{1};
+        m_RendererID = s_NextRendererID++;
+        m_Width = width;
+        m_Height = height;
+    }
+
+    void NullGPUTextureResource::SetData(gsl::span<std::byte> data, uint32_t numberOfChannels)
+    {
+        BeeExpects(data.size() >= static_cast<size_t>(m_Width) * m_Height * numberOfChannels);
+    }
+} // namespace BeeEngine::Internal
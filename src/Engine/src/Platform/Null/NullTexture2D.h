@@ -0,0 +1,21 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#pragma once
+#include "Renderer/Texture.h"
+
+namespace BeeEngine::Internal
+{
+    class NullGPUTextureResource final : public GPUTextureResource
+    {
+    public:
+        NullGPUTextureResource(uint32_t width, uint32_t height);
+
+        std::vector<IBindable::BindGroupLayoutEntryType> GetBindGroupLayoutEntry() const override { return {Dummy{}}; }
+
+        std::vector<IBindable::BindGroupEntryType> GetBindGroupEntry() const override { return {Dummy{}}; }
+
+        void SetData(gsl::span<std::byte> data, uint32_t numberOfChannels) override;
+    };
+} // namespace BeeEngine::Internal
@@ -0,0 +1,29 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#include "NullUniformBuffer.h"
+#include "Core/CodeSafety/Expects.h"
+#include "Renderer/RenderingQueue.h"
+
+namespace BeeEngine::Internal
+{
+    void NullUniformBuffer::SetData(const void* data, size_t size)
+    {
+        BeeExpects(size <= m_ElementSize * m_ElementCount);
+        RenderingQueue::CountUploadedBytes(size);
+    }
+
+    void NullUniformBuffer::SetElement(uint32_t index, const void* data, size_t size)
+    {
+        BeeExpects(index < m_ElementCount);
+        BeeExpects(size <= m_ElementSize);
+        RenderingQueue::CountUploadedBytes(size);
+    }
+
+    uint32_t NullUniformBuffer::GetElementOffset(uint32_t index) const
+    {
+        BeeExpects(index < m_ElementCount);
+        return static_cast<uint32_t>(index * m_ElementSize);
+    }
+} // namespace BeeEngine::Internal
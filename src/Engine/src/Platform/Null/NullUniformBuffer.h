@@ -0,0 +1,34 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#pragma once
+#include "Renderer/UniformBuffer.h"
+
+namespace BeeEngine::Internal
+{
+    /**
+     * @brief Keeps no data. Writes are checked against the layout of the buffer and counted as uploaded bytes
+     */
+    class NullUniformBuffer final : public UniformBuffer
+    {
+    public:
+        explicit NullUniformBuffer(size_t size) : NullUniformBuffer(size, 1) {}
+        NullUniformBuffer(size_t elementSize, uint32_t elementCount)
+            : m_ElementSize(elementSize), m_ElementCount(elementCount)
+        {
+        }
+
+        std::vector<IBindable::BindGroupLayoutEntryType> GetBindGroupLayoutEntry() const override { return {Dummy{}}; }
+
+        std::vector<IBindable::BindGroupEntryType> GetBindGroupEntry() const override { return {Dummy{}}; }
+
+        void SetData(const void* data, size_t size) override;
+        void SetElement(uint32_t index, const void* data, size_t size) override;
+        uint32_t GetElementOffset(uint32_t index) const override;
+
+    private:
+        size_t m_ElementSize;
+        uint32_t m_ElementCount;
+    };
+} // namespace BeeEngine::Internal
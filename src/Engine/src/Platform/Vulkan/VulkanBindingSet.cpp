@@ -6,7 +6,10 @@
 
 #include "Renderer/CommandBuffer.h"
 #include "Renderer/IBindable.h"
+#include "Renderer/Renderer.h"
+#include "VulkanComputePipeline.h"
 #include "VulkanPipeline.h"
+#include <array>
 
 namespace BeeEngine::Internal
 {
@@ -45,23 +48,32 @@ namespace BeeEngine::Internal
                 auto& vkEntry = std::get<vk::DescriptorSetLayoutBinding>(entry);
                 vkEntry.binding = bindingIndex++;
                 bindings.push_back(vkEntry);
+                if (vkEntry.descriptorType == vk::DescriptorType::eUniformBufferDynamic)
+                {
+                    m_DynamicElements.push_back(&element.Data);
+                    m_DynamicGenerations.push_back(element.Data.GetResourceGeneration());
+                }
             }
         }
         vk::DescriptorSetLayoutCreateInfo layoutInfo({}, (uint32_t)bindings.size(), bindings.data());
         m_DescriptorSetLayout = m_GraphicsDevice.GetDevice().createDescriptorSetLayout(layoutInfo);
+        m_DescriptorSet = CreateDescriptorSet();
+        BeeEnsures(m_DynamicElements.size() <= MaxDynamicOffsets);
+    }
+
+    vk::DescriptorSet VulkanBindingSet::CreateDescriptorSet() const
+    {
+        vk::DescriptorSet descriptorSet;
         vk::DescriptorSetAllocateInfo allocInfo{};
         allocInfo.descriptorSetCount = 1;
         allocInfo.pSetLayouts = &m_DescriptorSetLayout;
-        m_GraphicsDevice.CreateDescriptorSet(allocInfo, &m_DescriptorSet);
+        m_GraphicsDevice.CreateDescriptorSet(allocInfo, &descriptorSet);
         // update
+        size_t bindingIndex = 0;
         if (!m_Elements.empty() && m_Elements[0].Binding != 0)
         {
             bindingIndex = m_Elements[0].Binding;
         }
-        else
-        {
-            bindingIndex = 0;
-        }
 
         std::vector<vk::WriteDescriptorSet> descriptorWrites;
         for (const auto& element : m_Elements)
@@ -70,7 +82,7 @@ namespace BeeEngine::Internal
             for (auto& entry : binding)
             {
                 auto& writeDescriptorSet = std::get<vk::WriteDescriptorSet>(entry);
-                writeDescriptorSet.dstSet = m_DescriptorSet;
+                writeDescriptorSet.dstSet = descriptorSet;
                 writeDescriptorSet.dstBinding = bindingIndex++;
                 writeDescriptorSet.dstArrayElement = 0;
                 // writeDescriptorSet.descriptorType = vkEntry.descriptorType;
@@ -82,18 +94,44 @@ namespace BeeEngine::Internal
             }
         }
         m_GraphicsDevice.GetDevice().updateDescriptorSets(descriptorWrites, nullptr);
+        return descriptorSet;
     }
 
     void VulkanBindingSet::Bind(CommandBuffer& cmd, uint32_t index, Pipeline& pipeline) const
     {
         auto commandBuffer = cmd.GetBufferHandleAs<vk::CommandBuffer>();
+        // A recreated uniform buffer needs a new descriptor set. The old one may still be used by the frames in flight,
+        // so it is destroyed after them instead of being updated
+        bool outdated = false;
+        for (size_t i = 0; i < m_DynamicElements.size(); ++i)
+        {
+            const uint32_t generation = m_DynamicElements[i]->GetResourceGeneration();
+            outdated |= generation != m_DynamicGenerations[i];
+            m_DynamicGenerations[i] = generation;
+        }
+        if (outdated)
+        {
+            Renderer::DestroyAfterFramesInFlight(
+                [descriptorSet = m_DescriptorSet]()
+                { VulkanGraphicsDevice::GetInstance().DestroyDescriptorSet(descriptorSet); });
+            m_DescriptorSet = CreateDescriptorSet();
+        }
+        // Uniform buffers are written every frame into a new range, so offsets are read on every bind
+        std::array<uint32_t, MaxDynamicOffsets> dynamicOffsets;
+        for (size_t i = 0; i < m_DynamicElements.size(); ++i)
+        {
+            dynamicOffsets[i] = m_DynamicElements[i]->GetDynamicOffset();
+        }
+        const vk::PipelineLayout layout = pipeline.GetType() == PipelineType::Compute
+                                              ? static_cast<VulkanComputePipeline&>(pipeline).GetPipelineLayout()
+                                              : static_cast<VulkanPipeline&>(pipeline).GetPipelineLayout();
         commandBuffer.bindDescriptorSets(GetPipelineBindPoint(pipeline.GetType()),
-                                         ((VulkanPipeline&)pipeline).GetPipelineLayout(),
+                                         layout,
                                          index,
                                          1,
                                          &m_DescriptorSet,
-                                         0,
-                                         nullptr);
+                                         static_cast<uint32_t>(m_DynamicElements.size()),
+                                         dynamicOffsets.data());
     }
 
     VulkanBindingSet::~VulkanBindingSet()
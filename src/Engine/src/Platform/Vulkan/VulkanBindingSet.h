@@ -21,7 +21,16 @@ namespace BeeEngine::Internal
         ~VulkanBindingSet() override;
 
     private:
-        vk::DescriptorSet m_DescriptorSet;
+        // Maximum number of dynamic uniform buffers in one set
+        static constexpr size_t MaxDynamicOffsets = 8;
+
+        vk::DescriptorSet CreateDescriptorSet() const;
+
+        // In the order of their bindings, dynamic offsets are passed in this order
+        std::vector<const IBindable*> m_DynamicElements;
+        // Resource generations of the dynamic elements, that the descriptor set was written with
+        mutable std::vector<uint32_t> m_DynamicGenerations;
+        mutable vk::DescriptorSet m_DescriptorSet;
         vk::DescriptorSetLayout m_DescriptorSetLayout;
         VulkanGraphicsDevice& m_GraphicsDevice;
     };
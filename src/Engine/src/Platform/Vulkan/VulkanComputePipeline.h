@@ -17,6 +17,8 @@ namespace BeeEngine::Internal
 
         void Bind(CommandBuffer& commandBuffer) override;
 
+        [[nodiscard]] vk::PipelineLayout GetPipelineLayout() const { return m_PipelineLayout; }
+
         ~VulkanComputePipeline() override;
 
     private:
@@ -16,6 +16,7 @@
 #include <SDL3/SDL_vulkan.h>
 #endif
 #include "VulkanGraphicsDevice.h"
+#include "VulkanUploadManager.h"
 #include "Renderer/QueueFamilyIndices.h"
 #include <set>
 #include "Core/Application.h"
@@ -37,10 +38,13 @@ namespace BeeEngine::Internal
             m_Sufficient = CheckRequiredFeatures() && CheckRequiredExtensions().HasValue();
             BeeCoreTrace("Sufficient {}", m_Sufficient);
             m_RayTracing = CheckRayTracingSupport();
+            CheckIndirectDrawingSupport();
             CalculateScore();
         }
         bool IsSufficient() const { return m_Sufficient; }
         bool SupportsRayTracing() const { return m_RayTracing; }
+        bool SupportsIndirectDrawing() const { return m_IndirectDrawing; }
+        bool SupportsMultiDrawIndirect() const { return m_MultiDrawIndirect; }
         const String& Name() const { return m_Name; }
         uint64_t Score() const { return m_Score; }
         uint64_t VRAM() const
@@ -96,9 +100,12 @@ namespace BeeEngine::Internal
 
             deviceFeatures2.features.samplerAnisotropy = vk::True;
             deviceFeatures2.features.independentBlend = vk::True;
+            deviceFeatures2.features.drawIndirectFirstInstance = m_IndirectDrawing ? vk::True : vk::False;
+            deviceFeatures2.features.multiDrawIndirect = m_MultiDrawIndirect ? vk::True : vk::False;
 
             deviceVulkan12Features.bufferDeviceAddress = vk::True;
             deviceVulkan12Features.descriptorIndexing = vk::True;
+            deviceVulkan12Features.timelineSemaphore = vk::True;
 
             deviceVulkan13Features.synchronization2 = vk::True;
             deviceVulkan13Features.dynamicRendering = vk::True;
@@ -218,7 +225,8 @@ namespace BeeEngine::Internal
                 deviceVulkan13Features.dynamicRendering == vk::True &&
                 deviceVulkan13Features.synchronization2 == vk::True &&
 #endif
-                deviceVulkan12Features.descriptorIndexing == vk::True)
+                deviceVulkan12Features.descriptorIndexing == vk::True &&
+                deviceVulkan12Features.timelineSemaphore == vk::True)
             {
                 result = true;
             }
@@ -240,13 +248,27 @@ namespace BeeEngine::Internal
             {
                 BeeCoreError("Device does not support buffer device address");
             }
+            if (deviceVulkan12Features.timelineSemaphore != vk::True)
+            {
+                BeeCoreError("Device does not support timeline semaphores");
+            }
             return result;
         }
         bool CheckRayTracingSupport() { return CheckExtensions(s_RayTracingExtensions).HasValue(); }
+        void CheckIndirectDrawingSupport()
+        {
+            // Meshes, that are culled on the GPU, are drawn from one buffer of compacted instances,
+            // so indirect draws must be able to start at an instance other than zero
+            auto features = m_Device.getFeatures();
+            m_IndirectDrawing = features.drawIndirectFirstInstance == vk::True;
+            m_MultiDrawIndirect = m_IndirectDrawing && features.multiDrawIndirect == vk::True;
+        }
         vk::PhysicalDevice m_Device;
         String m_Name;
         bool m_Sufficient;
         bool m_RayTracing;
+        bool m_IndirectDrawing = false;
+        bool m_MultiDrawIndirect = false;
         uint64_t m_Score;
         static inline std::vector<String> s_RequiredExtensions{VK_KHR_SWAPCHAIN_EXTENSION_NAME,
                                                                // VK_KHR_DEFERRED_HOST_OPERATIONS_EXTENSION_NAME,
@@ -338,11 +360,20 @@ namespace BeeEngine::Internal
         {
             m_PresentQueue = m_GraphicsQueue;
         }
+        if (m_QueueFamilyIndices.TransferFamily.has_value())
+        {
+            m_TransferQueue = m_Device.getQueue(m_QueueFamilyIndices.TransferFamily.value(), 0);
+        }
+        else
+        {
+            m_TransferQueue = m_GraphicsQueue;
+        }
         CreateSwapChainSupportDetails();
         m_SwapChain = CreateScope<VulkanSwapChain>(
             *this, WindowHandler::GetInstance()->GetWidth(), WindowHandler::GetInstance()->GetHeight());
         CreateCommandPool();
         CreateDescriptorPool();
+        m_UploadManager = CreateScope<VulkanUploadManager>(*this);
     }
 
     VulkanGraphicsDevice::~VulkanGraphicsDevice()
@@ -354,6 +385,7 @@ namespace BeeEngine::Internal
             DeletionQueue::Main().Flush();
         }
         ImGuiControllerVulkan::s_ShutdownFunction();
+        m_UploadManager.reset();
         m_Device.waitIdle();
         m_Device.destroyDescriptorPool(m_DescriptorPool);
         m_Device.destroyCommandPool(m_CommandPool);
@@ -389,6 +421,31 @@ namespace BeeEngine::Internal
             }
             i++;
         }
+        // Prefer a family, that supports only transfers, as it usually maps to a DMA engine,
+        // which copies in parallel with graphics and compute work
+        std::optional<uint32_t> transferOnlyFamily;
+        std::optional<uint32_t> nonGraphicsFamily;
+        for (uint32_t family = 0; family < queueFamilies.size(); family++)
+        {
+            auto flags = queueFamilies[family].queueFlags;
+            if (!(flags & vk::QueueFlagBits::eTransfer) || (flags & vk::QueueFlagBits::eGraphics))
+            {
+                continue;
+            }
+            if (!(flags & vk::QueueFlagBits::eCompute) && !transferOnlyFamily)
+            {
+                transferOnlyFamily = family;
+            }
+            else if (!nonGraphicsFamily)
+            {
+                nonGraphicsFamily = family;
+            }
+        }
+        indices.TransferFamily = transferOnlyFamily ? transferOnlyFamily : nonGraphicsFamily;
+        if (indices.TransferFamily)
+        {
+            BeeCoreInfo("Queue family {} is used for transfer operations", indices.TransferFamily.value());
+        }
         if (m_PhysicalDevice.getSurfaceSupportKHR(indices.GraphicsFamily.value(), m_DeviceHandle.surface))
         {
             BeeCoreInfo("Queue family {} supports presentation", indices.GraphicsFamily.value());
@@ -456,6 +513,9 @@ namespace BeeEngine::Internal
         m_PhysicalDevice = bestDevice.value().Device();
         m_VRAM = bestDevice.value().VRAM();
         m_HasRayTracingSupport = bestDevice.value().SupportsRayTracing();
+        m_HasIndirectDrawingSupport = bestDevice.value().SupportsIndirectDrawing();
+        m_HasMultiDrawIndirectSupport = bestDevice.value().SupportsMultiDrawIndirect();
+        properties = m_PhysicalDevice.getProperties();
 
         BeeCoreInfo("{} was chosen", bestDevice.value().Name());
         return bestDevice.value();
@@ -488,6 +548,11 @@ namespace BeeEngine::Internal
         {
             queueCreateInfos.push_back(presentQueueCreateInfo);
         }
+        if (m_QueueFamilyIndices.TransferFamily.has_value())
+        {
+            queueCreateInfos.emplace_back(
+                vk::DeviceQueueCreateFlags(), m_QueueFamilyIndices.TransferFamily.value(), 1, queuePriority);
+        }
         m_DeviceHandle.device = gpu.CreateLogicalDevice(queueCreateInfos).value();
         m_Device = m_DeviceHandle.device;
     }
@@ -544,31 +609,7 @@ namespace BeeEngine::Internal
                                                      vk::ImageLayout oldLayout,
                                                      vk::ImageLayout newLayout)
     {
-        vk::CommandBufferAllocateInfo allocInfo{};
-        allocInfo.level = vk::CommandBufferLevel::ePrimary;
-        allocInfo.commandPool = m_CommandPool;
-        allocInfo.commandBufferCount = 1;
-
-        vk::CommandBuffer commandBuffer;
-        CheckVkResult(m_Device.allocateCommandBuffers(&allocInfo, &commandBuffer));
-
-        vk::CommandBufferBeginInfo beginInfo{};
-        beginInfo.flags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit;
-
-        CheckVkResult(commandBuffer.begin(&beginInfo));
-
-        TransitionImageLayout(commandBuffer, image, format, oldLayout, newLayout);
-
-        commandBuffer.end();
-
-        vk::SubmitInfo submitInfo{};
-        submitInfo.commandBufferCount = 1;
-        submitInfo.pCommandBuffers = &commandBuffer;
-
-        m_GraphicsQueue.submit(submitInfo, vk::Fence(nullptr));
-        m_GraphicsQueue.waitIdle();
-
-        m_Device.freeCommandBuffers(m_CommandPool, commandBuffer);
+        m_UploadManager->TransitionImageLayout(image, format, oldLayout, newLayout);
     }
 
     void VulkanGraphicsDevice::TransitionImageLayout(
@@ -701,7 +742,8 @@ namespace BeeEngine::Internal
 
     VulkanBuffer VulkanGraphicsDevice::CreateBuffer(vk::DeviceSize size,
                                                     vk::BufferUsageFlags usage,
-                                                    VmaMemoryUsage memoryUsage) const
+                                                    VmaMemoryUsage memoryUsage,
+                                                    VmaAllocationCreateFlags allocationFlags) const
     {
         // allocate vertex buffer
         VkBufferCreateInfo bufferInfo = {};
@@ -715,7 +757,7 @@ namespace BeeEngine::Internal
         // let the VMA library know that this data should be writeable by CPU, but also readable by GPU
         VmaAllocationCreateInfo vmaallocInfo = {};
         vmaallocInfo.usage = memoryUsage;
-        // vmaallocInfo.flags = VMA_ALLOCATION_CREATE_MAPPED_BIT;
+        vmaallocInfo.flags = allocationFlags;
         if (memoryUsage == VMA_MEMORY_USAGE_AUTO)
         {
             vmaallocInfo.flags |= VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT;
@@ -800,52 +842,20 @@ namespace BeeEngine::Internal
     {
         commandBuffer.end();
 
-        vk::SubmitInfo submitInfo{};
-        submitInfo.sType = vk::StructureType::eSubmitInfo;
-        submitInfo.commandBufferCount = 1;
-        submitInfo.pCommandBuffers = &commandBuffer;
+        auto commandBufferSubmitInfo = VulkanInitializer::CommandBufferSubmitInfo(commandBuffer);
+        auto uploadsFinished = m_UploadManager->Flush(vk::PipelineStageFlagBits2::eAllCommands);
+        vk::SubmitInfo2 submitInfo{};
+        submitInfo.commandBufferInfoCount = 1;
+        submitInfo.pCommandBufferInfos = &commandBufferSubmitInfo;
+        submitInfo.waitSemaphoreInfoCount = 1;
+        submitInfo.pWaitSemaphoreInfos = &uploadsFinished;
 
-        CheckVkResult(m_GraphicsQueue.submit(1, &submitInfo, nullptr));
+        CheckVkResult(m_GraphicsQueue.submit2KHR(1, &submitInfo, nullptr, g_vkDynamicLoader));
         m_GraphicsQueue.waitIdle();
 
         m_Device.freeCommandBuffers(m_CommandPool, 1, &commandBuffer);
     }
 
-    void VulkanGraphicsDevice::CopyBuffer(vk::Buffer srcBuffer, vk::Buffer dstBuffer, vk::DeviceSize size)
-    {
-        vk::CommandBuffer commandBuffer = BeginSingleTimeCommands();
-
-        vk::BufferCopy copyRegion{};
-        copyRegion.srcOffset = 0; // Optional
-        copyRegion.dstOffset = 0; // Optional
-        copyRegion.size = size;
-        commandBuffer.copyBuffer(srcBuffer, dstBuffer, 1, &copyRegion);
-
-        EndSingleTimeCommands(commandBuffer);
-    }
-
-    void VulkanGraphicsDevice::CopyBufferToImage(
-        vk::Buffer buffer, vk::Image image, uint32_t width, uint32_t height, uint32_t layerCount)
-    {
-        vk::CommandBuffer commandBuffer = BeginSingleTimeCommands();
-
-        vk::BufferImageCopy region{};
-        region.bufferOffset = 0;
-        region.bufferRowLength = 0;
-        region.bufferImageHeight = 0;
-
-        region.imageSubresource.aspectMask = vk::ImageAspectFlagBits::eColor;
-        region.imageSubresource.mipLevel = 0;
-        region.imageSubresource.baseArrayLayer = 0;
-        region.imageSubresource.layerCount = layerCount;
-
-        region.imageOffset = vk::Offset3D{0, 0, 0};
-        region.imageExtent = vk::Extent3D{width, height, 1};
-
-        commandBuffer.copyBufferToImage(buffer, image, vk::ImageLayout::eTransferDstOptimal, 1, &region);
-        EndSingleTimeCommands(commandBuffer);
-    }
-
     void VulkanGraphicsDevice::CopyImageToImage(
         vk::CommandBuffer cmd, vk::Image source, vk::Image destination, vk::Extent2D srcSize, vk::Extent2D dstSize)
     {
@@ -1063,8 +1073,10 @@ namespace BeeEngine::Internal
     {
         std::vector<vk::DescriptorPoolSize> poolSizes = {
             {vk::DescriptorType::eUniformBuffer, 1000},
+            {vk::DescriptorType::eUniformBufferDynamic, 1000},
             {vk::DescriptorType::eSampler, 1000},
             {vk::DescriptorType::eSampledImage, 1000},
+            {vk::DescriptorType::eStorageBuffer, 1000},
         };
         vk::DescriptorPoolCreateInfo poolInfo = {};
         poolInfo.flags = vk::DescriptorPoolCreateFlags() | vk::DescriptorPoolCreateFlagBits::eFreeDescriptorSet;
@@ -15,6 +15,7 @@
 namespace BeeEngine::Internal
 {
   class GPU;
+    class VulkanUploadManager;
     class VulkanGraphicsDevice final : public GraphicsDevice
     {
     public:
@@ -34,9 +35,19 @@ namespace BeeEngine::Internal
 
         vk::Queue GetPresentQueue() { return m_PresentQueue; }
 
+        /**
+         * @brief Dedicated transfer queue or the graphics queue, if the device has none
+         */
+        vk::Queue GetTransferQueue() { return m_TransferQueue; }
+
+        VulkanUploadManager& GetUploadManager() { return *m_UploadManager; }
+
         vk::SurfaceKHR GetSurface() { return m_DeviceHandle.surface; }
 
         VulkanSwapChain& GetSwapChain() { return *m_SwapChain; }
+        /**
+         * @brief Records the transition into the current batch of the upload manager without waiting for it
+         */
         void
         TransitionImageLayout(vk::Image image, vk::Format format, vk::ImageLayout oldLayout, vk::ImageLayout newLayout);
         void TransitionImageLayout(vk::CommandBuffer cmd,
@@ -68,7 +79,10 @@ namespace BeeEngine::Internal
 
         void DestroyDescriptorSet(vk::DescriptorSet descriptorSet) const;
         [[nodiscard]] VulkanBuffer
-        CreateBuffer(vk::DeviceSize size, vk::BufferUsageFlags usage, VmaMemoryUsage memoryUsage) const;
+        CreateBuffer(vk::DeviceSize size,
+                     vk::BufferUsageFlags usage,
+                     VmaMemoryUsage memoryUsage,
+                     VmaAllocationCreateFlags allocationFlags = 0) const;
         void DestroyBuffer(VulkanBuffer& buffer) const;
         void DestroyImage(VulkanImage& image) const;
         void DestroyImageWithView(VulkanImage& image, vk::ImageView imageView) const;
@@ -77,12 +91,11 @@ namespace BeeEngine::Internal
 
         vk::CommandBuffer BeginSingleTimeCommands();
 
+        /**
+         * @brief Submits the commands after pending uploads and waits, until the graphics queue is idle
+         */
         void EndSingleTimeCommands(vk::CommandBuffer commandBuffer);
 
-        void CopyBuffer(vk::Buffer srcBuffer, vk::Buffer dstBuffer, vk::DeviceSize size);
-
-        void
-        CopyBufferToImage(vk::Buffer buffer, vk::Image image, uint32_t width, uint32_t height, uint32_t layerCount);
         void CopyImageToImage(
             vk::CommandBuffer cmd, vk::Image source, vk::Image destination, vk::Extent2D srcSize, vk::Extent2D dstSize);
         void CopyImageToImage(vk::Image source, vk::Image destination, vk::Extent2D srcSize, vk::Extent2D dstSize);
@@ -99,6 +112,14 @@ namespace BeeEngine::Internal
                                        vk::FormatFeatureFlags features);
 
         bool HasRayTracingSupport() const { return m_HasRayTracingSupport; }
+        /**
+         * @brief Indirect draws can start at an instance other than zero (drawIndirectFirstInstance)
+         */
+        bool HasIndirectDrawingSupport() const { return m_HasIndirectDrawingSupport; }
+        /**
+         * @brief One indirect draw call can read more than one command (multiDrawIndirect)
+         */
+        bool HasMultiDrawIndirectSupport() const { return m_HasMultiDrawIndirectSupport; }
 
         vk::Viewport CreateVKViewport(uint32_t width, uint32_t height, float depthMin, float depthMax);
 
@@ -111,6 +132,8 @@ namespace BeeEngine::Internal
     private:
         vk::DescriptorPool m_DescriptorPool;
         mutable bool m_HasRayTracingSupport = false;
+        bool m_HasIndirectDrawingSupport = false;
+        bool m_HasMultiDrawIndirectSupport = false;
 
         void CreateCommandPool();
 
@@ -154,6 +177,8 @@ namespace BeeEngine::Internal
         uint64_t m_VRAM = 0;
         vk::Queue m_GraphicsQueue;
         vk::Queue m_PresentQueue;
+        vk::Queue m_TransferQueue;
+        Scope<VulkanUploadManager> m_UploadManager;
 
         // Ref<VulkanPipeline> m_Pipeline;
         vk::CommandBuffer m_MainCommandBuffer;
@@ -5,13 +5,17 @@
 #include "VulkanInstancedBuffer.h"
 
 #include "Renderer/CommandBuffer.h"
+#include "Renderer/RenderingQueue.h"
 
 namespace BeeEngine::Internal
 {
     VulkanInstancedBuffer::VulkanInstancedBuffer(size_t size)
         : m_GraphicsDevice(VulkanGraphicsDevice::GetInstance()), m_Size(size)
     {
-        m_Buffer = m_GraphicsDevice.CreateBuffer(m_Size, vk::BufferUsageFlagBits::eVertexBuffer, VMA_MEMORY_USAGE_AUTO);
+        // Memory stays mapped for the whole lifetime of the buffer, so instances are written into it directly
+        m_Buffer = m_GraphicsDevice.CreateBuffer(
+            m_Size, vk::BufferUsageFlagBits::eVertexBuffer, VMA_MEMORY_USAGE_AUTO, VMA_ALLOCATION_CREATE_MAPPED_BIT);
+        BeeEnsures(m_Buffer.Info.pMappedData);
     }
 
     VulkanInstancedBuffer::~VulkanInstancedBuffer()
@@ -21,14 +25,35 @@ namespace BeeEngine::Internal
 
     void VulkanInstancedBuffer::SetData(void* data, size_t size)
     {
-        BeeExpects(size <= m_Size);
-        m_GraphicsDevice.CopyToBuffer({(byte*)data, size}, m_Buffer);
+        memcpy(BeginWrite(0, size).data(), data, size);
+        EndWrite(0, size);
     }
 
-    void VulkanInstancedBuffer::Bind(CommandBuffer& cmd)
+    gsl::span<byte> VulkanInstancedBuffer::BeginWrite(size_t offset, size_t size)
+    {
+        BeeExpects(offset + size <= m_Size);
+        return {static_cast<byte*>(m_Buffer.Info.pMappedData) + offset, size};
+    }
+
+    void VulkanInstancedBuffer::EndWrite(size_t offset, size_t size)
+    {
+        // No-op for host coherent memory
+        vmaFlushAllocation(GetVulkanAllocator(), m_Buffer.Memory, offset, size);
+        RenderingQueue::CountUploadedBytes(size);
+    }
+
+    void VulkanInstancedBuffer::UpdateRange(size_t offset, gsl::span<const byte> data)
+    {
+        BeeExpects(offset + data.size() <= m_Size);
+        memcpy(static_cast<byte*>(m_Buffer.Info.pMappedData) + offset, data.data(), data.size());
+        vmaFlushAllocation(GetVulkanAllocator(), m_Buffer.Memory, offset, data.size());
+        RenderingQueue::CountUploadedBytes(data.size());
+    }
+
+    void VulkanInstancedBuffer::Bind(CommandBuffer& cmd, size_t offset)
     {
         vk::CommandBuffer commandBuffer = cmd.GetBufferHandleAs<vk::CommandBuffer>();
-        vk::DeviceSize offsets[] = {{0}};
+        vk::DeviceSize offsets[] = {offset};
         commandBuffer.bindVertexBuffers(1, 1, &m_Buffer.Buffer, offsets);
     }
 
@@ -17,8 +17,11 @@ namespace BeeEngine::Internal
         ~VulkanInstancedBuffer() override;
 
         void SetData(void* data, size_t size) override;
+        gsl::span<byte> BeginWrite(size_t offset, size_t size) override;
+        void EndWrite(size_t offset, size_t size) override;
+        void UpdateRange(size_t offset, gsl::span<const byte> data) override;
 
-        void Bind(CommandBuffer& cmd) override;
+        void Bind(CommandBuffer& cmd, size_t offset) override;
 
         size_t GetSize() override;
 
@@ -6,24 +6,34 @@
 
 #include "Hardware.h"
 #include "Renderer/CommandBuffer.h"
+#include "Renderer/Renderer.h"
 #include "Utils.h"
 #include "VulkanGraphicsDevice.h"
+#include "VulkanUploadManager.h"
 
 namespace BeeEngine::Internal
 {
     VulkanMesh::~VulkanMesh()
     {
-        m_Device.DestroyBuffer(m_VertexBuffer);
-        if (VulkanMesh::IsIndexed())
-        {
-            m_Device.DestroyBuffer(m_IndexBuffer);
-        }
-        if (!Hardware::HasRayTracingSupport())
-            return;
-        m_Device.DestroyBuffer(m_AccelerationStructure.Buffer);
-        DeletionQueue::Frame().PushFunction(
-            [accelerationStructure = m_AccelerationStructure.AccelerationStructure, device = m_Device.GetDevice()]()
-            { device.destroyAccelerationStructureKHR(accelerationStructure, nullptr, g_vkDynamicLoader); });
+        // Frames in flight may still draw the mesh, and the build of its acceleration structure is not waited for
+        Renderer::DestroyAfterFramesInFlight(
+            [vertexBuffer = m_VertexBuffer,
+             indexBuffer = m_IndexBuffer,
+             accelerationStructure = m_AccelerationStructure]() mutable
+            {
+                auto& device = VulkanGraphicsDevice::GetInstance();
+                device.DestroyBuffer(vertexBuffer);
+                if (indexBuffer.Buffer)
+                {
+                    device.DestroyBuffer(indexBuffer);
+                }
+                if (accelerationStructure.AccelerationStructure)
+                {
+                    device.GetDevice().destroyAccelerationStructureKHR(
+                        accelerationStructure.AccelerationStructure, nullptr, g_vkDynamicLoader);
+                    device.DestroyBuffer(accelerationStructure.Buffer);
+                }
+            });
     }
 
     uint32_t VulkanMesh::GetVertexCount() const
@@ -90,14 +100,8 @@ namespace BeeEngine::Internal
             usage |= vk::BufferUsageFlagBits::eAccelerationStructureBuildInputReadOnlyKHR;
         }
         m_VertexBuffer = m_Device.CreateBuffer(size, usage, VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE);
-        VulkanBuffer bufferForMapping =
-            m_Device.CreateBuffer(size, vk::BufferUsageFlagBits::eTransferSrc, VMA_MEMORY_USAGE_CPU_TO_GPU);
-        void* mappedData = nullptr;
-        vmaMapMemory(GetVulkanAllocator(), bufferForMapping.Memory, &mappedData);
-        memcpy(mappedData, verticesData, size);
-        vmaUnmapMemory(GetVulkanAllocator(), bufferForMapping.Memory);
-        m_Device.CopyBuffer(bufferForMapping.Buffer, m_VertexBuffer.Buffer, size);
-        m_Device.DestroyBuffer(bufferForMapping);
+        m_Device.GetUploadManager().UploadToBuffer({static_cast<const byte*>(verticesData), size},
+                                                   m_VertexBuffer.Buffer);
     }
 
     void VulkanMesh::CreateIndexBuffer(const std::vector<uint32_t>& indices)
@@ -112,14 +116,8 @@ namespace BeeEngine::Internal
             usage |= vk::BufferUsageFlagBits::eAccelerationStructureBuildInputReadOnlyKHR;
         }
         m_IndexBuffer = m_Device.CreateBuffer(size, usage, VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE);
-        VulkanBuffer bufferForMapping =
-            m_Device.CreateBuffer(size, vk::BufferUsageFlagBits::eTransferSrc, VMA_MEMORY_USAGE_CPU_TO_GPU);
-        void* mappedData = nullptr;
-        vmaMapMemory(GetVulkanAllocator(), bufferForMapping.Memory, &mappedData);
-        memcpy(mappedData, indicesData, size);
-        vmaUnmapMemory(GetVulkanAllocator(), bufferForMapping.Memory);
-        m_Device.CopyBuffer(bufferForMapping.Buffer, m_IndexBuffer.Buffer, size);
-        m_Device.DestroyBuffer(bufferForMapping);
+        m_Device.GetUploadManager().UploadToBuffer({reinterpret_cast<const byte*>(indicesData), size},
+                                                   m_IndexBuffer.Buffer);
     }
 
     void VulkanMesh::CreateAccelerationStructure(size_t vertexStride)
@@ -179,19 +177,6 @@ namespace BeeEngine::Internal
                                                                vk::BufferUsageFlagBits::eShaderDeviceAddress,
                                                            VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE);
 
-        vk::CommandBufferAllocateInfo allocInfo{};
-        allocInfo.commandPool = m_Device.GetCommandPool();
-        allocInfo.level = vk::CommandBufferLevel::ePrimary;
-        allocInfo.commandBufferCount = 1;
-
-        vk::CommandBuffer commandBuffer;
-        CheckVkResult(device.allocateCommandBuffers(&allocInfo, &commandBuffer));
-
-        vk::CommandBufferBeginInfo beginInfo{};
-        beginInfo.flags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit;
-
-        CheckVkResult(commandBuffer.begin(&beginInfo));
-
         buildInfo.setMode(vk::BuildAccelerationStructureModeKHR::eBuild);
         buildInfo.dstAccelerationStructure = m_AccelerationStructure.AccelerationStructure;
         buildInfo.scratchData.deviceAddress = device.getBufferAddress({scratchBuffer.Buffer});
@@ -202,20 +187,24 @@ namespace BeeEngine::Internal
         buildRangeInfo.firstVertex = 0;
         buildRangeInfo.transformOffset = 0;
 
-        commandBuffer.buildAccelerationStructuresKHR(buildInfo, &buildRangeInfo, g_vkDynamicLoader);
-
-        commandBuffer.end();
-
-        vk::SubmitInfo submitInfo{};
-        submitInfo.commandBufferCount = 1;
-        submitInfo.pCommandBuffers = &commandBuffer;
-        auto graphicsQueue = m_Device.GetGraphicsQueue();
-
-        CheckVkResult(graphicsQueue.submit(1, &submitInfo, vk::Fence(nullptr)));
-        graphicsQueue.waitIdle();
-
-        device.freeCommandBuffers(m_Device.GetCommandPool(), commandBuffer);
-
-        m_Device.DestroyBuffer(scratchBuffer);
+        // The build goes into the upload batch after the copies of the vertices and indices, so meshes are created
+        // without waiting for the GPU. Every graphics submission waits for the batch on the timeline semaphore
+        auto& uploadManager = m_Device.GetUploadManager();
+        uploadManager.RecordGraphicsCommands(
+            [&](vk::CommandBuffer cmd)
+            {
+                vk::MemoryBarrier2 barrier{};
+                barrier.srcStageMask = vk::PipelineStageFlagBits2::eTransfer;
+                barrier.srcAccessMask = vk::AccessFlagBits2::eTransferWrite;
+                barrier.dstStageMask = vk::PipelineStageFlagBits2::eAccelerationStructureBuildKHR;
+                barrier.dstAccessMask = vk::AccessFlagBits2::eShaderRead;
+                vk::DependencyInfo dependencyInfo{};
+                dependencyInfo.memoryBarrierCount = 1;
+                dependencyInfo.pMemoryBarriers = &barrier;
+                cmd.pipelineBarrier2(dependencyInfo, g_vkDynamicLoader);
+
+                cmd.buildAccelerationStructuresKHR(buildInfo, &buildRangeInfo, g_vkDynamicLoader);
+            });
+        uploadManager.DestroyAfterCompletion(scratchBuffer);
     }
 } // namespace BeeEngine::Internal
@@ -14,6 +14,8 @@
 #include "Utils.h"
 #include "VulkanFrameBuffer.h"
 #include "VulkanMaterial.h"
+#include "VulkanStorageBuffer.h"
+#include "VulkanUploadManager.h"
 #include <chrono>
 #include <thread>
 #include <vulkan/vulkan.hpp>
@@ -188,10 +190,11 @@ namespace BeeEngine::Internal
                                           Model& model,
                                           InstancedBuffer& instancedBuffer,
                                           const std::vector<BindingSet*>& bindingSets,
-                                          uint32_t instanceCount)
+                                          uint32_t instanceCount,
+                                          size_t instanceDataOffset)
     {
         model.Bind(commandBuffer);
-        instancedBuffer.Bind(commandBuffer);
+        instancedBuffer.Bind(commandBuffer, instanceDataOffset);
         auto cmd = commandBuffer.GetBufferHandleAs<vk::CommandBuffer>();
         int32_t index = 0;
         for (auto& bindingSet : bindingSets)
@@ -204,6 +207,95 @@ namespace BeeEngine::Internal
             cmd.draw(model.GetVertexCount(), instanceCount, 0, 0);
     }
 
+    void VulkanRendererAPI::DrawIndexedIndirect(CommandBuffer& commandBuffer,
+                                                Model& model,
+                                                StorageBuffer& instances,
+                                                const std::vector<BindingSet*>& bindingSets,
+                                                StorageBuffer& commands,
+                                                size_t commandsOffset,
+                                                uint32_t drawCount)
+    {
+        BeeExpects(model.IsIndexed());
+        BeeExpects(m_GraphicsDevice->HasIndirectDrawingSupport());
+        BeeExpects(commandsOffset + drawCount * sizeof(IndirectDrawCommand) <= commands.GetSize());
+        model.Bind(commandBuffer);
+        auto cmd = commandBuffer.GetBufferHandleAs<vk::CommandBuffer>();
+        vk::Buffer instanceBuffer = static_cast<VulkanStorageBuffer&>(instances).GetBuffer();
+        vk::DeviceSize instanceOffset = 0;
+        cmd.bindVertexBuffers(1, 1, &instanceBuffer, &instanceOffset);
+        int32_t index = 0;
+        for (auto& bindingSet : bindingSets)
+        {
+            bindingSet->Bind(commandBuffer, index++, ((VulkanMaterial&)model.GetMaterial()).GetPipeline());
+        }
+        vk::Buffer commandBufferHandle = static_cast<VulkanStorageBuffer&>(commands).GetBuffer();
+        if (m_GraphicsDevice->HasMultiDrawIndirectSupport()) [[likely]]
+        {
+            cmd.drawIndexedIndirect(commandBufferHandle, commandsOffset, drawCount, sizeof(IndirectDrawCommand));
+            return;
+        }
+        for (uint32_t i = 0; i < drawCount; ++i)
+        {
+            cmd.drawIndexedIndirect(
+                commandBufferHandle, commandsOffset + i * sizeof(IndirectDrawCommand), 1, sizeof(IndirectDrawCommand));
+        }
+    }
+
+    void VulkanRendererAPI::Dispatch(Pipeline& computePipeline,
+                                     const std::vector<BindingSet*>& bindingSets,
+                                     uint32_t groupCountX)
+    {
+        BeeExpects(computePipeline.GetType() == PipelineType::Compute);
+        BeeExpects(groupCountX > 0);
+        // Draws of the frame are recorded inside of render passes, which can not contain dispatches,
+        // so the dispatch goes into the upload batch, that every graphics submission waits for
+        m_GraphicsDevice->GetUploadManager().RecordGraphicsCommands(
+            [&](vk::CommandBuffer cmd)
+            {
+                // Draws of the previous frames may still read the buffers, that are written now
+                vk::MemoryBarrier2 before{};
+                before.srcStageMask = vk::PipelineStageFlagBits2::eDrawIndirect |
+                                      vk::PipelineStageFlagBits2::eVertexAttributeInput |
+                                      vk::PipelineStageFlagBits2::eComputeShader;
+                before.srcAccessMask = vk::AccessFlagBits2::eShaderStorageWrite;
+                before.dstStageMask = vk::PipelineStageFlagBits2::eComputeShader;
+                before.dstAccessMask =
+                    vk::AccessFlagBits2::eShaderStorageRead | vk::AccessFlagBits2::eShaderStorageWrite;
+                vk::DependencyInfo beforeInfo{};
+                beforeInfo.memoryBarrierCount = 1;
+                beforeInfo.pMemoryBarriers = &before;
+                cmd.pipelineBarrier2(beforeInfo, g_vkDynamicLoader);
+
+                CommandBuffer commandBuffer{cmd, nullptr};
+                computePipeline.Bind(commandBuffer);
+                int32_t index = 0;
+                for (auto& bindingSet : bindingSets)
+                {
+                    bindingSet->Bind(commandBuffer, index++, computePipeline);
+                }
+                cmd.dispatch(groupCountX, 1, 1);
+
+                vk::MemoryBarrier2 after{};
+                after.srcStageMask = vk::PipelineStageFlagBits2::eComputeShader;
+                after.srcAccessMask = vk::AccessFlagBits2::eShaderStorageWrite;
+                after.dstStageMask = vk::PipelineStageFlagBits2::eDrawIndirect |
+                                     vk::PipelineStageFlagBits2::eVertexAttributeInput |
+                                     vk::PipelineStageFlagBits2::eComputeShader;
+                after.dstAccessMask = vk::AccessFlagBits2::eIndirectCommandRead |
+                                      vk::AccessFlagBits2::eVertexAttributeRead |
+                                      vk::AccessFlagBits2::eShaderStorageRead;
+                vk::DependencyInfo afterInfo{};
+                afterInfo.memoryBarrierCount = 1;
+                afterInfo.pMemoryBarriers = &after;
+                cmd.pipelineBarrier2(afterInfo, g_vkDynamicLoader);
+            });
+    }
+
+    bool VulkanRendererAPI::SupportsIndirectDrawing() const
+    {
+        return m_GraphicsDevice->HasIndirectDrawingSupport();
+    }
+
     void VulkanRendererAPI::SubmitCommandBuffer(const CommandBuffer& commandBuffer)
     {
         auto& swapchain = m_GraphicsDevice->GetSwapChain();
@@ -35,7 +35,22 @@ namespace BeeEngine::Internal
                            Model& model,
                            InstancedBuffer& instancedBuffer,
                            const std::vector<BindingSet*>& bindingSets,
-                           uint32_t instanceCount) override;
+                           uint32_t instanceCount,
+                           size_t instanceDataOffset) override;
+
+        void DrawIndexedIndirect(CommandBuffer& commandBuffer,
+                                 Model& model,
+                                 StorageBuffer& instances,
+                                 const std::vector<BindingSet*>& bindingSets,
+                                 StorageBuffer& commands,
+                                 size_t commandsOffset,
+                                 uint32_t drawCount) override;
+
+        void Dispatch(Pipeline& computePipeline,
+                      const std::vector<BindingSet*>& bindingSets,
+                      uint32_t groupCountX) override;
+
+        [[nodiscard]] bool SupportsIndirectDrawing() const override;
 
         void SubmitCommandBuffer(const CommandBuffer& commandBuffer) override;
 
@@ -112,10 +112,13 @@ namespace BeeEngine::Internal
         {
             case ShaderUniformDataType::Sampler:
                 return vk::DescriptorType::eSampler;
+            // Uniform buffers select their current data with dynamic offsets
             case ShaderUniformDataType::Data:
-                return vk::DescriptorType::eUniformBuffer;
+                return vk::DescriptorType::eUniformBufferDynamic;
             case ShaderUniformDataType::SampledTexture:
                 return vk::DescriptorType::eSampledImage;
+            case ShaderUniformDataType::StorageBuffer:
+                return vk::DescriptorType::eStorageBuffer;
             case ShaderUniformDataType::Unknown:
             default:
                 BeeCoreError("Unknown ShaderUniformDataType");
@@ -0,0 +1,85 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#include "VulkanStorageBuffer.h"
+#include "Renderer/RenderingQueue.h"
+#include <cstring>
+
+namespace BeeEngine::Internal
+{
+    VulkanStorageBuffer::VulkanStorageBuffer(size_t size, StorageBufferUsage usage)
+        : m_GraphicsDevice(VulkanGraphicsDevice::GetInstance()), m_Size(size), m_Usage(usage)
+    {
+        const vk::BufferUsageFlags bufferUsage =
+            vk::BufferUsageFlagBits::eStorageBuffer | vk::BufferUsageFlagBits::eIndirectBuffer |
+            vk::BufferUsageFlagBits::eVertexBuffer | vk::BufferUsageFlagBits::eTransferSrc;
+        if (m_Usage == StorageBufferUsage::CPUToGPU)
+        {
+            // Memory stays mapped, so the data is written into it directly
+            m_Buffer = m_GraphicsDevice.CreateBuffer(
+                m_Size, bufferUsage, VMA_MEMORY_USAGE_AUTO, VMA_ALLOCATION_CREATE_MAPPED_BIT);
+            BeeEnsures(m_Buffer.Info.pMappedData);
+        }
+        else
+        {
+            m_Buffer = m_GraphicsDevice.CreateBuffer(m_Size, bufferUsage, VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE);
+        }
+        m_DescriptorBufferInfo.buffer = m_Buffer.Buffer;
+        m_DescriptorBufferInfo.offset = 0;
+        m_DescriptorBufferInfo.range = m_Size;
+    }
+
+    VulkanStorageBuffer::~VulkanStorageBuffer()
+    {
+        m_GraphicsDevice.DestroyBuffer(m_Buffer);
+    }
+
+    std::vector<IBindable::BindGroupLayoutEntryType> VulkanStorageBuffer::GetBindGroupLayoutEntry() const
+    {
+        vk::DescriptorSetLayoutBinding layoutBinding(
+            0, vk::DescriptorType::eStorageBuffer, 1, vk::ShaderStageFlagBits::eCompute);
+        return {layoutBinding};
+    }
+
+    std::vector<IBindable::BindGroupEntryType> VulkanStorageBuffer::GetBindGroupEntry() const
+    {
+        vk::WriteDescriptorSet bufferWrite = {};
+        bufferWrite.dstSet = nullptr;
+        bufferWrite.dstBinding = 0;
+        bufferWrite.dstArrayElement = 0;
+        bufferWrite.descriptorType = vk::DescriptorType::eStorageBuffer;
+        bufferWrite.descriptorCount = 1;
+        bufferWrite.pBufferInfo = &m_DescriptorBufferInfo;
+        return {bufferWrite};
+    }
+
+    void VulkanStorageBuffer::SetData(size_t offset, gsl::span<const byte> data)
+    {
+        BeeExpects(m_Usage == StorageBufferUsage::CPUToGPU);
+        BeeExpects(offset + data.size() <= m_Size);
+        memcpy(static_cast<byte*>(m_Buffer.Info.pMappedData) + offset, data.data(), data.size());
+        vmaFlushAllocation(GetVulkanAllocator(), m_Buffer.Memory, offset, data.size());
+        RenderingQueue::CountUploadedBytes(data.size());
+    }
+
+    std::vector<byte> VulkanStorageBuffer::ReadData()
+    {
+        VulkanBuffer readback = m_GraphicsDevice.CreateBuffer(
+            m_Size,
+            vk::BufferUsageFlagBits::eTransferDst,
+            VMA_MEMORY_USAGE_AUTO_PREFER_HOST,
+            VMA_ALLOCATION_CREATE_MAPPED_BIT | VMA_ALLOCATION_CREATE_HOST_ACCESS_RANDOM_BIT);
+        // Pending compute passes are submitted before the copy, that waits for them and for the queue
+        auto cmd = m_GraphicsDevice.BeginSingleTimeCommands();
+        vk::BufferCopy region{0, 0, m_Size};
+        cmd.copyBuffer(m_Buffer.Buffer, readback.Buffer, 1, &region);
+        m_GraphicsDevice.EndSingleTimeCommands(cmd);
+
+        vmaInvalidateAllocation(GetVulkanAllocator(), readback.Memory, 0, m_Size);
+        std::vector<byte> result(m_Size);
+        memcpy(result.data(), readback.Info.pMappedData, m_Size);
+        m_GraphicsDevice.DestroyBuffer(readback);
+        return result;
+    }
+} // namespace BeeEngine::Internal
@@ -0,0 +1,39 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#pragma once
+#include "Renderer/StorageBuffer.h"
+#include "VulkanBuffer.h"
+#include "VulkanGraphicsDevice.h"
+
+namespace BeeEngine::Internal
+{
+    class VulkanStorageBuffer final : public StorageBuffer
+    {
+    public:
+        VulkanStorageBuffer(size_t size, StorageBufferUsage usage);
+        ~VulkanStorageBuffer() override;
+
+        /**
+         * @brief Storage buffers are bound to compute shaders only
+         */
+        std::vector<IBindable::BindGroupLayoutEntryType> GetBindGroupLayoutEntry() const override;
+
+        std::vector<IBindable::BindGroupEntryType> GetBindGroupEntry() const override;
+
+        void SetData(size_t offset, gsl::span<const byte> data) override;
+        std::vector<byte> ReadData() override;
+        size_t GetSize() const override { return m_Size; }
+        StorageBufferUsage GetUsage() const override { return m_Usage; }
+
+        [[nodiscard]] vk::Buffer GetBuffer() const { return m_Buffer.Buffer; }
+
+    private:
+        VulkanGraphicsDevice& m_GraphicsDevice;
+        size_t m_Size;
+        StorageBufferUsage m_Usage;
+        VulkanBuffer m_Buffer;
+        vk::DescriptorBufferInfo m_DescriptorBufferInfo;
+    };
+} // namespace BeeEngine::Internal
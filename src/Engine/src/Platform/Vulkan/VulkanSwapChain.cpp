@@ -2,12 +2,15 @@
 // Created by alexl on 09.06.2023.
 //
 #include "Utils.h"
+#include <algorithm>
 #include <array>
 #include <vulkan/vulkan_handles.hpp>
 #if defined(BEE_COMPILE_VULKAN)
 #include "Core/Logging/Log.h"
+#include "Renderer/Renderer.h"
 #include "VulkanGraphicsDevice.h"
 #include "VulkanSwapChain.h"
+#include "VulkanUploadManager.h"
 #include "Windowing/WindowHandler/WindowHandler.h"
 #if defined(BEE_COMPILE_SDL)
 #include "SDL3/SDL_vulkan.h"
@@ -159,8 +162,11 @@ namespace BeeEngine::Internal
 
         vk::SubmitInfo2 submitInfo = {};
 
-        auto semaphoreSubmitInfo = VulkanInitializer::SemaphoreSubmitInfo(
-            m_ImageAvailableSemaphores[m_CurrentFrame], vk::PipelineStageFlagBits2::eColorAttachmentOutput);
+        std::array<vk::SemaphoreSubmitInfo, 2> waitSemaphoreInfos = {
+            VulkanInitializer::SemaphoreSubmitInfo(m_ImageAvailableSemaphores[m_CurrentFrame],
+                                                   vk::PipelineStageFlagBits2::eColorAttachmentOutput),
+            // Resources, that are drawn this frame, may still be uploading
+            m_GraphicsDevice.GetUploadManager().Flush(vk::PipelineStageFlagBits2::eAllCommands)};
         std::vector<vk::CommandBufferSubmitInfo> commandBufferSubmitInfos;
         commandBufferSubmitInfos.reserve(count);
         for (size_t i = 0; i < count; i++)
@@ -169,8 +175,8 @@ namespace BeeEngine::Internal
         }
         submitInfo.commandBufferInfoCount = static_cast<uint32_t>(commandBufferSubmitInfos.size());
         submitInfo.pCommandBufferInfos = commandBufferSubmitInfos.data();
-        submitInfo.waitSemaphoreInfoCount = 1;
-        submitInfo.pWaitSemaphoreInfos = &semaphoreSubmitInfo;
+        submitInfo.waitSemaphoreInfoCount = static_cast<uint32_t>(waitSemaphoreInfos.size());
+        submitInfo.pWaitSemaphoreInfos = waitSemaphoreInfos.data();
 
         submitInfo.signalSemaphoreInfoCount = 1;
         auto signalSemaphoreSubmitInfo = VulkanInitializer::SemaphoreSubmitInfo(
@@ -222,7 +228,9 @@ namespace BeeEngine::Internal
             imageCount = swapChainSupport.capabilities.maxImageCount;
         }
 
-        m_MaxFrames = imageCount;
+        // Engine reuses per-frame data after Renderer::FramesInFlight frames, so the CPU must not get further ahead.
+        // Images, that are still presented, are waited for separately in m_ImagesInFlight
+        m_MaxFrames = std::min(imageCount, Renderer::FramesInFlight);
 
         vk::SwapchainCreateInfoKHR createInfo = {};
         createInfo.sType = vk::StructureType::eSwapchainCreateInfoKHR;
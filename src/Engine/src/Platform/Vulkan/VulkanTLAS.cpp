@@ -13,10 +13,10 @@ namespace BeeEngine::Internal
 
     VulkanTLAS::~VulkanTLAS() {}
 
-    void VulkanTLAS::UpdateInstances(std::vector<SceneTreeRenderer::Entity>&& entities) {}
+    void VulkanTLAS::UpdateInstances(SceneTreeRenderer::EntityList&& entities) {}
 
     std::vector<vk::AccelerationStructureInstanceKHR>
-    VulkanTLAS::GenerateInstancedData(std::vector<SceneTreeRenderer::Entity>&& entities)
+    VulkanTLAS::GenerateInstancedData(SceneTreeRenderer::EntityList&& entities)
     {
         std::vector<vk::AccelerationStructureInstanceKHR> instances;
         instances.reserve(entities.size());
@@ -16,11 +16,11 @@ namespace BeeEngine::Internal
         VulkanTLAS();
         ~VulkanTLAS() override;
 
-        void UpdateInstances(std::vector<SceneTreeRenderer::Entity>&& entities) final;
+        void UpdateInstances(SceneTreeRenderer::EntityList&& entities) final;
 
     private:
         std::vector<vk::AccelerationStructureInstanceKHR>
-        GenerateInstancedData(std::vector<SceneTreeRenderer::Entity>&& entities);
+        GenerateInstancedData(SceneTreeRenderer::EntityList&& entities);
 
     private:
         VulkanGraphicsDevice& m_Device;
@@ -3,24 +3,12 @@
 //
 
 #include "VulkanTexture2D.h"
+#include "VulkanUploadManager.h"
 
 #include "backends/imgui_impl_vulkan.h"
 
 namespace BeeEngine::Internal
 {
-    void VulkanGPUTextureResource::CopyBufferToImageWithTransition(VulkanBuffer& buffer)
-    {
-        m_Device.TransitionImageLayout(m_Image.Image,
-                                       vk::Format::eR8G8B8A8Unorm,
-                                       vk::ImageLayout::eUndefined,
-                                       vk::ImageLayout::eTransferDstOptimal);
-        m_Device.CopyBufferToImage(buffer.Buffer, m_Image.Image, m_Width, m_Height, 1);
-        m_Device.TransitionImageLayout(m_Image.Image,
-                                       vk::Format::eR8G8B8A8Unorm,
-                                       vk::ImageLayout::eTransferDstOptimal,
-                                       vk::ImageLayout::eShaderReadOnlyOptimal);
-    }
-
     std::vector<IBindable::BindGroupLayoutEntryType> VulkanGPUTextureResource::GetBindGroupLayoutEntry() const
     {
         vk::DescriptorSetLayoutBinding uboLayoutBinding;
@@ -79,15 +67,8 @@ namespace BeeEngine::Internal
             std::memcpy(dataWithAlpha.data(), data.data(), data.size());
         }
         size_t imageSize = m_Width * m_Height * 4;
-        VulkanBuffer buffer =
-            m_Device.CreateBuffer(imageSize, vk::BufferUsageFlagBits::eTransferSrc, VMA_MEMORY_USAGE_CPU_TO_GPU);
-        void* mappedData = nullptr;
-        if (vmaMapMemory(GetVulkanAllocator(), buffer.Memory, &mappedData) != VK_SUCCESS)
-        {
-            BeeCoreError("Failed to map memory");
-        }
-        std::memcpy(mappedData, dataWithAlpha.data(), imageSize);
-        vmaUnmapMemory(GetVulkanAllocator(), buffer.Memory);
+        gsl::span<const std::byte> pixels{dataWithAlpha.data(), imageSize};
+        auto& uploadManager = m_Device.GetUploadManager();
         if (!ShouldFreeResources())
         {
             vk::ImageCreateInfo imageCreateInfo;
@@ -121,7 +102,7 @@ namespace BeeEngine::Internal
                                          m_Image,
                                          m_ImageView);
 
-            CopyBufferToImageWithTransition(buffer);
+            uploadManager.UploadToImage(pixels, m_Image.Image, vk::Format::eR8G8B8A8Unorm, m_Width, m_Height);
 
             vk::SamplerCreateInfo samplerCreateInfo;
             samplerCreateInfo.sType = vk::StructureType::eSamplerCreateInfo;
@@ -146,10 +127,10 @@ namespace BeeEngine::Internal
         }
         else
         {
-            CopyBufferToImageWithTransition(buffer);
+            // The image may still be sampled by frames in flight
+            m_Device.GetGraphicsQueue().waitIdle();
+            uploadManager.UploadToImage(pixels, m_Image.Image, vk::Format::eR8G8B8A8Unorm, m_Width, m_Height);
         }
-        // buffer.Destroy();
-        m_Device.DestroyBuffer(buffer);
 
         m_ImageInfo.imageLayout = vk::ImageLayout::eShaderReadOnlyOptimal;
         m_ImageInfo.imageView = m_ImageView;
@@ -28,7 +28,6 @@ namespace BeeEngine::Internal
     private:
         void FreeResources();
         bool ShouldFreeResources();
-        void CopyBufferToImageWithTransition(VulkanBuffer& buffer);
 
         VulkanGraphicsDevice& m_Device;
         VulkanImage m_Image{};
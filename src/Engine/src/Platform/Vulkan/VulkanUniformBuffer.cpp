@@ -3,23 +3,46 @@
 //
 
 #include "VulkanUniformBuffer.h"
+#include "Renderer/Renderer.h"
+#include "Renderer/RenderingQueue.h"
 
 namespace BeeEngine::Internal
 {
     VulkanUniformBuffer::VulkanUniformBuffer(size_t size)
-        : m_Size(size), m_GraphicsDevice(VulkanGraphicsDevice::GetInstance())
+        : VulkanUniformBuffer(size, 1, Renderer::FramesInFlight * VersionsPerFrame)
     {
-        m_Buffer =
-            m_GraphicsDevice.CreateBuffer(size, vk::BufferUsageFlagBits::eUniformBuffer, VMA_MEMORY_USAGE_CPU_TO_GPU);
-        m_DescriptorBufferInfo.buffer = m_Buffer.Buffer;
+    }
+
+    VulkanUniformBuffer::VulkanUniformBuffer(size_t elementSize, uint32_t elementCount, uint32_t versionCount)
+        : m_Size(elementSize),
+          m_ElementCount(elementCount),
+          m_VersionCount(versionCount),
+          m_GraphicsDevice(VulkanGraphicsDevice::GetInstance())
+    {
+        BeeExpects(elementCount == 1 || versionCount == 1);
+        const auto alignment = m_GraphicsDevice.properties.limits.minUniformBufferOffsetAlignment;
+        m_Stride = static_cast<uint32_t>((elementSize + alignment - 1) / alignment * alignment);
+        CreateBuffer();
         m_DescriptorBufferInfo.offset = 0;
-        m_DescriptorBufferInfo.range = size;
+        m_DescriptorBufferInfo.range = elementSize;
+    }
+
+    void VulkanUniformBuffer::CreateBuffer()
+    {
+        // Memory stays mapped, so new versions and elements are written without mapping it every time
+        const auto size = static_cast<vk::DeviceSize>(m_Stride) * m_ElementCount * m_VersionCount;
+        m_Buffer = m_GraphicsDevice.CreateBuffer(size,
+                                                 vk::BufferUsageFlagBits::eUniformBuffer,
+                                                 VMA_MEMORY_USAGE_AUTO,
+                                                 VMA_ALLOCATION_CREATE_MAPPED_BIT);
+        BeeEnsures(m_Buffer.Info.pMappedData);
+        m_DescriptorBufferInfo.buffer = m_Buffer.Buffer;
     }
 
     std::vector<IBindable::BindGroupLayoutEntryType> VulkanUniformBuffer::GetBindGroupLayoutEntry() const
     {
         vk::DescriptorSetLayoutBinding layoutBinding(0,
-                                                     vk::DescriptorType::eUniformBuffer,
+                                                     vk::DescriptorType::eUniformBufferDynamic,
                                                      1,
                                                      vk::ShaderStageFlagBits::eVertex |
                                                          vk::ShaderStageFlagBits::eFragment);
@@ -32,7 +55,7 @@ namespace BeeEngine::Internal
         bufferWrite.dstSet = nullptr;
         bufferWrite.dstBinding = 0;
         bufferWrite.dstArrayElement = 0;
-        bufferWrite.descriptorType = vk::DescriptorType::eUniformBuffer;
+        bufferWrite.descriptorType = vk::DescriptorType::eUniformBufferDynamic;
         bufferWrite.descriptorCount = 1;
         bufferWrite.pBufferInfo = &m_DescriptorBufferInfo;
         return {bufferWrite};
@@ -46,6 +69,48 @@ namespace BeeEngine::Internal
     void VulkanUniformBuffer::SetData(const void* data, size_t size)
     {
         BeeExpects(size == m_Size && data != nullptr);
-        m_GraphicsDevice.CopyToBuffer({(byte*)data, size}, m_Buffer);
+        BeeExpects(m_ElementCount == 1 && m_VersionCount >= Renderer::FramesInFlight);
+        const uint64_t frame = Renderer::GetFrameNumber();
+        if (frame != m_LastWrittenFrame)
+        {
+            m_LastWrittenFrame = frame;
+            m_WritesThisFrame = 0;
+        }
+        // Versions of a frame are reused after FramesInFlight frames, when the GPU has finished reading them
+        uint32_t versionsPerFrame = m_VersionCount / Renderer::FramesInFlight;
+        if (m_WritesThisFrame == versionsPerFrame)
+        {
+            // E.g. more cameras than usual. Versions, that were written before, stay in the old buffer, until
+            // the frames, which read them, are completed. Binding sets switch to the new one on the next bind
+            Renderer::DestroyAfterFramesInFlight([buffer = m_Buffer]() mutable
+                                                 { VulkanGraphicsDevice::GetInstance().DestroyBuffer(buffer); });
+            m_VersionCount *= 2;
+            versionsPerFrame *= 2;
+            CreateBuffer();
+            ++m_Generation;
+        }
+        m_Version = static_cast<uint32_t>(frame % Renderer::FramesInFlight) * versionsPerFrame +
+                    m_WritesThisFrame;
+        ++m_WritesThisFrame;
+        Write(static_cast<size_t>(m_Version) * m_Stride, data, size);
+    }
+
+    void VulkanUniformBuffer::SetElement(uint32_t index, const void* data, size_t size)
+    {
+        BeeExpects(index < m_ElementCount && size == m_Size && data != nullptr);
+        Write(GetElementOffset(index), data, size);
+    }
+
+    uint32_t VulkanUniformBuffer::GetElementOffset(uint32_t index) const
+    {
+        BeeExpects(index < m_ElementCount);
+        return index * m_Stride;
+    }
+
+    void VulkanUniformBuffer::Write(size_t offset, const void* data, size_t size)
+    {
+        memcpy(static_cast<byte*>(m_Buffer.Info.pMappedData) + offset, data, size);
+        vmaFlushAllocation(GetVulkanAllocator(), m_Buffer.Memory, offset, size);
+        RenderingQueue::CountUploadedBytes(size);
     }
 } // namespace BeeEngine::Internal
@@ -13,19 +13,40 @@ namespace BeeEngine::Internal
     class VulkanUniformBuffer final : public UniformBuffer
     {
     public:
+        // Number of SetData calls per frame, that don't overwrite data, which the GPU may still read.
+        // The buffer grows, when a frame needs more
+        static constexpr uint32_t VersionsPerFrame = 4;
+
         VulkanUniformBuffer(size_t size);
+        VulkanUniformBuffer(size_t elementSize, uint32_t elementCount, uint32_t versionCount);
 
         std::vector<IBindable::BindGroupLayoutEntryType> GetBindGroupLayoutEntry() const override;
 
         std::vector<IBindable::BindGroupEntryType> GetBindGroupEntry() const override;
 
+        uint32_t GetDynamicOffset() const override { return m_Version * m_Stride; }
+        uint32_t GetResourceGeneration() const override { return m_Generation; }
+
         ~VulkanUniformBuffer() override;
 
         void SetData(const void* data, size_t size) override;
+        void SetElement(uint32_t index, const void* data, size_t size) override;
+        uint32_t GetElementOffset(uint32_t index) const override;
 
     private:
+        void CreateBuffer();
+        void Write(size_t offset, const void* data, size_t size);
+
         VulkanBuffer m_Buffer;
         size_t m_Size;
+        // Size of an element or a version, aligned for dynamic offsets
+        uint32_t m_Stride;
+        uint32_t m_ElementCount;
+        uint32_t m_VersionCount;
+        uint32_t m_Version = 0;
+        uint32_t m_WritesThisFrame = 0;
+        uint64_t m_LastWrittenFrame = 0;
+        uint32_t m_Generation = 0;
         VulkanGraphicsDevice& m_GraphicsDevice;
         vk::DescriptorBufferInfo m_DescriptorBufferInfo;
     };
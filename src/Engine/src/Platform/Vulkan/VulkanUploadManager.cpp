@@ -0,0 +1,363 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#include "VulkanUploadManager.h"
+#include "Core/CodeSafety/Expects.h"
+#include "Utils.h"
+#include "VulkanGraphicsDevice.h"
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace BeeEngine::Internal
+{
+    VulkanUploadManager::VulkanUploadManager(VulkanGraphicsDevice& device)
+        : m_GraphicsDevice(device),
+          m_Device(device.GetDevice()),
+          m_GraphicsFamily(device.GetQueueFamilyIndices().GraphicsFamily.value()),
+          m_TransferFamily(device.GetQueueFamilyIndices().TransferFamily.value_or(m_GraphicsFamily)),
+          m_TransferQueue(device.GetTransferQueue()),
+          m_GraphicsQueue(device.GetGraphicsQueue()),
+          m_StagingRing(StagingBufferSize),
+          m_StagingAlignment(
+              std::max<vk::DeviceSize>(16, device.properties.limits.optimalBufferCopyOffsetAlignment))
+    {
+        vk::CommandPoolCreateInfo commandPoolCreateInfo = {};
+        commandPoolCreateInfo.flags = vk::CommandPoolCreateFlagBits::eTransient;
+        commandPoolCreateInfo.queueFamilyIndex = m_GraphicsFamily;
+        m_GraphicsCommandPool = m_Device.createCommandPool(commandPoolCreateInfo);
+        if (HasDedicatedTransferQueue())
+        {
+            commandPoolCreateInfo.queueFamilyIndex = m_TransferFamily;
+            m_TransferCommandPool = m_Device.createCommandPool(commandPoolCreateInfo);
+        }
+        else
+        {
+            m_TransferCommandPool = m_GraphicsCommandPool;
+        }
+
+        vk::SemaphoreTypeCreateInfo semaphoreTypeCreateInfo = {};
+        semaphoreTypeCreateInfo.semaphoreType = vk::SemaphoreType::eTimeline;
+        semaphoreTypeCreateInfo.initialValue = 0;
+        vk::SemaphoreCreateInfo semaphoreCreateInfo = {};
+        semaphoreCreateInfo.pNext = &semaphoreTypeCreateInfo;
+        m_TimelineSemaphore = m_Device.createSemaphore(semaphoreCreateInfo);
+
+        m_StagingBuffer = device.CreateBuffer(StagingBufferSize,
+                                              vk::BufferUsageFlagBits::eTransferSrc,
+                                              VMA_MEMORY_USAGE_AUTO,
+                                              VMA_ALLOCATION_CREATE_MAPPED_BIT);
+        BeeEnsures(m_StagingBuffer.Info.pMappedData);
+        BeeCoreInfo("Uploads are submitted on {} queue",
+                    HasDedicatedTransferQueue() ? "a dedicated transfer" : "the graphics");
+    }
+
+    VulkanUploadManager::~VulkanUploadManager()
+    {
+        WaitIdle();
+        m_GraphicsDevice.DestroyBuffer(m_StagingBuffer);
+        m_Device.destroySemaphore(m_TimelineSemaphore);
+        if (HasDedicatedTransferQueue())
+        {
+            m_Device.destroyCommandPool(m_TransferCommandPool);
+        }
+        m_Device.destroyCommandPool(m_GraphicsCommandPool);
+    }
+
+    void VulkanUploadManager::UploadToBuffer(gsl::span<const byte> data,
+                                             vk::Buffer destination,
+                                             vk::DeviceSize destinationOffset)
+    {
+        std::lock_guard lock(m_Mutex);
+        auto staging = Stage(data);
+        auto cmd = GetTransferCommands();
+        vk::BufferCopy copyRegion{};
+        copyRegion.srcOffset = staging.Offset;
+        copyRegion.dstOffset = destinationOffset;
+        copyRegion.size = data.size();
+        cmd.copyBuffer(staging.Buffer, destination, 1, &copyRegion);
+        if (!HasDedicatedTransferQueue())
+        {
+            // Made visible by the wait for the timeline semaphore
+            return;
+        }
+        // Ownership of the buffer is released by the transfer queue and acquired by the graphics queue
+        vk::BufferMemoryBarrier2 barrier{};
+        barrier.srcQueueFamilyIndex = m_TransferFamily;
+        barrier.dstQueueFamilyIndex = m_GraphicsFamily;
+        barrier.buffer = destination;
+        barrier.offset = destinationOffset;
+        barrier.size = data.size();
+        vk::DependencyInfo dependencyInfo{};
+        dependencyInfo.bufferMemoryBarrierCount = 1;
+        dependencyInfo.pBufferMemoryBarriers = &barrier;
+
+        barrier.srcStageMask = vk::PipelineStageFlagBits2::eTransfer;
+        barrier.srcAccessMask = vk::AccessFlagBits2::eTransferWrite;
+        cmd.pipelineBarrier2(dependencyInfo, g_vkDynamicLoader);
+
+        barrier.srcStageMask = vk::PipelineStageFlagBits2::eNone;
+        barrier.srcAccessMask = vk::AccessFlagBits2::eNone;
+        barrier.dstStageMask = vk::PipelineStageFlagBits2::eAllCommands;
+        barrier.dstAccessMask = vk::AccessFlagBits2::eMemoryRead;
+        GetGraphicsCommands().pipelineBarrier2(dependencyInfo, g_vkDynamicLoader);
+    }
+
+    void VulkanUploadManager::UploadToImage(
+        gsl::span<const byte> data, vk::Image image, vk::Format format, uint32_t width, uint32_t height)
+    {
+        std::lock_guard lock(m_Mutex);
+        auto staging = Stage(data);
+        auto cmd = GetTransferCommands();
+        m_GraphicsDevice.TransitionImageLayout(
+            cmd, image, format, vk::ImageLayout::eUndefined, vk::ImageLayout::eTransferDstOptimal);
+
+        vk::BufferImageCopy region{};
+        region.bufferOffset = staging.Offset;
+        region.bufferRowLength = 0;
+        region.bufferImageHeight = 0;
+        region.imageSubresource.aspectMask = vk::ImageAspectFlagBits::eColor;
+        region.imageSubresource.mipLevel = 0;
+        region.imageSubresource.baseArrayLayer = 0;
+        region.imageSubresource.layerCount = 1;
+        region.imageOffset = vk::Offset3D{0, 0, 0};
+        region.imageExtent = vk::Extent3D{width, height, 1};
+        cmd.copyBufferToImage(staging.Buffer, image, vk::ImageLayout::eTransferDstOptimal, 1, &region);
+
+        if (!HasDedicatedTransferQueue())
+        {
+            m_GraphicsDevice.TransitionImageLayout(
+                cmd, image, format, vk::ImageLayout::eTransferDstOptimal, vk::ImageLayout::eShaderReadOnlyOptimal);
+            return;
+        }
+        // The layout is changed by the pair of release and acquire barriers, that transfer the ownership
+        vk::ImageMemoryBarrier2 barrier{};
+        barrier.oldLayout = vk::ImageLayout::eTransferDstOptimal;
+        barrier.newLayout = vk::ImageLayout::eShaderReadOnlyOptimal;
+        barrier.srcQueueFamilyIndex = m_TransferFamily;
+        barrier.dstQueueFamilyIndex = m_GraphicsFamily;
+        barrier.image = image;
+        barrier.subresourceRange.aspectMask = vk::ImageAspectFlagBits::eColor;
+        barrier.subresourceRange.baseMipLevel = 0;
+        barrier.subresourceRange.levelCount = 1;
+        barrier.subresourceRange.baseArrayLayer = 0;
+        barrier.subresourceRange.layerCount = 1;
+        vk::DependencyInfo dependencyInfo{};
+        dependencyInfo.imageMemoryBarrierCount = 1;
+        dependencyInfo.pImageMemoryBarriers = &barrier;
+
+        barrier.srcStageMask = vk::PipelineStageFlagBits2::eTransfer;
+        barrier.srcAccessMask = vk::AccessFlagBits2::eTransferWrite;
+        cmd.pipelineBarrier2(dependencyInfo, g_vkDynamicLoader);
+
+        barrier.srcStageMask = vk::PipelineStageFlagBits2::eNone;
+        barrier.srcAccessMask = vk::AccessFlagBits2::eNone;
+        barrier.dstStageMask = vk::PipelineStageFlagBits2::eAllCommands;
+        barrier.dstAccessMask = vk::AccessFlagBits2::eShaderRead;
+        GetGraphicsCommands().pipelineBarrier2(dependencyInfo, g_vkDynamicLoader);
+    }
+
+    void VulkanUploadManager::TransitionImageLayout(vk::Image image,
+                                                    vk::Format format,
+                                                    vk::ImageLayout oldLayout,
+                                                    vk::ImageLayout newLayout)
+    {
+        std::lock_guard lock(m_Mutex);
+        m_GraphicsDevice.TransitionImageLayout(GetGraphicsCommands(), image, format, oldLayout, newLayout);
+    }
+
+    void VulkanUploadManager::DestroyAfterCompletion(const VulkanBuffer& buffer)
+    {
+        std::lock_guard lock(m_Mutex);
+        if (m_CurrentBatch.TransferCommands || m_CurrentBatch.GraphicsCommands)
+        {
+            m_CurrentBatch.Buffers.push_back(buffer);
+        }
+        else if (!m_InFlightBatches.empty())
+        {
+            // The commands were submitted with the last batch
+            m_InFlightBatches.back().Buffers.push_back(buffer);
+        }
+        else
+        {
+            VulkanBuffer completed = buffer;
+            m_GraphicsDevice.DestroyBuffer(completed);
+        }
+    }
+
+    vk::SemaphoreSubmitInfo VulkanUploadManager::Flush(vk::PipelineStageFlags2 waitStages)
+    {
+        std::lock_guard lock(m_Mutex);
+        Submit();
+        RetireCompletedBatches();
+        auto waitInfo = VulkanInitializer::SemaphoreSubmitInfo(m_TimelineSemaphore, waitStages);
+        waitInfo.value = m_SubmittedValue;
+        return waitInfo;
+    }
+
+    void VulkanUploadManager::WaitIdle()
+    {
+        std::lock_guard lock(m_Mutex);
+        Submit();
+        while (!m_InFlightBatches.empty())
+        {
+            WaitForOldestBatch();
+        }
+    }
+
+    VulkanUploadManager::StagingAllocation VulkanUploadManager::Stage(gsl::span<const byte> data)
+    {
+        BeeExpects(!data.empty());
+        auto offset = m_StagingRing.Allocate(data.size(), m_StagingAlignment);
+        // The ring is full, so the oldest uploads must complete first
+        while (!offset && (m_CurrentBatch.TransferCommands || m_CurrentBatch.GraphicsCommands ||
+                           !m_InFlightBatches.empty()))
+        {
+            Submit();
+            WaitForOldestBatch();
+            offset = m_StagingRing.Allocate(data.size(), m_StagingAlignment);
+        }
+        if (offset)
+        {
+            memcpy(static_cast<byte*>(m_StagingBuffer.Info.pMappedData) + *offset, data.data(), data.size());
+            vmaFlushAllocation(GetVulkanAllocator(), m_StagingBuffer.Memory, *offset, data.size());
+            return {m_StagingBuffer.Buffer, *offset};
+        }
+        // Larger than the whole ring
+        auto buffer = m_GraphicsDevice.CreateBuffer(data.size(),
+                                                    vk::BufferUsageFlagBits::eTransferSrc,
+                                                    VMA_MEMORY_USAGE_AUTO,
+                                                    VMA_ALLOCATION_CREATE_MAPPED_BIT);
+        memcpy(buffer.Info.pMappedData, data.data(), data.size());
+        vmaFlushAllocation(GetVulkanAllocator(), buffer.Memory, 0, data.size());
+        m_CurrentBatch.Buffers.push_back(buffer);
+        return {buffer.Buffer, 0};
+    }
+
+    vk::CommandBuffer VulkanUploadManager::GetTransferCommands()
+    {
+        if (!HasDedicatedTransferQueue())
+        {
+            return GetGraphicsCommands();
+        }
+        if (!m_CurrentBatch.TransferCommands)
+        {
+            m_CurrentBatch.TransferCommands = BeginCommandBuffer(m_TransferCommandPool);
+        }
+        return m_CurrentBatch.TransferCommands;
+    }
+
+    vk::CommandBuffer VulkanUploadManager::GetGraphicsCommands()
+    {
+        if (!m_CurrentBatch.GraphicsCommands)
+        {
+            m_CurrentBatch.GraphicsCommands = BeginCommandBuffer(m_GraphicsCommandPool);
+        }
+        return m_CurrentBatch.GraphicsCommands;
+    }
+
+    vk::CommandBuffer VulkanUploadManager::BeginCommandBuffer(vk::CommandPool pool)
+    {
+        vk::CommandBufferAllocateInfo allocInfo{};
+        allocInfo.level = vk::CommandBufferLevel::ePrimary;
+        allocInfo.commandPool = pool;
+        allocInfo.commandBufferCount = 1;
+
+        vk::CommandBuffer commandBuffer;
+        CheckVkResult(m_Device.allocateCommandBuffers(&allocInfo, &commandBuffer));
+
+        vk::CommandBufferBeginInfo beginInfo{};
+        beginInfo.flags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit;
+        CheckVkResult(commandBuffer.begin(&beginInfo));
+        return commandBuffer;
+    }
+
+    void VulkanUploadManager::Submit()
+    {
+        if (!m_CurrentBatch.TransferCommands && !m_CurrentBatch.GraphicsCommands)
+        {
+            return;
+        }
+        Batch batch = std::move(m_CurrentBatch);
+        m_CurrentBatch = {};
+
+        // Every submission waits for the previous one, even on another queue. Signals of the timeline must
+        // increase in execution order, and batches are retired in the same order, so no batch can complete
+        // before the commands and staging data of an earlier batch are no longer used
+        auto submit = [this](vk::Queue queue, vk::CommandBuffer commandBuffer)
+        {
+            commandBuffer.end();
+            auto commandBufferSubmitInfo = VulkanInitializer::CommandBufferSubmitInfo(commandBuffer);
+            auto waitInfo =
+                VulkanInitializer::SemaphoreSubmitInfo(m_TimelineSemaphore, vk::PipelineStageFlagBits2::eAllCommands);
+            waitInfo.value = m_SubmittedValue;
+            auto signalInfo =
+                VulkanInitializer::SemaphoreSubmitInfo(m_TimelineSemaphore, vk::PipelineStageFlagBits2::eAllCommands);
+            signalInfo.value = ++m_SubmittedValue;
+
+            vk::SubmitInfo2 submitInfo = {};
+            submitInfo.commandBufferInfoCount = 1;
+            submitInfo.pCommandBufferInfos = &commandBufferSubmitInfo;
+            submitInfo.waitSemaphoreInfoCount = 1;
+            submitInfo.pWaitSemaphoreInfos = &waitInfo;
+            submitInfo.signalSemaphoreInfoCount = 1;
+            submitInfo.pSignalSemaphoreInfos = &signalInfo;
+            CheckVkResult(queue.submit2KHR(1, &submitInfo, nullptr, g_vkDynamicLoader));
+        };
+        if (batch.TransferCommands)
+        {
+            submit(m_TransferQueue, batch.TransferCommands);
+        }
+        if (batch.GraphicsCommands)
+        {
+            // Acquire barriers execute after the release barriers on the transfer queue
+            submit(m_GraphicsQueue, batch.GraphicsCommands);
+        }
+        batch.CompletionValue = m_SubmittedValue;
+        m_StagingRing.FinishFrame();
+        m_InFlightBatches.push_back(std::move(batch));
+    }
+
+    void VulkanUploadManager::RetireCompletedBatches()
+    {
+        if (m_InFlightBatches.empty())
+        {
+            return;
+        }
+        const uint64_t completedValue = m_Device.getSemaphoreCounterValue(m_TimelineSemaphore);
+        while (!m_InFlightBatches.empty() && m_InFlightBatches.front().CompletionValue <= completedValue)
+        {
+            FreeBatch(m_InFlightBatches.front());
+            m_InFlightBatches.pop_front();
+        }
+    }
+
+    void VulkanUploadManager::WaitForOldestBatch()
+    {
+        BeeExpects(!m_InFlightBatches.empty());
+        vk::SemaphoreWaitInfo waitInfo = {};
+        waitInfo.semaphoreCount = 1;
+        waitInfo.pSemaphores = &m_TimelineSemaphore;
+        waitInfo.pValues = &m_InFlightBatches.front().CompletionValue;
+        CheckVkResult(m_Device.waitSemaphores(waitInfo, std::numeric_limits<uint64_t>::max()));
+        RetireCompletedBatches();
+    }
+
+    void VulkanUploadManager::FreeBatch(Batch& batch)
+    {
+        if (batch.TransferCommands)
+        {
+            m_Device.freeCommandBuffers(m_TransferCommandPool, batch.TransferCommands);
+        }
+        if (batch.GraphicsCommands)
+        {
+            m_Device.freeCommandBuffers(m_GraphicsCommandPool, batch.GraphicsCommands);
+        }
+        for (auto& buffer : batch.Buffers)
+        {
+            m_GraphicsDevice.DestroyBuffer(buffer);
+        }
+        m_StagingRing.ReleaseFrame();
+    }
+} // namespace BeeEngine::Internal
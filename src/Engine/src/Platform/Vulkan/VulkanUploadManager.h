@@ -0,0 +1,121 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#pragma once
+#include "Core/TypeDefines.h"
+#include "Renderer/RingOffsetAllocator.h"
+#include "VulkanBuffer.h"
+#include "vulkan/vulkan.hpp"
+#include <deque>
+#include <gsl/span>
+#include <mutex>
+#include <vector>
+
+namespace BeeEngine::Internal
+{
+    class VulkanGraphicsDevice;
+
+    /**
+     * @brief Records copies of data into buffers and images into batches, that are submitted together on the
+     * transfer queue (or on the graphics queue, if the device has no separate one) without waiting for them.
+     * Data is staged in a persistently mapped ring buffer, that is reused, when the batches, which read it, are
+     * completed. Completion is tracked by a timeline semaphore, so graphics submissions, that use uploaded
+     * resources, must wait for the info returned by Flush
+     */
+    class VulkanUploadManager
+    {
+    public:
+        static constexpr vk::DeviceSize StagingBufferSize = 64 * 1024 * 1024;
+
+        explicit VulkanUploadManager(VulkanGraphicsDevice& device);
+        ~VulkanUploadManager();
+        VulkanUploadManager(const VulkanUploadManager&) = delete;
+        VulkanUploadManager& operator=(const VulkanUploadManager&) = delete;
+
+        void UploadToBuffer(gsl::span<const byte> data, vk::Buffer destination, vk::DeviceSize destinationOffset = 0);
+        /**
+         * @brief Copies tightly packed pixels to the whole image, that must have one mip level and one layer.
+         * The image ends up in eShaderReadOnlyOptimal layout
+         */
+        void UploadToImage(
+            gsl::span<const byte> data, vk::Image image, vk::Format format, uint32_t width, uint32_t height);
+        /**
+         * @brief Records a layout transition of an image, which is used by the graphics queue, into the current batch
+         */
+        void
+        TransitionImageLayout(vk::Image image, vk::Format format, vk::ImageLayout oldLayout, vk::ImageLayout newLayout);
+        /**
+         * @brief Lets record calls other commands, e.g. compute passes, into the current batch on the graphics queue.
+         * They are executed before the next graphics queue submission, that waits for Flush
+         */
+        template <typename Record>
+        void RecordGraphicsCommands(Record&& record)
+        {
+            std::lock_guard lock(m_Mutex);
+            record(GetGraphicsCommands());
+        }
+
+        /**
+         * @brief Destroys the buffer, when the commands, that were recorded so far, are completed,
+         * e.g. a scratch buffer of a command passed to RecordGraphicsCommands
+         */
+        void DestroyAfterCompletion(const VulkanBuffer& buffer);
+
+        /**
+         * @brief Submits the recorded commands, if there are any
+         * @return wait info for the submitted uploads, that must be added to a graphics queue submission,
+         * which uses the uploaded resources in waitStages
+         */
+        vk::SemaphoreSubmitInfo Flush(vk::PipelineStageFlags2 waitStages);
+        /**
+         * @brief Submits the recorded commands and blocks, until all uploads are completed
+         */
+        void WaitIdle();
+
+        [[nodiscard]] bool HasDedicatedTransferQueue() const { return m_TransferFamily != m_GraphicsFamily; }
+
+    private:
+        struct Batch
+        {
+            vk::CommandBuffer TransferCommands;
+            vk::CommandBuffer GraphicsCommands;
+            uint64_t CompletionValue = 0;
+            // Data, that did not fit into the staging ring, and other buffers, that the commands use
+            std::vector<VulkanBuffer> Buffers;
+        };
+        struct StagingAllocation
+        {
+            vk::Buffer Buffer;
+            vk::DeviceSize Offset;
+        };
+
+        StagingAllocation Stage(gsl::span<const byte> data);
+        vk::CommandBuffer GetTransferCommands();
+        vk::CommandBuffer GetGraphicsCommands();
+        vk::CommandBuffer BeginCommandBuffer(vk::CommandPool pool);
+        void Submit();
+        void RetireCompletedBatches();
+        void WaitForOldestBatch();
+        void FreeBatch(Batch& batch);
+
+        VulkanGraphicsDevice& m_GraphicsDevice;
+        vk::Device m_Device;
+        uint32_t m_GraphicsFamily;
+        uint32_t m_TransferFamily;
+        vk::Queue m_TransferQueue;
+        vk::Queue m_GraphicsQueue;
+        vk::CommandPool m_TransferCommandPool;
+        vk::CommandPool m_GraphicsCommandPool;
+        vk::Semaphore m_TimelineSemaphore;
+        uint64_t m_SubmittedValue = 0;
+
+        VulkanBuffer m_StagingBuffer;
+        RingOffsetAllocator m_StagingRing;
+        vk::DeviceSize m_StagingAlignment;
+
+        Batch m_CurrentBatch;
+        std::deque<Batch> m_InFlightBatches;
+        std::mutex m_Mutex;
+    };
+} // namespace BeeEngine::Internal
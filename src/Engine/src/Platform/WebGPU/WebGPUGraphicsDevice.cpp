@@ -341,9 +341,9 @@ namespace BeeEngine::Internal
         return wgpuDeviceCreateBuffer(m_Device, &bufferDesc);
     }
 
-    void WebGPUGraphicsDevice::CopyDataToBuffer(gsl::span<byte> data, WGPUBuffer buffer)
+    void WebGPUGraphicsDevice::CopyDataToBuffer(gsl::span<byte> data, WGPUBuffer buffer, uint64_t offset)
     {
-        wgpuQueueWriteBuffer(m_Queue, buffer, 0, data.data(), data.size());
+        wgpuQueueWriteBuffer(m_Queue, buffer, offset, data.data(), data.size());
     }
 
     Task<> WebGPUGraphicsDevice::WaitForQueueIdle()
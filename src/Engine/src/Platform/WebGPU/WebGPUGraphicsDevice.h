@@ -38,7 +38,7 @@ namespace BeeEngine::Internal
             return m_BufferPool->RequestBuffer(size, usage);
         }
         void ReleaseBuffer(const WebGPUBuffer& buffer) { m_BufferPool->ReleaseBuffer(buffer); }
-        void CopyDataToBuffer(gsl::span<byte> data, WGPUBuffer buffer);
+        void CopyDataToBuffer(gsl::span<byte> data, WGPUBuffer buffer, uint64_t offset = 0);
 
         void SubmitCommandBuffers(CommandBuffer* commandBuffers, uint32_t numberOfBuffers);
 
@@ -29,10 +29,16 @@ namespace BeeEngine::Internal
         m_GraphicsDevice.CopyDataToBuffer({(byte*)data, size}, m_Buffer.Buffer);
     }
 
-    void WebGPUInstancedBuffer::Bind(void* cmd)
+    void WebGPUInstancedBuffer::UpdateRange(size_t offset, gsl::span<const byte> data)
+    {
+        BeeExpects(offset + data.size() <= m_Size);
+        m_GraphicsDevice.CopyDataToBuffer({const_cast<byte*>(data.data()), data.size()}, m_Buffer.Buffer, offset);
+    }
+
+    void WebGPUInstancedBuffer::Bind(void* cmd, size_t offset)
     {
         wgpuRenderPassEncoderSetVertexBuffer(
-            (WGPURenderPassEncoder)(((RenderPass*)cmd)->GetHandle()), 1, m_Buffer.Buffer, 0, m_Size);
+            (WGPURenderPassEncoder)(((RenderPass*)cmd)->GetHandle()), 1, m_Buffer.Buffer, offset, m_Size - offset);
     }
 
     WebGPUInstancedBuffer::WebGPUInstancedBuffer(size_t size)
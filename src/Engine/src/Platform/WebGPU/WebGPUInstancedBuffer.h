@@ -18,7 +18,8 @@ namespace BeeEngine::Internal
         WebGPUInstancedBuffer(const WebGPUInstancedBuffer& other) = delete;
         WebGPUInstancedBuffer& operator=(const WebGPUInstancedBuffer& other) = delete;
         void SetData(void* data, size_t size) override;
-        void Bind(void* cmd) override;
+        void UpdateRange(size_t offset, gsl::span<const byte> data) override;
+        void Bind(void* cmd, size_t offset) override;
 
         virtual size_t GetSize() override { return m_Size; }
 
@@ -94,11 +94,12 @@ namespace BeeEngine::Internal
     void WebGPURendererAPI::DrawInstanced(Model& model,
                                           InstancedBuffer& instancedBuffer,
                                           const std::vector<BindingSet*>& bindingSets,
-                                          uint32_t instanceCount)
+                                          uint32_t instanceCount,
+                                          size_t instanceDataOffset)
     {
         model.Bind();
         auto cmd = Renderer::GetCurrentRenderPass();
-        instancedBuffer.Bind(&cmd);
+        instancedBuffer.Bind(&cmd, instanceDataOffset);
         uint32_t index = 0;
         for (auto& bindingSet : bindingSets)
         {
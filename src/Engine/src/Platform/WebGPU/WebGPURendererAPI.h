@@ -30,7 +30,8 @@ namespace BeeEngine::Internal
         void DrawInstanced(Model& model,
                            InstancedBuffer& instancedBuffer,
                            const std::vector<BindingSet*>& bindingSets,
-                           uint32_t instanceCount) override;
+                           uint32_t instanceCount,
+                           size_t instanceDataOffset) override;
 
         void SubmitCommandBuffer(const CommandBuffer& commandBuffer) override
         {
@@ -162,6 +162,10 @@ namespace BeeEngine::Internal
                 case ShaderUniformDataType::Sampler:
                     entry.sampler.type = WGPUSamplerBindingType_Filtering;
                     break;
+                case ShaderUniformDataType::StorageBuffer:
+                    entry.buffer.type = WGPUBufferBindingType_Storage;
+                    entry.buffer.hasDynamicOffset = false;
+                    break;
                 case ShaderUniformDataType::Unknown:
                     BeeCoreError("Unknown ShaderUniformDataType");
                     break;
@@ -5,6 +5,7 @@
 #include "BindingSet.h"
 #include "Core/TypeDefines.h"
 #include "IBindable.h"
+#include "Platform/Null/NullBindingSet.h"
 #include "Platform/Vulkan/VulkanBindingSet.h"
 #include "Platform/WebGPU/WebGPUBindingSet.h"
 #include "Renderer/Renderer.h"
@@ -24,6 +25,8 @@ namespace BeeEngine
             case Vulkan:
                 return CreateScope<Internal::VulkanBindingSet>(elements);
 #endif
+            case Null:
+                return CreateScope<Internal::NullBindingSet>(elements);
             default:
                 BeeCoreError("BindingSet::Create: API not available!");
                 return nullptr;
@@ -43,6 +46,8 @@ namespace BeeEngine
             case Vulkan:
                 return CreateScope<Internal::VulkanBindingSet>(BeeMove(elements));
 #endif
+            case Null:
+                return CreateScope<Internal::NullBindingSet>(BeeMove(elements));
             default:
                 BeeCoreError("BindingSet::Create: API not available!");
                 return nullptr;
@@ -56,13 +61,14 @@ namespace BeeEngine
         {
 #if defined(BEE_COMPILE_WEBGPU)
             case WebGPU:
-                // return CreateFrameScope<Internal::WebGPUBindingSet>(elements);
-                return FramePtr<Internal::WebGPUBindingSet>(new Internal::WebGPUBindingSet(elements));
+                return BeeEngine::CreateFrameScope<Internal::WebGPUBindingSet>(elements);
 #endif
 #if defined(BEE_COMPILE_VULKAN)
             case Vulkan:
-                return FramePtr<Internal::VulkanBindingSet>(new Internal::VulkanBindingSet(elements));
+                return BeeEngine::CreateFrameScope<Internal::VulkanBindingSet>(elements);
 #endif
+            case Null:
+                return BeeEngine::CreateFrameScope<Internal::NullBindingSet>(elements);
             default:
                 BeeCoreError("BindingSet::Create: API not available!");
                 return nullptr;
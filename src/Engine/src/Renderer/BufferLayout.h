@@ -37,7 +37,8 @@ namespace BeeEngine
         Unknown = 0,
         Data,
         Sampler,
-        SampledTexture
+        SampledTexture,
+        StorageBuffer
     };
     class BufferLayoutBuilder;
     struct BufferElement
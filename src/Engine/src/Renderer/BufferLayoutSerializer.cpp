@@ -131,6 +131,8 @@ namespace BeeEngine
                 return "Sampler";
             case ShaderUniformDataType::SampledTexture:
                 return "SampledTexture";
+            case ShaderUniformDataType::StorageBuffer:
+                return "StorageBuffer";
             default:
                 return "Unknown";
         }
@@ -154,6 +156,10 @@ namespace BeeEngine
         {
             return ShaderUniformDataType::SampledTexture;
         }
+        if (str == "StorageBuffer")
+        {
+            return ShaderUniformDataType::StorageBuffer;
+        }
         return ShaderUniformDataType::Unknown;
     }
 
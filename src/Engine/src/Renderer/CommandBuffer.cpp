@@ -42,11 +42,22 @@ namespace BeeEngine
         SubmitLine(lineVertices[3], lineVertices[0], cameraBindingSet, color, lineWidth);
     }
 
-    void
-    CommandBuffer::SubmitInstance(Model& model, std::vector<BindingSet*>& bindingSets, gsl::span<byte> instanceData)
+    void CommandBuffer::SubmitInstance(Model& model,
+                                       std::span<BindingSet* const> bindingSets,
+                                       gsl::span<byte> instanceData,
+                                       float depth)
     {
         BeeExpects(IsValid());
-        m_RenderingQueue->SubmitInstance({&model, bindingSets}, instanceData);
+        m_RenderingQueue->SubmitInstance(model, bindingSets, instanceData, depth);
+    }
+
+    void CommandBuffer::SubmitInstanceView(Model& model,
+                                           std::span<BindingSet* const> bindingSets,
+                                           gsl::span<const byte> instanceData,
+                                           float depth)
+    {
+        BeeExpects(IsValid());
+        m_RenderingQueue->SubmitInstanceView(model, bindingSets, instanceData, depth);
     }
 
     void CommandBuffer::SubmitLine(const glm::vec3& start,
@@ -59,10 +70,10 @@ namespace BeeEngine
         m_RenderingQueue->SubmitLine(start, end, color, cameraBindingSet, lineWidth);
     }
 
-    void CommandBuffer::Flush()
+    void CommandBuffer::Flush(DrawOrder order)
     {
         BeeExpects(IsValid());
-        m_RenderingQueue->Flush(*this);
+        m_RenderingQueue->Flush(*this, order);
     }
 
     void CommandBuffer::EndRecording()
@@ -4,9 +4,11 @@
 
 #pragma once
 #include <glm.hpp>
+#include <span>
 
 #include "Core/String.h"
 #include "Core/TypeDefines.h"
+#include "DrawPacket.h"
 #include "TextRenderingConfiguration.h"
 
 namespace BeeEngine
@@ -38,13 +40,21 @@ namespace BeeEngine
                         const TextRenderingConfiguration& config,
                         int32_t entityId = -1);
         void DrawRect(const glm::mat4& transform, const Color4& color, BindingSet& cameraBindingSet, float lineWidth);
-        void SubmitInstance(Model& model, std::vector<BindingSet*>& bindingSets, gsl::span<byte> instanceData);
+        void SubmitInstance(Model& model,
+                            std::span<BindingSet* const> bindingSets,
+                            gsl::span<byte> instanceData,
+                            float depth = 0.0f);
+        // Instance data is not copied and must stay alive until the next Flush
+        void SubmitInstanceView(Model& model,
+                                std::span<BindingSet* const> bindingSets,
+                                gsl::span<const byte> instanceData,
+                                float depth = 0.0f);
         void SubmitLine(const glm::vec3& start,
                         const glm::vec3& end,
                         BindingSet& cameraBindingSet,
                         const Color4& color = Color4::Black,
                         float lineWidth = 0.1f);
-        void Flush();
+        void Flush(DrawOrder order = DrawOrder::State);
 
         // Mostly handled internally. Should be called after all drawing commands
         void EndRecording();
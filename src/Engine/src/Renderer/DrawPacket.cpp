@@ -0,0 +1,134 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#include "DrawPacket.h"
+#include "Core/CodeSafety/Expects.h"
+#include "Core/Hash.h"
+#include "Debug/Instrumentor.h"
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <iterator>
+
+namespace BeeEngine::Internal
+{
+    DrawState::DrawState(BeeEngine::Model& model, std::span<BindingSet* const> bindingSets)
+        : Model(&model), BindingSetCount(static_cast<uint32_t>(bindingSets.size()))
+    {
+        BeeExpects(bindingSets.size() <= MaxBindingSets);
+        std::ranges::copy(bindingSets, BindingSets.begin());
+    }
+
+    std::span<std::byte> InstanceDataArena::Allocate(size_t size)
+    {
+        size_t offset = (m_Offset + Alignment - 1) & ~(Alignment - 1);
+        if (m_Blocks.empty() || offset + size > m_Blocks[m_CurrentBlock].size())
+        {
+            if (!m_Blocks.empty())
+            {
+                ++m_CurrentBlock;
+            }
+            if (m_CurrentBlock == m_Blocks.size() || m_Blocks[m_CurrentBlock].size() < size)
+            {
+                m_Blocks.emplace(m_Blocks.begin() + static_cast<ptrdiff_t>(m_CurrentBlock), std::max(BlockSize, size));
+            }
+            offset = 0;
+        }
+        m_Offset = offset + size;
+        return {m_Blocks[m_CurrentBlock].data() + offset, size};
+    }
+
+    void InstanceDataArena::Append(InstanceDataArena&& other)
+    {
+        if (other.m_Blocks.empty())
+        {
+            return;
+        }
+        // Unused blocks of this arena are dropped, so the last appended block becomes the current one
+        if (!m_Blocks.empty())
+        {
+            m_Blocks.resize(m_CurrentBlock + 1);
+        }
+        const auto used = static_cast<ptrdiff_t>(other.m_CurrentBlock + 1);
+        std::move(other.m_Blocks.begin(), other.m_Blocks.begin() + used, std::back_inserter(m_Blocks));
+        m_CurrentBlock = m_Blocks.size() - 1;
+        m_Offset = other.m_Offset;
+        other.m_Blocks.clear();
+        other.Reset();
+    }
+
+    void InstanceDataArena::Reset()
+    {
+        m_CurrentBlock = 0;
+        m_Offset = 0;
+    }
+
+    size_t InstanceDataArena::GetAllocatedSize() const
+    {
+        size_t size = 0;
+        for (const auto& block : m_Blocks)
+        {
+            size += block.size();
+        }
+        return size;
+    }
+
+    uint32_t DrawSortKey::FromDepth(float depth)
+    {
+        // Positive floats are ordered as their bits, negative ones in reverse,
+        // so flip all bits of negative values and only the sign bit of positive ones
+        const auto bits = std::bit_cast<uint32_t>(depth);
+        const uint32_t mask = (bits & 0x80000000u) ? 0xFFFFFFFFu : 0x80000000u;
+        return bits ^ mask;
+    }
+
+    void SortDrawPackets(std::vector<DrawPacket>& packets, std::vector<DrawPacket>& scratch)
+    {
+        BEE_PROFILE_FUNCTION();
+        constexpr size_t Passes = sizeof(uint64_t);
+        constexpr size_t Buckets = 256;
+        if (packets.size() < 2)
+        {
+            return;
+        }
+        std::array<std::array<uint32_t, Buckets>, Passes> histograms{};
+        for (const auto& packet : packets)
+        {
+            for (size_t pass = 0; pass < Passes; ++pass)
+            {
+                ++histograms[pass][(packet.SortKey >> (pass * 8)) & 0xFF];
+            }
+        }
+        scratch.resize(packets.size());
+        for (size_t pass = 0; pass < Passes; ++pass)
+        {
+            auto& histogram = histograms[pass];
+            const uint8_t firstDigit = (packets.front().SortKey >> (pass * 8)) & 0xFF;
+            if (histogram[firstDigit] == packets.size())
+            {
+                continue;
+            }
+            uint32_t offset = 0;
+            for (auto& count : histogram)
+            {
+                const uint32_t bucketSize = count;
+                count = offset;
+                offset += bucketSize;
+            }
+            for (const auto& packet : packets)
+            {
+                scratch[histogram[(packet.SortKey >> (pass * 8)) & 0xFF]++] = packet;
+            }
+            packets.swap(scratch);
+        }
+    }
+} // namespace BeeEngine::Internal
+
+size_t std::hash<BeeEngine::Internal::DrawState>::operator()(const BeeEngine::Internal::DrawState& state) const noexcept
+{
+    // Unused binding sets are always null, so the count does not need to be hashed
+    static_assert(offsetof(BeeEngine::Internal::DrawState, BindingSets) == sizeof(BeeEngine::Model*));
+    return BeeEngine::HashAlgorithm::MurmurHash2_64(
+        &state, offsetof(BeeEngine::Internal::DrawState, BindingSetCount), 0);
+}
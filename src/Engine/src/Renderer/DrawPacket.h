@@ -0,0 +1,133 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <vector>
+
+namespace BeeEngine
+{
+    class Model;
+    class BindingSet;
+
+    /**
+     * @brief Order in which instances of one flush are drawn
+     */
+    enum class DrawOrder
+    {
+        // Grouped by pipeline and draw state, front to back inside of a group. For opaque geometry
+        State,
+        // Back to front, neighbours with the same draw state are still instanced. For blended geometry
+        BackToFront
+    };
+} // namespace BeeEngine
+
+namespace BeeEngine::Internal
+{
+    /**
+     * @brief Model and binding sets of an instanced draw call.
+     * Has a fixed size, so it is compared and hashed without allocations
+     */
+    struct DrawState
+    {
+        static constexpr size_t MaxBindingSets = 4;
+
+        BeeEngine::Model* Model = nullptr;
+        std::array<BindingSet*, MaxBindingSets> BindingSets{};
+        uint32_t BindingSetCount = 0;
+
+        DrawState() = default;
+        DrawState(BeeEngine::Model& model, std::span<BindingSet* const> bindingSets);
+
+        [[nodiscard]] std::span<BindingSet* const> GetBindingSets() const { return {BindingSets.data(), BindingSetCount}; }
+        bool operator==(const DrawState& other) const = default;
+    };
+
+    /**
+     * @brief Fixed size record of one submitted instance.
+     * Instance data itself is stored by the submitter or in the instance data arena of the rendering queue.
+     * Neighbouring packets with the same draw state are drawn with one instanced draw call.
+     * A packet is 24 bytes: the key and the data pointer take 16, so a narrower size would only become padding
+     */
+    struct DrawPacket
+    {
+        uint64_t SortKey;
+        const std::byte* Data;
+        uint32_t DataSize;
+        uint16_t DrawState;
+    };
+    static_assert(sizeof(DrawPacket) == 24);
+
+    /**
+     * @brief Linear allocator for instance data, that lives until Reset.
+     * Memory is allocated in blocks, that are never reallocated, so returned memory stays valid
+     * when the arena grows or is appended to another arena. Blocks are reused after Reset
+     */
+    class InstanceDataArena
+    {
+    public:
+        static constexpr size_t BlockSize = 64 * 1024;
+        static constexpr size_t Alignment = 16;
+
+        [[nodiscard]] std::span<std::byte> Allocate(size_t size);
+        /**
+         * @brief Moves used blocks of the other arena to the end of this one.
+         * Memory allocated from the other arena stays valid
+         */
+        void Append(InstanceDataArena&& other);
+        void Reset();
+        [[nodiscard]] size_t GetAllocatedSize() const;
+
+    private:
+        std::vector<std::vector<std::byte>> m_Blocks;
+        size_t m_CurrentBlock = 0;
+        size_t m_Offset = 0;
+    };
+
+    /**
+     * @brief Sort keys of a draw packet. Packets are submitted with the key for DrawOrder::State:
+     * | 16 bits pipeline | 16 bits draw state | 32 bits depth |
+     * and rekeyed on flush, if other order is requested
+     */
+    namespace DrawSortKey
+    {
+        constexpr uint64_t Make(uint16_t pipeline, uint16_t drawState, uint32_t depth)
+        {
+            return (static_cast<uint64_t>(pipeline) << 48) | (static_cast<uint64_t>(drawState) << 32) | depth;
+        }
+        /**
+         * @brief | 32 bits inverted depth | 16 bits pipeline | 16 bits draw state |
+         */
+        constexpr uint64_t MakeBackToFront(uint16_t pipeline, uint16_t drawState, uint32_t depth)
+        {
+            return (static_cast<uint64_t>(~depth) << 32) | (static_cast<uint64_t>(pipeline) << 16) | drawState;
+        }
+        constexpr uint64_t ToBackToFront(uint64_t key)
+        {
+            return MakeBackToFront(static_cast<uint16_t>(key >> 48), static_cast<uint16_t>(key >> 32),
+                                   static_cast<uint32_t>(key));
+        }
+        /**
+         * @brief Maps a float to unsigned bits with the same order, so smaller depth gets smaller key
+         */
+        uint32_t FromDepth(float depth);
+    } // namespace DrawSortKey
+
+    /**
+     * @brief Stable LSD radix sort of the packets by sort key, 8 bits per pass.
+     * Passes, in which all keys have the same byte, are skipped, so unused parts of the key cost nothing
+     * @param scratch buffer, that is reused between calls
+     */
+    void SortDrawPackets(std::vector<DrawPacket>& packets, std::vector<DrawPacket>& scratch);
+} // namespace BeeEngine::Internal
+
+template <>
+struct std::hash<BeeEngine::Internal::DrawState>
+{
+    size_t operator()(const BeeEngine::Internal::DrawState& state) const noexcept;
+};
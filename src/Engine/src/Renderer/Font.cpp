@@ -6,6 +6,7 @@
 #include "Core/AssetManagement/TextureImporter.h"
 #include "Core/CodeSafety/Expects.h"
 #include "Core/Logging/Log.h"
+#include "Debug/Instrumentor.h"
 #include "FileSystem/File.h"
 #include "Hardware.h"
 #include "JobSystem/JobScheduler.h"
@@ -437,6 +438,7 @@ namespace BeeEngine
         m_AtlasTexture = CreateAndCacheAtlas<uint8_t, float, 4, msdf_atlas::mtsdfGenerator>(
             name, emSize, m_Data->Glyphs, m_Data->FontGeometry, {width, height}, s_Handle->CacheFolder);
         m_BindingSet = BindingSet::Create({{0, *m_AtlasTexture}});
+        BuildMetrics();
 #if 0
         msdfgen::Shape shape;
         if(msdfgen::loadGlyph(shape, font, 'A'))
@@ -452,4 +454,32 @@ namespace BeeEngine
         msdfgen::loadGlyph(shape, font, 'A');
 #endif
     }
+
+    void Font::BuildMetrics()
+    {
+        BEE_PROFILE_FUNCTION();
+        const auto& metrics = m_Data->FontGeometry.getMetrics();
+        // Everything is scaled, so that the line is 1 unit high
+        const double fsScale = 1.0 / (metrics.ascenderY - metrics.descenderY);
+        const glm::vec2 texelSize{1.0f / (float)m_AtlasTexture->GetWidth(), 1.0f / (float)m_AtlasTexture->GetHeight()};
+        m_Metrics.SetLineHeight(static_cast<float>(fsScale * metrics.lineHeight));
+        for (const auto& glyph : m_Data->Glyphs)
+        {
+            double al, ab, ar, at;
+            glyph.getQuadAtlasBounds(al, ab, ar, at);
+            double pl, pb, pr, pt;
+            glyph.getQuadPlaneBounds(pl, pb, pr, pt);
+            m_Metrics.AddGlyph(glyph.getCodepoint(),
+                               {.QuadMin = glm::vec2(pl * fsScale, pb * fsScale),
+                                .QuadMax = glm::vec2(pr * fsScale, pt * fsScale),
+                                .TexCoordMin = glm::vec2(al, ab) * texelSize,
+                                .TexCoordMax = glm::vec2(ar, at) * texelSize,
+                                .Advance = static_cast<float>(fsScale * glyph.getAdvance()),
+                                .FontIndex = glyph.getIndex()});
+        }
+        for (const auto& [pair, kerning] : m_Data->FontGeometry.getKerning())
+        {
+            m_Metrics.AddKerning(pair.first, pair.second, static_cast<float>(fsScale * kerning));
+        }
+    }
 } // namespace BeeEngine
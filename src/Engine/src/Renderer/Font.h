@@ -6,6 +6,7 @@
 #include "Core/Path.h"
 #include "JobSystem/SpinLock.h"
 #include "Renderer/BindingSet.h"
+#include "TextLayout.h"
 #include "Texture.h"
 #include <cstddef>
 
@@ -80,8 +81,15 @@ namespace BeeEngine
          */
         [[nodiscard]] BindingSet& GetAtlasBindingSet() { return *m_BindingSet; }
 
+        /**
+         * @brief Gets flat glyph and kerning tables, that are used for text layout.
+         * @return A reference to the FontMetrics of the font.
+         */
+        [[nodiscard]] const FontMetrics& GetMetrics() const { return m_Metrics; }
+
     private:
         Internal::MSDFData* m_Data = nullptr;
+        FontMetrics m_Metrics;
         Scope<GPUTextureResource> m_AtlasTexture;
         Ref<BindingSet> m_BindingSet;
 
@@ -94,5 +102,6 @@ namespace BeeEngine
         static void Shutdown();
 
         void LoadFont(void* handle, const String& name);
+        void BuildMetrics();
     };
 } // namespace BeeEngine
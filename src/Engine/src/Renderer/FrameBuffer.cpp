@@ -3,6 +3,7 @@
 //
 
 #include "FrameBuffer.h"
+#include "Platform/Null/NullFrameBuffer.h"
 #include "Platform/Vulkan/VulkanFrameBuffer.h"
 #include "Platform/WebGPU/WebGPUFramebuffer.h"
 #include "Renderer.h"
@@ -26,6 +27,8 @@ namespace BeeEngine
             case RenderAPI::Vulkan:
                 return CreateScope<Internal::VulkanFrameBuffer>(preferences);
 #endif
+            case RenderAPI::Null:
+                return CreateScope<Internal::NullFrameBuffer>(preferences);
             default:
                 BeeCoreFatalError("Unknown RenderAPI");
         }
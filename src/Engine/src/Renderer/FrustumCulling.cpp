@@ -0,0 +1,248 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#include "FrustumCulling.h"
+#include "Core/CodeSafety/Expects.h"
+#include "Debug/Instrumentor.h"
+#include <algorithm>
+#include <limits>
+
+namespace BeeEngine
+{
+    std::vector<glm::vec4> GetFrustumPlanes(const glm::mat4& viewProj)
+    {
+        // x, y, z, and w represent A, B, C and D in the plane equation
+        // where ABC are the xyz of the planes normal, and D is the plane constant
+        std::vector<glm::vec4> tempFrustumPlane(6);
+
+        // Left Frustum Plane
+        // Add first column of the matrix to the fourth column
+        tempFrustumPlane[0].x = viewProj[0][3] + viewProj[0][0];
+        tempFrustumPlane[0].y = viewProj[1][3] + viewProj[1][0];
+        tempFrustumPlane[0].z = viewProj[2][3] + viewProj[2][0];
+        tempFrustumPlane[0].w = viewProj[3][3] + viewProj[3][0];
+
+        // Right Frustum Plane
+        // Subtract first column of matrix from the fourth column
+        tempFrustumPlane[1].x = viewProj[0][3] - viewProj[0][0];
+        tempFrustumPlane[1].y = viewProj[1][3] - viewProj[1][0];
+        tempFrustumPlane[1].z = viewProj[2][3] - viewProj[2][0];
+        tempFrustumPlane[1].w = viewProj[3][3] - viewProj[3][0];
+
+        // Top Frustum Plane
+        // Subtract second column of matrix from the fourth column
+        tempFrustumPlane[2].x = viewProj[0][3] - viewProj[0][1];
+        tempFrustumPlane[2].y = viewProj[1][3] - viewProj[1][1];
+        tempFrustumPlane[2].z = viewProj[2][3] - viewProj[2][1];
+        tempFrustumPlane[2].w = viewProj[3][3] - viewProj[3][1];
+
+        // Bottom Frustum Plane
+        // Add second column of the matrix to the fourth column
+        tempFrustumPlane[3].x = viewProj[0][3] + viewProj[0][1];
+        tempFrustumPlane[3].y = viewProj[1][3] + viewProj[1][1];
+        tempFrustumPlane[3].z = viewProj[2][3] + viewProj[2][1];
+        tempFrustumPlane[3].w = viewProj[3][3] + viewProj[3][1];
+
+        // Near Frustum Plane
+        // We could add the third column to the fourth column to get the near plane,
+        // but we don't have to do this because the third column IS the near plane
+        tempFrustumPlane[4].x = viewProj[0][2];
+        tempFrustumPlane[4].y = viewProj[1][2];
+        tempFrustumPlane[4].z = viewProj[2][2];
+        tempFrustumPlane[4].w = viewProj[3][2];
+
+        // Far Frustum Plane
+        // Subtract third column of matrix from the fourth column
+        tempFrustumPlane[5].x = viewProj[0][3] - viewProj[0][2];
+        tempFrustumPlane[5].y = viewProj[1][3] - viewProj[1][2];
+        tempFrustumPlane[5].z = viewProj[2][3] - viewProj[2][2];
+        tempFrustumPlane[5].w = viewProj[3][3] - viewProj[3][2];
+
+        // Normalize plane normals (A, B and C (xyz)), so w is the distance to the origin
+        // Also take note that planes face inward
+        for (int i = 0; i < 6; ++i)
+        {
+            float length = glm::length(glm::vec3(tempFrustumPlane[i]));
+            tempFrustumPlane[i] /= length;
+        }
+
+        return tempFrustumPlane;
+    }
+
+    float GetViewDepth(const glm::mat4& viewProj, const Math::AABB& bounds)
+    {
+        if (bounds.IsEmpty())
+        {
+            return 0.0f;
+        }
+        // Third row of the matrix gives clip space z, that is linear in the view space depth
+        const glm::vec3 center = bounds.GetCenter();
+        return viewProj[0][2] * center.x + viewProj[1][2] * center.y + viewProj[2][2] * center.z + viewProj[3][2];
+    }
+
+    namespace
+    {
+        /**
+         * @brief Normalized device coordinates of the rectangle, that contains the projected corners of the box.
+         * @return false if the box crosses the camera plane
+         */
+        bool ProjectToScreen(const glm::mat4& viewProj, const Math::AABB& bounds, glm::vec2& min, glm::vec2& max)
+        {
+            min = glm::vec2{std::numeric_limits<float>::max()};
+            max = glm::vec2{std::numeric_limits<float>::lowest()};
+            for (int i = 0; i < 8; ++i)
+            {
+                const glm::vec4 corner{i & 1 ? bounds.Max.x : bounds.Min.x,
+                                       i & 2 ? bounds.Max.y : bounds.Min.y,
+                                       i & 4 ? bounds.Max.z : bounds.Min.z,
+                                       1.0f};
+                const glm::vec4 clip = viewProj * corner;
+                if (clip.w <= std::numeric_limits<float>::epsilon())
+                {
+                    return false;
+                }
+                const glm::vec2 ndc = glm::vec2(clip.x, clip.y) / clip.w;
+                min = glm::min(min, ndc);
+                max = glm::max(max, ndc);
+            }
+            return true;
+        }
+    } // namespace
+
+    float GetScreenCoverage(const glm::mat4& viewProj, const Math::AABB& bounds)
+    {
+        if (bounds.IsEmpty())
+        {
+            return 0.0f;
+        }
+        glm::vec2 min, max;
+        if (!ProjectToScreen(viewProj, bounds, min, max))
+        {
+            return 1.0f;
+        }
+        min = glm::max(min, glm::vec2(-1.0f));
+        max = glm::min(max, glm::vec2(1.0f));
+        const glm::vec2 size = glm::max(max - min, glm::vec2(0.0f));
+        return size.x * size.y * 0.25f;
+    }
+
+    float GetScreenSize(const glm::mat4& viewProj, const Math::AABB& bounds)
+    {
+        glm::vec2 min, max;
+        if (bounds.IsEmpty() || !ProjectToScreen(viewProj, bounds, min, max))
+        {
+            return 1.0f;
+        }
+        // Normalized device coordinates span 2 units across the screen
+        const glm::vec2 size = (max - min) * 0.5f;
+        return std::max(size.x, size.y);
+    }
+
+    void BoundsBatch::Reserve(size_t count)
+    {
+        m_CenterX.reserve(count);
+        m_CenterY.reserve(count);
+        m_CenterZ.reserve(count);
+        m_ExtentX.reserve(count);
+        m_ExtentY.reserve(count);
+        m_ExtentZ.reserve(count);
+    }
+
+    void BoundsBatch::Clear()
+    {
+        m_CenterX.clear();
+        m_CenterY.clear();
+        m_CenterZ.clear();
+        m_ExtentX.clear();
+        m_ExtentY.clear();
+        m_ExtentZ.clear();
+    }
+
+    size_t BoundsBatch::Add(const Math::AABB& bounds)
+    {
+        const size_t index = m_CenterX.size();
+        if (bounds.IsEmpty())
+        {
+            // Unknown bounds: huge box, that is never culled. Not infinity, because 0 * infinity is NaN
+            constexpr float unbounded = 1e30f;
+            m_CenterX.push_back(0.0f);
+            m_CenterY.push_back(0.0f);
+            m_CenterZ.push_back(0.0f);
+            m_ExtentX.push_back(unbounded);
+            m_ExtentY.push_back(unbounded);
+            m_ExtentZ.push_back(unbounded);
+            return index;
+        }
+        const glm::vec3 center = bounds.GetCenter();
+        const glm::vec3 extents = bounds.GetExtents();
+        m_CenterX.push_back(center.x);
+        m_CenterY.push_back(center.y);
+        m_CenterZ.push_back(center.z);
+        m_ExtentX.push_back(extents.x);
+        m_ExtentY.push_back(extents.y);
+        m_ExtentZ.push_back(extents.z);
+        return index;
+    }
+
+    FrustumCuller::FrustumCuller(std::span<const glm::vec4> planes)
+    {
+        BeeExpects(planes.size() == NumberOfPlanes);
+        for (size_t i = 0; i < NumberOfPlanes; ++i)
+        {
+            const glm::vec3 normal{planes[i]};
+            m_Planes[i] = {normal, planes[i].w, glm::abs(normal)};
+        }
+    }
+
+    bool FrustumCuller::IsVisible(const Math::AABB& bounds) const
+    {
+        if (bounds.IsEmpty())
+        {
+            return true;
+        }
+        const glm::vec3 center = bounds.GetCenter();
+        const glm::vec3 extents = bounds.GetExtents();
+        for (const auto& plane : m_Planes)
+        {
+            // Box is outside, if even its farthest point along the normal is behind the plane
+            if (glm::dot(plane.Normal, center) + plane.Constant + glm::dot(plane.AbsoluteNormal, extents) < 0.0f)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    size_t FrustumCuller::Cull(const BoundsBatch& batch, std::vector<uint8_t>& visibility) const
+    {
+        BEE_PROFILE_FUNCTION();
+        const size_t count = batch.Size();
+        visibility.assign(count, 1);
+        const float* centerX = batch.m_CenterX.data();
+        const float* centerY = batch.m_CenterY.data();
+        const float* centerZ = batch.m_CenterZ.data();
+        const float* extentX = batch.m_ExtentX.data();
+        const float* extentY = batch.m_ExtentY.data();
+        const float* extentZ = batch.m_ExtentZ.data();
+        uint8_t* visible = visibility.data();
+        // One plane at a time over contiguous arrays without branches, so the inner loop is vectorized
+        for (const auto& plane : m_Planes)
+        {
+            const float nx = plane.Normal.x, ny = plane.Normal.y, nz = plane.Normal.z, w = plane.Constant;
+            const float ax = plane.AbsoluteNormal.x, ay = plane.AbsoluteNormal.y, az = plane.AbsoluteNormal.z;
+            for (size_t i = 0; i < count; ++i)
+            {
+                const float distance = nx * centerX[i] + ny * centerY[i] + nz * centerZ[i] + w;
+                const float radius = ax * extentX[i] + ay * extentY[i] + az * extentZ[i];
+                visible[i] &= static_cast<uint8_t>(distance + radius >= 0.0f);
+            }
+        }
+        size_t visibleCount = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            visibleCount += visible[i];
+        }
+        return visibleCount;
+    }
+} // namespace BeeEngine
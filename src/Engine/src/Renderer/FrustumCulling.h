@@ -0,0 +1,101 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#pragma once
+#include "Core/Math/AABB.h"
+#include <array>
+#include <cstdint>
+#include <glm/glm.hpp>
+#include <span>
+#include <vector>
+
+namespace BeeEngine
+{
+    /**
+     * @brief Extracts the six planes of the frustum from a view projection matrix
+     * (left, right, top, bottom, near, far). Normals are normalized and point inside of the frustum
+     */
+    std::vector<glm::vec4> GetFrustumPlanes(const glm::mat4& viewProj);
+
+    /**
+     * @brief Clip space depth of the center of the box before the perspective divide.
+     * Grows with the distance from the camera for both perspective and orthographic projections
+     */
+    float GetViewDepth(const glm::mat4& viewProj, const Math::AABB& bounds);
+
+    /**
+     * @brief Part of the screen in [0, 1], that the projection of the box covers.
+     * Boxes, that cross the camera plane, are assumed to cover the whole screen
+     */
+    float GetScreenCoverage(const glm::mat4& viewProj, const Math::AABB& bounds);
+
+    /**
+     * @brief Larger side of the screen space rectangle of the box relative to the size of the screen.
+     * Unlike the coverage it is not clipped to the screen, so it does not change, when the box leaves it.
+     * Empty boxes (unknown bounds) and boxes, that cross the camera plane, are assumed to fill the screen
+     */
+    float GetScreenSize(const glm::mat4& viewProj, const Math::AABB& bounds);
+
+    /**
+     * @brief World space bounds of many renderables in structure of arrays layout.
+     * Boxes are stored as center and extents, so the plane test for
+     * a batch is a branchless loop, that the compiler can vectorize.
+     */
+    class BoundsBatch
+    {
+    public:
+        void Reserve(size_t count);
+        void Clear();
+        /**
+         * @brief Adds the box to the batch.
+         * @return index of the box in the batch
+         */
+        size_t Add(const Math::AABB& bounds);
+        [[nodiscard]] size_t Size() const { return m_CenterX.size(); }
+        [[nodiscard]] bool Empty() const { return m_CenterX.empty(); }
+
+    private:
+        friend class FrustumCuller;
+        std::vector<float> m_CenterX;
+        std::vector<float> m_CenterY;
+        std::vector<float> m_CenterZ;
+        std::vector<float> m_ExtentX;
+        std::vector<float> m_ExtentY;
+        std::vector<float> m_ExtentZ;
+    };
+
+    /**
+     * @brief Tests bounding boxes against the planes of a camera frustum.
+     * Expects planes in the format of GetFrustumPlanes: xyz is the normal, that
+     * points inside of the frustum, w is the plane constant.
+     */
+    class FrustumCuller
+    {
+    public:
+        static constexpr size_t NumberOfPlanes = 6;
+
+        explicit FrustumCuller(std::span<const glm::vec4> planes);
+
+        /**
+         * @brief Tests a single box. Empty boxes (unknown bounds) are always visible
+         */
+        [[nodiscard]] bool IsVisible(const Math::AABB& bounds) const;
+
+        /**
+         * @brief Tests every box of the batch.
+         * @param visibility is resized to the size of the batch, 1 - visible, 0 - culled
+         * @return number of visible boxes
+         */
+        size_t Cull(const BoundsBatch& batch, std::vector<uint8_t>& visibility) const;
+
+    private:
+        struct Plane
+        {
+            glm::vec3 Normal;
+            float Constant;
+            glm::vec3 AbsoluteNormal;
+        };
+        std::array<Plane, NumberOfPlanes> m_Planes;
+    };
+} // namespace BeeEngine
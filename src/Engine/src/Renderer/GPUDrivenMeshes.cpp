@@ -0,0 +1,242 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#include "GPUDrivenMeshes.h"
+#include "Core/CodeSafety/Expects.h"
+#include "Debug/Instrumentor.h"
+#include "Model.h"
+#include "Pipeline.h"
+#include "Renderer.h"
+#include "RenderingQueue.h"
+#include "ShaderModule.h"
+#include <algorithm>
+#include <cstring>
+
+namespace BeeEngine
+{
+    GPUDrivenMeshes::~GPUDrivenMeshes()
+    {
+        auto& statistics = Internal::RenderingQueue::s_Statistics;
+        statistics.AllocatedGPUMemory -= m_AllocatedGPUMemory;
+        statistics.AllocatedGPUBuffers -= m_AllocatedGPUBuffers;
+    }
+
+    void GPUDrivenMeshes::Add(Model& model,
+                              std::span<BindingSet* const> bindingSets,
+                              const glm::mat4& transform,
+                              int32_t entityID,
+                              const Math::AABB& worldBounds)
+    {
+        BeeExpects(model.IsIndexed());
+        const Internal::DrawState state{model, bindingSets};
+        auto [it, inserted] = m_DrawIndices.try_emplace(state, static_cast<uint32_t>(m_Draws.size()));
+        if (inserted)
+        {
+            const auto firstCommand = static_cast<uint32_t>(m_Commands.size());
+            const auto& surfaces = model.GetMesh().Surfaces;
+            if (surfaces.empty())
+            {
+                m_Commands.push_back({model.GetIndexCount(), 0, 0, 0, 0});
+            }
+            for (const auto& surface : surfaces)
+            {
+                m_Commands.push_back({surface.count, 0, surface.startIndex, 0, 0});
+            }
+            m_Draws.push_back({.State = state,
+                               .FirstCommand = firstCommand,
+                               .CommandCount = static_cast<uint32_t>(m_Commands.size()) - firstCommand,
+                               .InstanceCount = 0});
+        }
+        m_Draws[it->second].InstanceCount++;
+
+        Instance& instance = m_Instances.emplace_back();
+        instance.Model = transform;
+        if (worldBounds.IsEmpty())
+        {
+            instance.Extents = {0.0f, 0.0f, 0.0f, -1.0f};
+        }
+        else
+        {
+            instance.Center = {worldBounds.GetCenter(), 1.0f};
+            instance.Extents = {worldBounds.GetExtents(), 0.0f};
+        }
+        instance.EntityID = entityID;
+        instance.DrawIndex = it->second;
+    }
+
+    void GPUDrivenMeshes::Cull(std::span<const glm::vec4> frustumPlanes)
+    {
+        BEE_PROFILE_FUNCTION();
+        BeeExpects(frustumPlanes.size() == 6);
+        m_CurrentSlot = nullptr;
+        if (m_Instances.empty())
+        {
+            return;
+        }
+        if (!m_Pipeline)
+        {
+            m_Pipeline =
+                Pipeline::Create(ShaderModule::Create("Shaders/Renderer_MeshCulling.comp", ShaderType::Compute));
+        }
+        // Every draw gets a range of the visible instance buffer, that is large enough for all its instances.
+        // Commands of the draw share the range, the compute pass counts the visible instances in them
+        uint32_t firstInstance = 0;
+        m_GPUDraws.clear();
+        for (const auto& draw : m_Draws)
+        {
+            for (uint32_t i = draw.FirstCommand; i < draw.FirstCommand + draw.CommandCount; ++i)
+            {
+                m_Commands[i].InstanceCount = 0;
+                m_Commands[i].FirstInstance = firstInstance;
+            }
+            m_GPUDraws.push_back({draw.FirstCommand, draw.CommandCount});
+            firstInstance += draw.InstanceCount;
+        }
+
+        Slot& slot = AcquireSlot();
+        bool recreated = Reserve(slot.Parameters, sizeof(CullingParameters), StorageBufferUsage::CPUToGPU);
+        if (Reserve(slot.Instances, m_Instances.size() * sizeof(Instance), StorageBufferUsage::CPUToGPU))
+        {
+            slot.UploadedInstances.clear();
+            recreated = true;
+        }
+        recreated |= Reserve(slot.Draws, m_GPUDraws.size() * sizeof(GPUDraw), StorageBufferUsage::CPUToGPU);
+        recreated |=
+            Reserve(slot.Commands, m_Commands.size() * sizeof(IndirectDrawCommand), StorageBufferUsage::CPUToGPU);
+        recreated |=
+            Reserve(slot.VisibleInstances, m_Instances.size() * sizeof(VisibleInstance), StorageBufferUsage::GPUOnly);
+        if (recreated || !slot.Bindings)
+        {
+            slot.Bindings = BindingSet::Create({{0, *slot.Parameters},
+                                                {1, *slot.Instances},
+                                                {2, *slot.Draws},
+                                                {3, *slot.Commands},
+                                                {4, *slot.VisibleInstances}});
+        }
+
+        CullingParameters parameters{};
+        std::copy(frustumPlanes.begin(), frustumPlanes.end(), parameters.Planes.begin());
+        parameters.InstanceCount = static_cast<uint32_t>(m_Instances.size());
+        slot.Parameters->SetData(0, {reinterpret_cast<const byte*>(&parameters), sizeof(CullingParameters)});
+        UploadInstances(slot);
+        slot.Draws->SetData(0, {reinterpret_cast<const byte*>(m_GPUDraws.data()), m_GPUDraws.size() * sizeof(GPUDraw)});
+        slot.Commands->SetData(
+            0, {reinterpret_cast<const byte*>(m_Commands.data()), m_Commands.size() * sizeof(IndirectDrawCommand)});
+
+        const auto groupCount = static_cast<uint32_t>((m_Instances.size() + WorkGroupSize - 1) / WorkGroupSize);
+        Renderer::Dispatch(*m_Pipeline, {slot.Bindings.get()}, groupCount);
+        m_CurrentSlot = &slot;
+
+        auto& statistics = Internal::RenderingQueue::s_Statistics;
+        statistics.ComputeDispatchCount++;
+        statistics.GPUDrivenInstanceCount += m_Instances.size();
+    }
+
+    void GPUDrivenMeshes::Draw(CommandBuffer& commandBuffer)
+    {
+        BEE_PROFILE_FUNCTION();
+        BeeExpects(m_CurrentSlot || m_Instances.empty());
+        if (m_CurrentSlot)
+        {
+            auto& statistics = Internal::RenderingQueue::s_Statistics;
+            for (const auto& draw : m_Draws)
+            {
+                m_BindingSets.assign(draw.State.GetBindingSets().begin(), draw.State.GetBindingSets().end());
+                Renderer::DrawIndexedIndirect(commandBuffer,
+                                              *draw.State.Model,
+                                              *m_CurrentSlot->VisibleInstances,
+                                              m_BindingSets,
+                                              *m_CurrentSlot->Commands,
+                                              draw.FirstCommand * sizeof(IndirectDrawCommand),
+                                              draw.CommandCount);
+                statistics.DrawCallCount++;
+            }
+        }
+        m_Instances.clear();
+        m_Draws.clear();
+        m_DrawIndices.clear();
+        m_Commands.clear();
+    }
+
+    StorageBuffer& GPUDrivenMeshes::GetCommandBuffer() const
+    {
+        BeeExpects(m_CurrentSlot);
+        return *m_CurrentSlot->Commands;
+    }
+
+    StorageBuffer& GPUDrivenMeshes::GetVisibleInstanceBuffer() const
+    {
+        BeeExpects(m_CurrentSlot);
+        return *m_CurrentSlot->VisibleInstances;
+    }
+
+    GPUDrivenMeshes::Slot& GPUDrivenMeshes::AcquireSlot()
+    {
+        const uint64_t frame = Renderer::GetFrameNumber();
+        if (frame != m_SlotFrame)
+        {
+            m_SlotFrame = frame;
+            m_PassesThisFrame = 0;
+        }
+        auto& slots = m_Slots[frame % Renderer::FramesInFlight];
+        if (m_PassesThisFrame == slots.size())
+        {
+            slots.emplace_back();
+        }
+        return slots[m_PassesThisFrame++];
+    }
+
+    bool GPUDrivenMeshes::Reserve(Scope<StorageBuffer>& buffer, size_t size, StorageBufferUsage usage)
+    {
+        if (buffer && buffer->GetSize() >= size)
+        {
+            return false;
+        }
+        auto& statistics = Internal::RenderingQueue::s_Statistics;
+        if (buffer)
+        {
+            m_AllocatedGPUMemory -= buffer->GetSize();
+            statistics.AllocatedGPUMemory -= buffer->GetSize();
+            m_AllocatedGPUBuffers--;
+            statistics.AllocatedGPUBuffers--;
+            // Previous buffer is destroyed, when the frames in flight, which may read it, are completed
+            Renderer::DestroyAfterFramesInFlight([previous = Ref<StorageBuffer>(std::move(buffer))]() mutable
+                                                 { previous.reset(); });
+        }
+        const size_t newSize = std::max(size * 2, size_t{256});
+        buffer = StorageBuffer::Create(newSize, usage);
+        m_AllocatedGPUMemory += newSize;
+        statistics.AllocatedGPUMemory += newSize;
+        m_AllocatedGPUBuffers++;
+        statistics.AllocatedGPUBuffers++;
+        return true;
+    }
+
+    void GPUDrivenMeshes::UploadInstances(Slot& slot)
+    {
+        // Most instances are the same as FramesInFlight frames ago, when the slot was used last time,
+        // so only the range between the first and the last changed instance is uploaded
+        auto& uploaded = slot.UploadedInstances;
+        const size_t count = m_Instances.size();
+        auto equal = [&](size_t i)
+        { return i < uploaded.size() && memcmp(&uploaded[i], &m_Instances[i], sizeof(Instance)) == 0; };
+        size_t begin = 0;
+        while (begin < count && equal(begin))
+        {
+            ++begin;
+        }
+        size_t end = count;
+        while (end > begin && equal(end - 1))
+        {
+            --end;
+        }
+        if (begin < end)
+        {
+            slot.Instances->SetData(begin * sizeof(Instance),
+                                    {reinterpret_cast<const byte*>(m_Instances.data() + begin),
+                                     (end - begin) * sizeof(Instance)});
+        }
+        uploaded.assign(m_Instances.begin(), m_Instances.end());
+    }
+} // namespace BeeEngine
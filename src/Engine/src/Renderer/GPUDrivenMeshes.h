@@ -0,0 +1,145 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#pragma once
+#include "BindingSet.h"
+#include "Core/Math/AABB.h"
+#include "Core/TypeDefines.h"
+#include "DrawPacket.h"
+#include "Renderer.h"
+#include "RendererAPI.h"
+#include "StorageBuffer.h"
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <glm/glm.hpp>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace BeeEngine
+{
+    class CommandBuffer;
+    class Model;
+    class Pipeline;
+
+    /**
+     * @brief Instances of indexed mesh models, that are culled by a compute pass and drawn with indirect draw calls.
+     * Instances are added every frame, their data and bounds are written to storage buffers, and only the range,
+     * that differs from the last upload into the same buffers, is uploaded. The compute pass tests them against the
+     * frustum and compacts the visible ones into the instance buffer of the draws, so the CPU neither culls nor
+     * sorts them. Every model is drawn with one multi draw call, that has one command per surface of its mesh.
+     * Requires Renderer::SupportsIndirectDrawing
+     */
+    class GPUDrivenMeshes
+    {
+    public:
+        static constexpr uint32_t WorkGroupSize = 64;
+
+        // Instance layout of Renderer_MeshCulling.comp
+        struct Instance
+        {
+            glm::mat4 Model;
+            glm::vec4 Center;
+            // w < 0 for unknown bounds, such instances are always visible
+            glm::vec4 Extents;
+            int32_t EntityID;
+            uint32_t DrawIndex;
+            uint32_t Padding[2];
+        };
+        static_assert(sizeof(Instance) == 112);
+
+        // Instance data of the mesh shader, that the compute pass writes for visible instances
+        struct VisibleInstance
+        {
+            glm::mat4 Model;
+            int32_t EntityID;
+        };
+        static_assert(sizeof(VisibleInstance) == 68);
+
+        GPUDrivenMeshes() = default;
+        ~GPUDrivenMeshes();
+        GPUDrivenMeshes(const GPUDrivenMeshes&) = delete;
+        GPUDrivenMeshes& operator=(const GPUDrivenMeshes&) = delete;
+
+        /**
+         * @brief Adds an instance for this frame. Instances of the same model and binding sets share a draw call
+         */
+        void Add(Model& model,
+                 std::span<BindingSet* const> bindingSets,
+                 const glm::mat4& transform,
+                 int32_t entityID,
+                 const Math::AABB& worldBounds);
+        /**
+         * @brief Uploads the instances of this frame and dispatches the culling pass. Called before Draw
+         */
+        void Cull(std::span<const glm::vec4> frustumPlanes);
+        /**
+         * @brief Records the indirect draw calls and removes the instances of this frame
+         */
+        void Draw(CommandBuffer& commandBuffer);
+
+        [[nodiscard]] size_t GetInstanceCount() const { return m_Instances.size(); }
+        [[nodiscard]] size_t GetDrawCount() const { return m_Draws.size(); }
+        /**
+         * @brief Buffers, that the last Cull used. For tests and debugging
+         */
+        [[nodiscard]] StorageBuffer& GetCommandBuffer() const;
+        [[nodiscard]] StorageBuffer& GetVisibleInstanceBuffer() const;
+
+    private:
+        struct IndirectDraw
+        {
+            Internal::DrawState State;
+            uint32_t FirstCommand;
+            uint32_t CommandCount;
+            uint32_t InstanceCount;
+        };
+        // Draw layout of Renderer_MeshCulling.comp
+        struct GPUDraw
+        {
+            uint32_t FirstCommand;
+            uint32_t CommandCount;
+        };
+        struct CullingParameters
+        {
+            std::array<glm::vec4, 6> Planes;
+            uint32_t InstanceCount;
+        };
+        // Buffers of one culling pass. Passes of a frame use different slots, that are reused after
+        // FramesInFlight frames, so the CPU never writes data, which the GPU still reads
+        struct Slot
+        {
+            Scope<StorageBuffer> Parameters;
+            Scope<StorageBuffer> Instances;
+            Scope<StorageBuffer> Draws;
+            Scope<StorageBuffer> Commands;
+            Scope<StorageBuffer> VisibleInstances;
+            Scope<BindingSet> Bindings;
+            // Instances, that are stored in the buffer
+            std::vector<Instance> UploadedInstances;
+        };
+
+        Slot& AcquireSlot();
+        bool Reserve(Scope<StorageBuffer>& buffer, size_t size, StorageBufferUsage usage);
+        void UploadInstances(Slot& slot);
+
+        std::vector<Instance> m_Instances;
+        std::vector<IndirectDraw> m_Draws;
+        std::unordered_map<Internal::DrawState, uint32_t> m_DrawIndices;
+        std::vector<IndirectDrawCommand> m_Commands;
+        std::vector<GPUDraw> m_GPUDraws;
+
+        Ref<Pipeline> m_Pipeline;
+        // Deque keeps slots in place, when passes are added
+        std::array<std::deque<Slot>, Renderer::FramesInFlight> m_Slots;
+        Slot* m_CurrentSlot = nullptr;
+        uint64_t m_SlotFrame = 0;
+        uint32_t m_PassesThisFrame = 0;
+
+        std::vector<BindingSet*> m_BindingSets;
+        size_t m_AllocatedGPUMemory = 0;
+        size_t m_AllocatedGPUBuffers = 0;
+    };
+} // namespace BeeEngine
@@ -40,5 +40,15 @@ namespace BeeEngine
         // virtual void Bind(uint32_t slot = 0) = 0;
         virtual std::vector<BindGroupLayoutEntryType> GetBindGroupLayoutEntry() const = 0;
         virtual std::vector<BindGroupEntryType> GetBindGroupEntry() const = 0;
+        /**
+         * @brief Offset in bytes, that is added to the start of the bound range, when the binding set is bound.
+         * Only uniform buffers have one, they are bound as dynamic uniform buffers
+         */
+        virtual uint32_t GetDynamicOffset() const { return 0; }
+        /**
+         * @brief Changes, when the underlying resource is recreated, so binding sets, which use it, rewrite
+         * their descriptors before they are bound
+         */
+        virtual uint32_t GetResourceGeneration() const { return 0; }
     };
 } // namespace BeeEngine
\ No newline at end of file
@@ -0,0 +1,91 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#include "InstanceRingBuffer.h"
+#include "Core/CodeSafety/Expects.h"
+#include "Debug/Instrumentor.h"
+#include "Renderer.h"
+#include "RenderingQueue.h"
+#include <algorithm>
+#include <bit>
+
+namespace BeeEngine
+{
+    namespace
+    {
+        // Swap chain has waited for the GPU to finish the frame, when FramesInFlight frames have ended after it
+        bool IsCompleted(uint64_t frame)
+        {
+            return frame + Renderer::FramesInFlight <= Renderer::GetFrameNumber();
+        }
+    } // namespace
+
+    InstanceRingBuffer::InstanceRingBuffer(size_t size)
+    {
+        CreateBuffer(size);
+    }
+
+    InstanceRingBuffer::~InstanceRingBuffer()
+    {
+        // Queue can be destroyed in the frame, that rendered with it, e.g. together with its frame buffer
+        RetireBuffer(std::move(m_Buffer));
+    }
+
+    InstanceRingBuffer::Allocation InstanceRingBuffer::Allocate(size_t size)
+    {
+        ReleaseCompletedFrames();
+        auto offset = m_Allocator.Allocate(size, Alignment);
+        if (!offset)
+        {
+            Grow(size);
+            offset = m_Allocator.Allocate(size, Alignment);
+            BeeEnsures(offset.has_value());
+        }
+        return {*m_Buffer, *offset};
+    }
+
+    void InstanceRingBuffer::FinishFrame()
+    {
+        m_Allocator.FinishFrame();
+        m_FinishedFrames.push_back(Renderer::GetFrameNumber());
+    }
+
+    void InstanceRingBuffer::ReleaseCompletedFrames()
+    {
+        while (!m_FinishedFrames.empty() && IsCompleted(m_FinishedFrames.front()))
+        {
+            m_FinishedFrames.pop_front();
+            m_Allocator.ReleaseFrame();
+        }
+    }
+
+    void InstanceRingBuffer::Grow(size_t size)
+    {
+        BEE_PROFILE_FUNCTION();
+        RetireBuffer(std::move(m_Buffer));
+        m_FinishedFrames.clear();
+        CreateBuffer(std::max(m_Allocator.GetCapacity() * 2, std::bit_ceil(size + Alignment)));
+    }
+
+    void InstanceRingBuffer::CreateBuffer(size_t size)
+    {
+        m_Buffer = InstancedBuffer::Create(size);
+        m_Allocator.Reset(size);
+        auto& statistics = Internal::RenderingQueue::s_Statistics;
+        statistics.AllocatedGPUMemory += size;
+        statistics.AllocatedGPUBuffers++;
+    }
+
+    void InstanceRingBuffer::RetireBuffer(Scope<InstancedBuffer>&& buffer)
+    {
+        Renderer::DestroyAfterFramesInFlight(
+            [buffer = Ref<InstancedBuffer>(std::move(buffer))]() mutable
+            {
+                auto& statistics = Internal::RenderingQueue::s_Statistics;
+                statistics.AllocatedGPUMemory -= buffer->GetSize();
+                statistics.AllocatedGPUBuffers--;
+                buffer.reset();
+            });
+    }
+} // namespace BeeEngine
@@ -0,0 +1,56 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#pragma once
+#include "Core/TypeDefines.h"
+#include "InstancedBuffer.h"
+#include "RingOffsetAllocator.h"
+#include <cstdint>
+#include <deque>
+
+namespace BeeEngine
+{
+    /**
+     * @brief Persistently mapped instance buffer, that is shared by all draws of a rendering queue.
+     * Every draw gets its own aligned range, so the buffer is never rewritten while the GPU reads it.
+     * Ranges of a frame are reused Renderer::FramesInFlight frames later, when the GPU has finished the frame.
+     * If the free space is not enough, a twice larger buffer replaces it and the old one is destroyed,
+     * when the frames, that use it, are completed
+     */
+    class InstanceRingBuffer
+    {
+    public:
+        static constexpr size_t Alignment = 16;
+
+        struct Allocation
+        {
+            InstancedBuffer& Buffer;
+            size_t Offset;
+        };
+
+        explicit InstanceRingBuffer(size_t size);
+        ~InstanceRingBuffer();
+        InstanceRingBuffer(const InstanceRingBuffer&) = delete;
+        InstanceRingBuffer& operator=(const InstanceRingBuffer&) = delete;
+
+        Allocation Allocate(size_t size);
+        /**
+         * @brief Closes the ranges, that were allocated since the last call. They are released,
+         * when Renderer::FramesInFlight frames have ended after the current one
+         */
+        void FinishFrame();
+
+    private:
+        void Grow(size_t size);
+        void ReleaseCompletedFrames();
+        void CreateBuffer(size_t size);
+        // Draws of this frame and of the frames in flight may still read the buffer
+        static void RetireBuffer(Scope<InstancedBuffer>&& buffer);
+
+        Scope<InstancedBuffer> m_Buffer;
+        RingOffsetAllocator m_Allocator;
+        // Renderer frame number, when each finished frame of m_Allocator was finished
+        std::deque<uint64_t> m_FinishedFrames;
+    };
+} // namespace BeeEngine
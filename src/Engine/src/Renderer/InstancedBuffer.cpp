@@ -2,10 +2,12 @@
 // Created by alexl on 17.07.2023.
 //
 #include "InstancedBuffer.h"
+#include "Platform/Null/NullInstancedBuffer.h"
 
 #include "Platform/Vulkan/VulkanInstancedBuffer.h"
 #include "Platform/WebGPU/WebGPUInstancedBuffer.h"
 #include "Renderer.h"
+#include <algorithm>
 
 BeeEngine::Scope<BeeEngine::InstancedBuffer> BeeEngine::InstancedBuffer::Create(size_t size)
 {
@@ -19,7 +21,20 @@ BeeEngine::Scope<BeeEngine::InstancedBuffer> BeeEngine::InstancedBuffer::Create(
         case Vulkan:
             return BeeEngine::CreateScope<BeeEngine::Internal::VulkanInstancedBuffer>(size);
 #endif
+        case Null:
+            return BeeEngine::CreateScope<BeeEngine::Internal::NullInstancedBuffer>(size);
     }
     BeeCoreError("Unknown RendererAPI!");
     return nullptr;
 }
+
+gsl::span<BeeEngine::byte> BeeEngine::InstancedBuffer::BeginWrite(size_t offset, size_t size)
+{
+    m_Staging.resize(std::max(m_Staging.size(), size));
+    return {m_Staging.data(), size};
+}
+
+void BeeEngine::InstancedBuffer::EndWrite(size_t offset, size_t size)
+{
+    UpdateRange(offset, {m_Staging.data(), size});
+}
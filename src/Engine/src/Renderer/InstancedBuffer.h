@@ -6,6 +6,8 @@
 
 #include "BufferLayout.h"
 #include "Core/TypeDefines.h"
+#include <gsl/span>
+#include <vector>
 
 namespace BeeEngine
 {
@@ -14,10 +16,6 @@ namespace BeeEngine
 
 namespace BeeEngine
 {
-    namespace Internal
-    {
-        class RenderingQueue;
-    }
     class InstancedBuffer
     {
     public:
@@ -26,18 +24,30 @@ namespace BeeEngine
         InstancedBuffer(const InstancedBuffer& other) = delete;
         InstancedBuffer& operator=(const InstancedBuffer& other) = delete;
         virtual void SetData(void* data, size_t size) = 0;
-        virtual void Bind(CommandBuffer& cmd) = 0;
+        /**
+         * @brief Returns memory, that size bytes of instance data at the offset are written to.
+         * Buffers with persistently mapped memory return the mapped memory itself,
+         * others return a staging buffer, that is uploaded in EndWrite
+         */
+        virtual gsl::span<byte> BeginWrite(size_t offset, size_t size);
+        /**
+         * @brief Makes the data written after BeginWrite visible to the GPU
+         */
+        virtual void EndWrite(size_t offset, size_t size);
+        /**
+         * @brief Writes data at the offset and leaves the rest of the buffer as it is
+         */
+        virtual void UpdateRange(size_t offset, gsl::span<const byte> data) = 0;
+        /**
+         * @brief Binds the buffer, so the first instance is read at the offset in bytes
+         */
+        virtual void Bind(CommandBuffer& cmd, size_t offset) = 0;
         virtual size_t GetSize() = 0;
 
         static Scope<InstancedBuffer> Create(size_t size);
 
-        bool IsSubmitted() const { return m_IsSubmitted; }
-
     private:
-        friend class ::BeeEngine::Internal::RenderingQueue;
-        bool m_IsSubmitted = false;
-        void Submit() { m_IsSubmitted = true; }
-        void ResetSubmition() { m_IsSubmitted = false; }
+        std::vector<byte> m_Staging;
         // virtual size_t GetMaxInstances() = 0;
         // virtual size_t GetOneInstanceSize() = 0;
         // virtual size_t GetSize() = 0;
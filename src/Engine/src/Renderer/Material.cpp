@@ -7,6 +7,7 @@
 #include "Core/Application.h"
 #include "Core/AssetManagement/AssetManager.h"
 #include "MaterialData.h"
+#include "Platform/Null/NullMaterial.h"
 #include "Platform/Vulkan/VulkanMaterial.h"
 #include "Platform/WebGPU/WebGPUMaterial.h"
 #include "Renderer.h"
@@ -24,12 +25,19 @@ namespace BeeEngine
             case Vulkan:
                 return CreateRef<Internal::VulkanMaterial>(vertexShader, fragmentShader);
 #endif
+            case Null:
+                return CreateRef<Internal::NullMaterial>(vertexShader, fragmentShader);
             default:
                 BeeCoreError("Unknown RendererAPI");
                 return nullptr;
         }
     }
     static String defaultLocale = "en_En";
+    Ref<UniformBufferPool::Element> MaterialInstance::AllocateDataBuffer()
+    {
+        static UniformBufferPool pool(sizeof(MaterialData));
+        return pool.Allocate();
+    }
     GPUTextureResource* MaterialInstance::GetColorTexture() const
     {
         if (!AssetManager::IsAssetHandleValid(colorTexture))
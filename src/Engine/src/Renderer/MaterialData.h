@@ -4,9 +4,10 @@
 
 #pragma once
 #include <glm/glm.hpp>
+#include <optional>
 
 #include "Texture.h"
-#include "UniformBuffer.h"
+#include "UniformBufferPool.h"
 
 namespace BeeEngine
 {
@@ -14,6 +15,8 @@ namespace BeeEngine
     {
         glm::vec4 colorFactors = glm::vec4(1.0f);
         glm::vec4 metalRoughFactors; // x - metalness, y - roughness
+
+        bool operator==(const MaterialData& other) const = default;
     };
 
     struct MaterialInstance
@@ -21,12 +24,15 @@ namespace BeeEngine
         MaterialData data;
         AssetHandle colorTexture;
         AssetHandle metalRoughTexture;
-        Ref<UniformBuffer> dataBuffer = UniformBuffer::Create(sizeof(MaterialData));
+        Ref<UniformBufferPool::Element> dataBuffer = AllocateDataBuffer();
         Ref<BindingSet> bindingSet =
             BindingSet::Create({{0, *dataBuffer}, {1, *GetColorTexture()}, {3, *GetMetalRoughTexture()}});
+        // Data in dataBuffer. LoadData is called every frame, but uploads only, if data differs from it
+        std::optional<MaterialData> uploadedData;
 
         [[nodiscard]] GPUTextureResource* GetColorTexture() const;
         [[nodiscard]] GPUTextureResource* GetMetalRoughTexture() const;
+        static Ref<UniformBufferPool::Element> AllocateDataBuffer();
         void RebuildBindingSet()
         {
             bindingSet = BindingSet::Create({{0, *dataBuffer}, {1, *GetColorTexture()}, {3, *GetMetalRoughTexture()}});
@@ -35,11 +41,17 @@ namespace BeeEngine
         {
             if (dataBuffer == nullptr)
             {
-                dataBuffer = UniformBuffer::Create(sizeof(MaterialData));
+                dataBuffer = AllocateDataBuffer();
                 bindingSet =
                     BindingSet::Create({{0, *dataBuffer}, {1, *GetColorTexture()}, {3, *GetMetalRoughTexture()}});
+                uploadedData.reset();
+            }
+            if (uploadedData == data)
+            {
+                return;
             }
             dataBuffer->SetData(&data, sizeof(MaterialData));
+            uploadedData = data;
         }
     };
 } // namespace BeeEngine
@@ -2,6 +2,7 @@
 // Created by Александр Лебедев on 27.06.2023.
 //
 #include "Mesh.h"
+#include "Platform/Null/NullMesh.h"
 
 #include "Platform/Vulkan/VulkanMesh.h"
 #include "Platform/WebGPU/WebGPUMesh.h"
@@ -11,37 +12,53 @@ namespace BeeEngine
 {
     Ref<Mesh> Mesh::Create(in<std::vector<Vertex>> vertices)
     {
+        Ref<Mesh> mesh;
         switch (Renderer::GetAPI())
         {
 #if defined(BEE_COMPILE_WEBGPU)
             case WebGPU:
-                return CreateRef<Internal::WebGPUMesh>(vertices);
+                mesh = CreateRef<Internal::WebGPUMesh>(vertices);
+                break;
 #endif
 #if defined(BEE_COMPILE_VULKAN)
             case Vulkan:
-                return CreateRef<Internal::VulkanMesh>(vertices);
+                mesh = CreateRef<Internal::VulkanMesh>(vertices);
+                break;
 #endif
+            case Null:
+                mesh = CreateRef<Internal::NullMesh>(vertices.size(), 0);
+                break;
             default:
                 BeeCoreError("Unknown API!");
                 return nullptr;
         }
+        mesh->SetLocalBounds(Math::AABB::FromVertices(std::span<const Vertex>{vertices}, &Vertex::Position));
+        return mesh;
     }
     Ref<Mesh> Mesh::Create(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices)
     {
+        Ref<Mesh> mesh;
         switch (Renderer::GetAPI())
         {
 #if defined(BEE_COMPILE_WEBGPU)
             case WebGPU:
-                return CreateRef<Internal::WebGPUMesh>(vertices, indices);
+                mesh = CreateRef<Internal::WebGPUMesh>(vertices, indices);
+                break;
 #endif
 #if defined(BEE_COMPILE_VULKAN)
             case Vulkan:
-                return CreateRef<Internal::VulkanMesh>(vertices, indices);
+                mesh = CreateRef<Internal::VulkanMesh>(vertices, indices);
+                break;
 #endif
+            case Null:
+                mesh = CreateRef<Internal::NullMesh>(vertices.size(), indices.size());
+                break;
             default:
                 BeeCoreError("Unknown API!");
                 return nullptr;
         }
+        mesh->SetLocalBounds(Math::AABB::FromVertices(std::span<const Vertex>{vertices}, &Vertex::Position));
+        return mesh;
     }
 
     Ref<Mesh> Mesh::Create(void* verticesData, size_t size, size_t vertexCount, const std::vector<uint32_t>& indices)
@@ -56,6 +73,8 @@ namespace BeeEngine
             case Vulkan:
                 return CreateRef<Internal::VulkanMesh>(verticesData, size, vertexCount, indices);
 #endif
+            case Null:
+                return CreateRef<Internal::NullMesh>(vertexCount, indices.size());
             default:
                 BeeCoreError("Unknown API!");
                 return nullptr;
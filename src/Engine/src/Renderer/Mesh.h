@@ -6,6 +6,7 @@
 #include "BufferLayout.h"
 #include "CommandBuffer.h"
 #include "Core/AssetManagement/Asset.h"
+#include "Core/Math/AABB.h"
 #include "Core/TypeDefines.h"
 #include "Vertex.h"
 
@@ -36,6 +37,12 @@ namespace BeeEngine
         [[nodiscard]] virtual uint32_t GetIndexCount() const = 0;
         virtual void Bind(CommandBuffer& commandBuffer) = 0;
         [[nodiscard]] virtual bool IsIndexed() const = 0;
+        /**
+         * @brief Bounds of the vertices in model space. Empty, if they are unknown
+         * (the mesh is never culled then)
+         */
+        [[nodiscard]] const Math::AABB& GetLocalBounds() const { return m_LocalBounds; }
+        void SetLocalBounds(const Math::AABB& bounds) { m_LocalBounds = bounds; }
 
         Mesh(const Mesh& other) = delete;
         Mesh& operator=(const Mesh& other) = delete;
@@ -43,5 +50,8 @@ namespace BeeEngine
         static Ref<Mesh> Create(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices);
         static Ref<Mesh>
         Create(void* verticesData, size_t size, size_t vertexCount, const std::vector<uint32_t>& indices);
+
+    private:
+        Math::AABB m_LocalBounds;
     };
 } // namespace BeeEngine
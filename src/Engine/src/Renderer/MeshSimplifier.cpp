@@ -0,0 +1,424 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#include "MeshSimplifier.h"
+#include "Core/CodeSafety/Expects.h"
+#include "Core/Math/AABB.h"
+#include "Debug/Instrumentor.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <functional>
+#include <numeric>
+#include <queue>
+#include <tuple>
+#include <unordered_map>
+
+namespace BeeEngine
+{
+    namespace
+    {
+        // Border planes are much more expensive to leave than the planes of the surface
+        constexpr double BorderWeight = 1000.0;
+        // Collapses, that turn a triangle by more than ~75 degrees, are treated as flips
+        constexpr double MinNormalAgreement = 0.25;
+
+        /**
+         * @brief Sum of squared distances to a set of planes, stored as the upper triangle of a symmetric 4x4 matrix
+         */
+        struct Quadric
+        {
+            double A00 = 0, A01 = 0, A02 = 0, A03 = 0;
+            double A11 = 0, A12 = 0, A13 = 0;
+            double A22 = 0, A23 = 0;
+            double A33 = 0;
+
+            static Quadric FromPlane(const glm::dvec3& normal, double distance, double weight)
+            {
+                Quadric q;
+                q.A00 = weight * normal.x * normal.x;
+                q.A01 = weight * normal.x * normal.y;
+                q.A02 = weight * normal.x * normal.z;
+                q.A03 = weight * normal.x * distance;
+                q.A11 = weight * normal.y * normal.y;
+                q.A12 = weight * normal.y * normal.z;
+                q.A13 = weight * normal.y * distance;
+                q.A22 = weight * normal.z * normal.z;
+                q.A23 = weight * normal.z * distance;
+                q.A33 = weight * distance * distance;
+                return q;
+            }
+
+            Quadric& operator+=(const Quadric& other)
+            {
+                A00 += other.A00;
+                A01 += other.A01;
+                A02 += other.A02;
+                A03 += other.A03;
+                A11 += other.A11;
+                A12 += other.A12;
+                A13 += other.A13;
+                A22 += other.A22;
+                A23 += other.A23;
+                A33 += other.A33;
+                return *this;
+            }
+
+            [[nodiscard]] double Evaluate(const glm::dvec3& p) const
+            {
+                const double error = A00 * p.x * p.x + 2.0 * A01 * p.x * p.y + 2.0 * A02 * p.x * p.z +
+                                     2.0 * A03 * p.x + A11 * p.y * p.y + 2.0 * A12 * p.y * p.z + 2.0 * A13 * p.y +
+                                     A22 * p.z * p.z + 2.0 * A23 * p.z + A33;
+                // Rounding can make the error of a point on all planes slightly negative
+                return std::max(error, 0.0);
+            }
+        };
+
+        struct Collapse
+        {
+            double Cost;
+            uint32_t From;
+            uint32_t To;
+            // Versions of the vertices, when the cost was computed. Outdated collapses are skipped
+            uint32_t FromVersion;
+            uint32_t ToVersion;
+
+            // Ties are broken by the vertices, so the result does not depend on the order of the edges
+            bool operator>(const Collapse& other) const
+            {
+                if (Cost != other.Cost)
+                {
+                    return Cost > other.Cost;
+                }
+                if (From != other.From)
+                {
+                    return From > other.From;
+                }
+                return To > other.To;
+            }
+        };
+
+        uint64_t EdgeKey(uint32_t a, uint32_t b)
+        {
+            return (static_cast<uint64_t>(std::min(a, b)) << 32) | std::max(a, b);
+        }
+
+        class Simplifier
+        {
+        public:
+            Simplifier(std::span<const uint32_t> indices, std::span<const glm::vec3> positions)
+                : m_Positions(positions),
+                  m_Triangles(indices.size() / 3),
+                  m_AliveTriangles(indices.size() / 3, true),
+                  m_Quadrics(positions.size()),
+                  m_VertexTriangles(positions.size()),
+                  m_Versions(positions.size(), 0),
+                  m_Removed(positions.size(), false),
+                  m_Locked(positions.size(), false)
+            {
+                for (size_t t = 0; t < m_Triangles.size(); ++t)
+                {
+                    auto& triangle = m_Triangles[t];
+                    for (size_t corner = 0; corner < 3; ++corner)
+                    {
+                        triangle[corner] = indices[t * 3 + corner];
+                        BeeExpects(triangle[corner] < positions.size());
+                    }
+                    if (triangle[0] == triangle[1] || triangle[1] == triangle[2] || triangle[0] == triangle[2])
+                    {
+                        m_AliveTriangles[t] = false;
+                        continue;
+                    }
+                    ++m_AliveTriangleCount;
+                    for (uint32_t vertex : triangle)
+                    {
+                        m_VertexTriangles[vertex].push_back(static_cast<uint32_t>(t));
+                        m_Bounds.Expand(positions[vertex]);
+                    }
+                }
+                LockSharedPositions();
+            }
+
+            [[nodiscard]] float GetSize() const
+            {
+                return m_Bounds.IsEmpty() ? 0.0f : glm::length(m_Bounds.Max - m_Bounds.Min);
+            }
+
+            SimplifiedMesh Run(size_t targetIndexCount, float maxError)
+            {
+                SimplifiedMesh result;
+                const double size = GetSize();
+                if (m_AliveTriangleCount * 3 > targetIndexCount && size > 0.0)
+                {
+                    const double maxCost = std::pow(static_cast<double>(maxError) * size, 2.0);
+                    const double cost = Simplify(targetIndexCount / 3, maxCost);
+                    result.Error = static_cast<float>(std::sqrt(cost) / size);
+                }
+                result.Indices.reserve(m_AliveTriangleCount * 3);
+                for (size_t t = 0; t < m_Triangles.size(); ++t)
+                {
+                    if (m_AliveTriangles[t])
+                    {
+                        result.Indices.insert(result.Indices.end(), m_Triangles[t].begin(), m_Triangles[t].end());
+                    }
+                }
+                return result;
+            }
+
+        private:
+            // Vertices at the same position are split because of different attributes or belong to different surfaces.
+            // Collapsing them separately would open cracks, so they are never removed and keep the seam connected
+            void LockSharedPositions()
+            {
+                std::vector<uint32_t> order(m_Positions.size());
+                std::iota(order.begin(), order.end(), 0u);
+                auto less = [this](uint32_t a, uint32_t b)
+                {
+                    const glm::vec3& pa = m_Positions[a];
+                    const glm::vec3& pb = m_Positions[b];
+                    return std::tie(pa.x, pa.y, pa.z) < std::tie(pb.x, pb.y, pb.z);
+                };
+                std::ranges::sort(order, less);
+                for (size_t i = 1; i < order.size(); ++i)
+                {
+                    if (m_Positions[order[i]] == m_Positions[order[i - 1]])
+                    {
+                        m_Locked[order[i]] = true;
+                        m_Locked[order[i - 1]] = true;
+                    }
+                }
+            }
+
+            [[nodiscard]] glm::dvec3 GetPosition(uint32_t vertex) const { return glm::dvec3(m_Positions[vertex]); }
+
+            [[nodiscard]] glm::dvec3 GetNormal(const std::array<uint32_t, 3>& triangle) const
+            {
+                const glm::dvec3 p0 = GetPosition(triangle[0]);
+                return glm::cross(GetPosition(triangle[1]) - p0, GetPosition(triangle[2]) - p0);
+            }
+
+            void ComputeQuadrics()
+            {
+                std::unordered_map<uint64_t, uint32_t> edgeUses;
+                for (size_t t = 0; t < m_Triangles.size(); ++t)
+                {
+                    if (!m_AliveTriangles[t])
+                    {
+                        continue;
+                    }
+                    const auto& triangle = m_Triangles[t];
+                    for (size_t corner = 0; corner < 3; ++corner)
+                    {
+                        edgeUses[EdgeKey(triangle[corner], triangle[(corner + 1) % 3])]++;
+                    }
+                    const glm::dvec3 normal = GetNormal(triangle);
+                    const double length = glm::length(normal);
+                    if (length == 0.0)
+                    {
+                        continue;
+                    }
+                    const glm::dvec3 unitNormal = normal / length;
+                    const Quadric plane =
+                        Quadric::FromPlane(unitNormal, -glm::dot(unitNormal, GetPosition(triangle[0])), 1.0);
+                    for (uint32_t vertex : triangle)
+                    {
+                        m_Quadrics[vertex] += plane;
+                    }
+                }
+                // Edges of one triangle are on an open border or on a seam. The plane through such an edge, that is
+                // perpendicular to the triangle, keeps its vertices from moving away from the border
+                for (size_t t = 0; t < m_Triangles.size(); ++t)
+                {
+                    if (!m_AliveTriangles[t])
+                    {
+                        continue;
+                    }
+                    const auto& triangle = m_Triangles[t];
+                    const glm::dvec3 normal = GetNormal(triangle);
+                    for (size_t corner = 0; corner < 3; ++corner)
+                    {
+                        const uint32_t a = triangle[corner];
+                        const uint32_t b = triangle[(corner + 1) % 3];
+                        if (edgeUses[EdgeKey(a, b)] != 1)
+                        {
+                            continue;
+                        }
+                        const glm::dvec3 borderNormal = glm::cross(GetPosition(b) - GetPosition(a), normal);
+                        const double length = glm::length(borderNormal);
+                        if (length == 0.0)
+                        {
+                            continue;
+                        }
+                        const glm::dvec3 unitNormal = borderNormal / length;
+                        const Quadric border = Quadric::FromPlane(
+                            unitNormal, -glm::dot(unitNormal, GetPosition(a)), BorderWeight);
+                        m_Quadrics[a] += border;
+                        m_Quadrics[b] += border;
+                    }
+                }
+                for (const auto& [key, uses] : edgeUses)
+                {
+                    Push(static_cast<uint32_t>(key >> 32), static_cast<uint32_t>(key & 0xFFFFFFFF));
+                }
+            }
+
+            void Push(uint32_t a, uint32_t b)
+            {
+                if (m_Locked[a] && m_Locked[b])
+                {
+                    return;
+                }
+                Quadric quadric = m_Quadrics[a];
+                quadric += m_Quadrics[b];
+                const double toA = quadric.Evaluate(GetPosition(a));
+                const double toB = quadric.Evaluate(GetPosition(b));
+                // Only unlocked vertices are removed
+                if (m_Locked[b] || (!m_Locked[a] && toB <= toA))
+                {
+                    m_Queue.push({toB, a, b, m_Versions[a], m_Versions[b]});
+                }
+                else
+                {
+                    m_Queue.push({toA, b, a, m_Versions[b], m_Versions[a]});
+                }
+            }
+
+            [[nodiscard]] bool IsOutdated(const Collapse& collapse) const
+            {
+                return m_Removed[collapse.From] || m_Removed[collapse.To] ||
+                       m_Versions[collapse.From] != collapse.FromVersion ||
+                       m_Versions[collapse.To] != collapse.ToVersion;
+            }
+
+            // Triangles around the removed vertex must keep their orientation and must not become degenerate
+            [[nodiscard]] bool CanCollapse(uint32_t from, uint32_t to) const
+            {
+                for (uint32_t t : m_VertexTriangles[from])
+                {
+                    if (!m_AliveTriangles[t])
+                    {
+                        continue;
+                    }
+                    auto triangle = m_Triangles[t];
+                    if (std::ranges::find(triangle, to) != triangle.end())
+                    {
+                        continue;
+                    }
+                    const glm::dvec3 before = GetNormal(triangle);
+                    std::ranges::replace(triangle, from, to);
+                    const glm::dvec3 after = GetNormal(triangle);
+                    const double beforeLength = glm::length(before);
+                    const double afterLength = glm::length(after);
+                    if (afterLength == 0.0)
+                    {
+                        return false;
+                    }
+                    if (beforeLength > 0.0 && glm::dot(before, after) < MinNormalAgreement * beforeLength * afterLength)
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            void Apply(uint32_t from, uint32_t to)
+            {
+                auto& toTriangles = m_VertexTriangles[to];
+                for (uint32_t t : m_VertexTriangles[from])
+                {
+                    if (!m_AliveTriangles[t])
+                    {
+                        continue;
+                    }
+                    auto& triangle = m_Triangles[t];
+                    if (std::ranges::find(triangle, to) != triangle.end())
+                    {
+                        m_AliveTriangles[t] = false;
+                        --m_AliveTriangleCount;
+                        continue;
+                    }
+                    std::ranges::replace(triangle, from, to);
+                    toTriangles.push_back(t);
+                }
+                m_VertexTriangles[from].clear();
+                m_Removed[from] = true;
+                m_Quadrics[to] += m_Quadrics[from];
+                ++m_Versions[to];
+                std::erase_if(toTriangles, [this](uint32_t t) { return !m_AliveTriangles[t]; });
+
+                m_Neighbours.clear();
+                for (uint32_t t : toTriangles)
+                {
+                    for (uint32_t vertex : m_Triangles[t])
+                    {
+                        if (vertex != to)
+                        {
+                            m_Neighbours.push_back(vertex);
+                        }
+                    }
+                }
+                std::ranges::sort(m_Neighbours);
+                const auto duplicates = std::ranges::unique(m_Neighbours);
+                m_Neighbours.erase(duplicates.begin(), duplicates.end());
+                for (uint32_t neighbour : m_Neighbours)
+                {
+                    Push(to, neighbour);
+                }
+            }
+
+            // Returns the largest cost of an applied collapse
+            double Simplify(size_t targetTriangleCount, double maxCost)
+            {
+                ComputeQuadrics();
+                double appliedCost = 0.0;
+                while (m_AliveTriangleCount > targetTriangleCount && !m_Queue.empty())
+                {
+                    const Collapse collapse = m_Queue.top();
+                    m_Queue.pop();
+                    if (IsOutdated(collapse))
+                    {
+                        continue;
+                    }
+                    // Collapses are ordered by cost, so all remaining ones are too expensive
+                    if (collapse.Cost > maxCost)
+                    {
+                        break;
+                    }
+                    if (!CanCollapse(collapse.From, collapse.To))
+                    {
+                        continue;
+                    }
+                    Apply(collapse.From, collapse.To);
+                    appliedCost = std::max(appliedCost, collapse.Cost);
+                }
+                return appliedCost;
+            }
+
+            std::span<const glm::vec3> m_Positions;
+            std::vector<std::array<uint32_t, 3>> m_Triangles;
+            std::vector<bool> m_AliveTriangles;
+            size_t m_AliveTriangleCount = 0;
+            std::vector<Quadric> m_Quadrics;
+            std::vector<std::vector<uint32_t>> m_VertexTriangles;
+            std::vector<uint32_t> m_Versions;
+            std::vector<bool> m_Removed;
+            std::vector<bool> m_Locked;
+            std::vector<uint32_t> m_Neighbours;
+            std::priority_queue<Collapse, std::vector<Collapse>, std::greater<>> m_Queue;
+            Math::AABB m_Bounds;
+        };
+    } // namespace
+
+    SimplifiedMesh SimplifyMesh(std::span<const uint32_t> indices,
+                                std::span<const glm::vec3> positions,
+                                size_t targetIndexCount,
+                                float maxError)
+    {
+        BEE_PROFILE_FUNCTION();
+        BeeExpects(indices.size() % 3 == 0);
+        BeeExpects(maxError >= 0.0f);
+        Simplifier simplifier(indices, positions);
+        return simplifier.Run(targetIndexCount, maxError);
+    }
+} // namespace BeeEngine
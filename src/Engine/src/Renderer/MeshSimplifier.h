@@ -0,0 +1,35 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <glm/glm.hpp>
+#include <span>
+#include <vector>
+
+namespace BeeEngine
+{
+    struct SimplifiedMesh
+    {
+        std::vector<uint32_t> Indices;
+        // Square root of the quadric error of the most expensive collapse relative to the diagonal of the mesh bounds
+        float Error = 0.0f;
+    };
+
+    /**
+     * @brief Reduces the number of triangles of an indexed triangle list with quadric error metrics
+     * (Garland and Heckbert). The cheapest edge is collapsed into one of its vertices, until the target is reached,
+     * so the result references the same vertices and their attributes do not have to be interpolated.
+     * Open borders are kept in place by additional quadrics. Vertices, that share their position with another vertex,
+     * e.g. both sides of an attribute seam, are never removed, so the seam can not open.
+     * Collapses, that flip triangles, are rejected. Triangles keep their relative order
+     * @param targetIndexCount the simplification stops, when the result has this many indices or less
+     * @param maxError the simplification stops before a collapse with a larger error relative to the mesh size
+     */
+    SimplifiedMesh SimplifyMesh(std::span<const uint32_t> indices,
+                                std::span<const glm::vec3> positions,
+                                size_t targetIndexCount,
+                                float maxError);
+} // namespace BeeEngine
@@ -3,6 +3,7 @@
 //
 
 #include "Pipeline.h"
+#include "Platform/Null/NullPipeline.h"
 #include "Platform/Vulkan/VulkanComputePipeline.h"
 #include "Platform/Vulkan/VulkanPipeline.h"
 #include "Platform/WebGPU/WebGPUPipeline.h"
@@ -27,6 +28,8 @@ namespace BeeEngine
             case Vulkan:
                 return CreateRef<Internal::VulkanPipeline>(vertexShader, fragmentShader);
 #endif
+            case Null:
+                return CreateRef<Internal::NullPipeline>(PipelineType::Graphics);
             case NotAvailable:
             default:
                 BeeCoreError("Unknown renderer API");
@@ -43,6 +46,8 @@ namespace BeeEngine
             case Vulkan:
                 return CreateRef<Internal::VulkanComputePipeline>(computeShader);
 #endif
+            case Null:
+                return CreateRef<Internal::NullPipeline>(PipelineType::Compute);
             case NotAvailable:
             default:
                 BeeCoreError("Unknown renderer API");
@@ -13,6 +13,8 @@ namespace BeeEngine
     {
         std::optional<uint32_t> GraphicsFamily;
         std::optional<uint32_t> PresentFamily;
+        // Family without graphics support, that is used for uploads. Empty, if the device has none
+        std::optional<uint32_t> TransferFamily;
 
         bool IsComplete() const { return GraphicsFamily.has_value() && PresentFamily.has_value(); }
     };
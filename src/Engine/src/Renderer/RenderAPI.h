@@ -11,6 +11,8 @@ enum RenderAPI
     DirectX = 3,*/
     WebGPU = 1,
     Vulkan = 2,
+    // Records nothing and only counts the work, that is submitted to it. Used to run frames headless
+    Null = 3,
 };
 
 namespace BeeEngine
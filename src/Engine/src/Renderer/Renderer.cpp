@@ -4,7 +4,10 @@
 
 #include "Renderer.h"
 #include "Core/DeletionQueue.h"
+#include "JobSystem/SpinLock.h"
 #include "RenderingQueue.h"
+#include <deque>
+#include <mutex>
 
 namespace BeeEngine
 {
@@ -12,6 +15,18 @@ namespace BeeEngine
     Scope<RendererAPI> Renderer::s_RendererAPI = nullptr;
     Color4 Renderer::s_ClearColor = Color4::DarkGray;
     RendererStatistics Renderer::s_Statistics{};
+    uint64_t Renderer::s_FrameNumber = 0;
+
+    namespace
+    {
+        struct PendingDestruction
+        {
+            uint64_t Frame;
+            std::function<void()> Destroy;
+        };
+        std::deque<PendingDestruction> s_PendingDestructions;
+        Jobs::SpinLock s_PendingDestructionsLock;
+    } // namespace
 
     void FrameData::CopyFrameBufferImageToSwapchain(FrameBuffer& framebuffer, uint32_t attachmentIndex)
     {
@@ -25,11 +40,54 @@ namespace BeeEngine
         BeeExpects(frameData.IsInProgress());
         s_RendererAPI->EndFrame();
         frameData.End();
+        ++s_FrameNumber;
 
         s_Statistics = Internal::RenderingQueue::GetGlobalStatistics();
         Internal::RenderingQueue::ResetStatistics();
     }
 
+    void Renderer::DestroyAfterFramesInFlight(std::function<void()>&& destroy)
+    {
+        std::unique_lock lock(s_PendingDestructionsLock);
+        if (!s_RendererAPI)
+        {
+            // Renderer is shut down, nothing is in flight anymore
+            lock.unlock();
+            destroy();
+            return;
+        }
+        s_PendingDestructions.push_back({s_FrameNumber, std::move(destroy)});
+    }
+
+    void Renderer::DestroyCompletedResources()
+    {
+        // Swap chain has waited for the frame FramesInFlight frames ago, when the frame began
+        std::unique_lock lock(s_PendingDestructionsLock);
+        while (!s_PendingDestructions.empty() &&
+               s_PendingDestructions.front().Frame + FramesInFlight <= s_FrameNumber)
+        {
+            auto destroy = std::move(s_PendingDestructions.front().Destroy);
+            s_PendingDestructions.pop_front();
+            lock.unlock();
+            destroy();
+            lock.lock();
+        }
+    }
+
+    void Renderer::Shutdown()
+    {
+        BEE_PROFILE_FUNCTION();
+        s_RendererAPI.reset();
+        std::unique_lock lock(s_PendingDestructionsLock);
+        auto pending = std::move(s_PendingDestructions);
+        s_PendingDestructions.clear();
+        lock.unlock();
+        for (auto& destruction : pending)
+        {
+            destruction.Destroy();
+        }
+    }
+
     void Renderer::SetAPI(const RenderAPI& api)
     {
         BEE_PROFILE_FUNCTION();
@@ -16,6 +16,7 @@
 #include "RenderAPI.h"
 #include "RendererAPI.h"
 #include "RendererStatistics.h"
+#include <functional>
 
 namespace BeeEngine
 {
@@ -52,6 +53,13 @@ namespace BeeEngine
         friend FrameData;
 
     public:
+        /**
+         * @brief Maximum number of frames, that the GPU executes, while the CPU records the next one.
+         * Swap chains wait for the frame, that was submitted FramesInFlight frames ago, before a frame begins,
+         * so data of frame N can be overwritten in frame N + FramesInFlight
+         */
+        static constexpr uint32_t FramesInFlight = 3;
+
         static RenderAPI GetAPI() { return s_Api; }
         static void SetAPI(const RenderAPI& api);
 
@@ -60,11 +68,35 @@ namespace BeeEngine
                                   Model& model,
                                   InstancedBuffer& instancedBuffer,
                                   const std::vector<BindingSet*>& bindingSets,
-                                  uint32_t instanceCount)
+                                  uint32_t instanceCount,
+                                  size_t instanceDataOffset = 0)
         {
             BEE_PROFILE_FUNCTION();
-            s_RendererAPI->DrawInstanced(commandBuffer, model, instancedBuffer, bindingSets, instanceCount);
+            s_RendererAPI->DrawInstanced(
+                commandBuffer, model, instancedBuffer, bindingSets, instanceCount, instanceDataOffset);
         }
+        static void DrawIndexedIndirect(CommandBuffer& commandBuffer,
+                                        Model& model,
+                                        StorageBuffer& instances,
+                                        const std::vector<BindingSet*>& bindingSets,
+                                        StorageBuffer& commands,
+                                        size_t commandsOffset,
+                                        uint32_t drawCount)
+        {
+            BEE_PROFILE_FUNCTION();
+            s_RendererAPI->DrawIndexedIndirect(
+                commandBuffer, model, instances, bindingSets, commands, commandsOffset, drawCount);
+        }
+        static void
+        Dispatch(Pipeline& computePipeline, const std::vector<BindingSet*>& bindingSets, uint32_t groupCountX)
+        {
+            BEE_PROFILE_FUNCTION();
+            s_RendererAPI->Dispatch(computePipeline, bindingSets, groupCountX);
+        }
+        /**
+         * @brief Meshes can be culled by compute shaders and drawn with indirect draw calls
+         */
+        static bool SupportsIndirectDrawing() { return s_RendererAPI->SupportsIndirectDrawing(); }
         static void SubmitCommandBuffer(const CommandBuffer& commandBuffer)
         {
             s_RendererAPI->SubmitCommandBuffer(commandBuffer);
@@ -83,6 +115,7 @@ namespace BeeEngine
             auto result = s_RendererAPI->BeginFrame();
             if (result.HasValue())
             {
+                DestroyCompletedResources();
                 return FrameData{result.Value(), s_Statistics};
             }
             return Unexpected<RendererAPI::Error>{result.Error()};
@@ -118,18 +151,33 @@ namespace BeeEngine
         }*/
 
         static const RendererStatistics& GetStatistics() { return s_Statistics; }
+        /**
+         * @brief Number of frames, that were ended. GPU resources, that are written every frame,
+         * use it to select the copy, that the GPU does not read anymore
+         */
+        static uint64_t GetFrameNumber() { return s_FrameNumber; }
+        /**
+         * @brief Calls the function, when the GPU has finished the current frame and the frames before it.
+         * GPU resources, that may still be read by the frames in flight, are destroyed with it, because
+         * DeletionQueue::Frame() is flushed right after the frame is submitted
+         */
+        static void DestroyAfterFramesInFlight(std::function<void()>&& destroy);
 
         /*static CommandBuffer GetMainCommandBuffer()
         {
             return s_RendererAPI->GetCurrentCommandBuffer();
         }*/
 
-        static void Shutdown() { s_RendererAPI.reset(); }
+        static void Shutdown();
+
+    private:
+        static void DestroyCompletedResources();
 
     private:
         static RenderAPI s_Api;
         static Scope<RendererAPI> s_RendererAPI;
         static Color4 s_ClearColor;
         static RendererStatistics s_Statistics;
+        static uint64_t s_FrameNumber;
     };
 } // namespace BeeEngine
@@ -3,6 +3,7 @@
 //
 
 #include "RendererAPI.h"
+#include "Platform/Null/NullRendererAPI.h"
 #include "Platform/Vulkan/VulkanRendererAPI.h"
 #include "Platform/WebGPU/WebGPURendererAPI.h"
 #include "Renderer.h"
@@ -22,6 +23,8 @@ namespace BeeEngine
             case RenderAPI::Vulkan:
                 return CreateScope<Internal::VulkanRendererAPI>();
 #endif
+            case RenderAPI::Null:
+                return CreateScope<Internal::NullRendererAPI>();
             default:
                 BeeCoreFatalError("Renderer API not supported!");
                 return nullptr;
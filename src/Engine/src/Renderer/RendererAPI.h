@@ -15,6 +15,22 @@
 namespace BeeEngine
 {
     class FrameBuffer;
+    class Pipeline;
+    class StorageBuffer;
+
+    /**
+     * @brief Arguments of one indexed indirect draw, laid out as VkDrawIndexedIndirectCommand
+     */
+    struct IndirectDrawCommand
+    {
+        uint32_t IndexCount;
+        uint32_t InstanceCount;
+        uint32_t FirstIndex;
+        int32_t VertexOffset;
+        uint32_t FirstInstance;
+    };
+    static_assert(sizeof(IndirectDrawCommand) == 20);
+
     class RendererAPI
     {
     public:
@@ -39,7 +55,28 @@ namespace BeeEngine
                                    Model& model,
                                    InstancedBuffer& instancedBuffer,
                                    const std::vector<BindingSet*>& bindingSets,
-                                   uint32_t instanceCount) = 0;
+                                   uint32_t instanceCount,
+                                   size_t instanceDataOffset) = 0;
+        /**
+         * @brief Draws the indexed model drawCount times with the commands, that are read from the commands buffer
+         * starting at commandsOffset. Instance data is read from the instances buffer at FirstInstance of each command.
+         * Requires SupportsIndirectDrawing
+         */
+        virtual void DrawIndexedIndirect(CommandBuffer& commandBuffer,
+                                         Model& model,
+                                         StorageBuffer& instances,
+                                         const std::vector<BindingSet*>& bindingSets,
+                                         StorageBuffer& commands,
+                                         size_t commandsOffset,
+                                         uint32_t drawCount) = 0;
+        /**
+         * @brief Runs the compute pipeline with groupCountX work groups before the draw calls of the current frame.
+         * Its writes to storage buffers are visible to vertex input and to indirect draws. Requires
+         * SupportsIndirectDrawing
+         */
+        virtual void
+        Dispatch(Pipeline& computePipeline, const std::vector<BindingSet*>& bindingSets, uint32_t groupCountX) = 0;
+        [[nodiscard]] virtual bool SupportsIndirectDrawing() const = 0;
         virtual void SubmitCommandBuffer(const CommandBuffer& commandBuffer) = 0;
 
         virtual void CopyFrameBufferImageToSwapchain(FrameBuffer& framebuffer, uint32_t attachmentIndex) = 0;
@@ -4,16 +4,39 @@
 
 #pragma once
 #include "Core/TypeDefines.h"
+#include <array>
 namespace BeeEngine
 {
     struct RendererStatistics
     {
+        static constexpr size_t MaxLodLevels = 4;
+
         size_t TotalInstanceCount{0};
         size_t TransparentInstanceCount{0};
         size_t OpaqueInstanceCount{0};
+        // Renderables of the scene, that passed and failed the frustum test
+        size_t VisibleInstanceCount{0};
+        size_t CulledInstanceCount{0};
+        // Instances, that were drawn from persistent buffers of static renderers without extraction
+        size_t StaticInstanceCount{0};
+        // Instances, that were culled by a compute pass and drawn with indirect draw calls
+        size_t GPUDrivenInstanceCount{0};
+        size_t ComputeDispatchCount{0};
+        // Mesh instances and their triangles per selected level of detail. Level 0 is full detail.
+        // Instances, that are culled on the CPU, are counted after culling. GPU-driven instances and static batches
+        // are culled later, so they are counted before culling
+        std::array<size_t, MaxLodLevels> LodInstanceCounts{};
+        std::array<size_t, MaxLodLevels> LodTriangleCounts{};
         size_t DrawCallCount{0};
         size_t VertexCount{0};
         size_t IndexCount{0};
+        // Changes of pipeline and of bound binding sets between consecutive draw calls
+        size_t PipelineChangeCount{0};
+        size_t BindingSetChangeCount{0};
+        // Sum of screen areas of drawn instances divided by the screen area, 1.0 means every pixel is drawn once
+        double EstimatedOverdraw{0.0};
+        // Bytes of instance and uniform data, that were written to GPU visible memory this frame
+        size_t UploadedBytes{0};
         size_t AllocatedGPUMemory{0};
         size_t AllocatedCPUMemory{0};
         size_t AllocatedGPUBuffers{0};
@@ -4,12 +4,12 @@
 
 #include "RenderingQueue.h"
 
-#include <numeric>
+#include <algorithm>
+#include <limits>
 
 #include "Core/Application.h"
 #include "Core/DeletionQueue.h"
 #include "Core/Math/Math.h"
-#include "MSDFData.h"
 #include "Platform/WebGPU/WebGPUGraphicsDevice.h"
 #include "Renderer.h"
 #include "SceneRenderer.h"
@@ -19,111 +19,177 @@
 namespace BeeEngine::Internal
 {
     RendererStatistics RenderingQueue::s_Statistics = {};
-    static constexpr size_t MIN_SIZE = 1024 * 1024 * 10;
+    // Instance ring grows, when the data of the frames in flight does not fit
+    static constexpr size_t INITIAL_SIZE = 1024 * 1024 * 4;
 
-    RenderingQueue::RenderingQueue()
+    RenderingQueue::RenderingQueue() : m_InstanceRing(INITIAL_SIZE) {}
+
+    RenderingQueue::~RenderingQueue()
     {
-        m_InstanceBuffers.push_back(InstancedBuffer::Create(MIN_SIZE));
-        s_Statistics.AllocatedGPUMemory += MIN_SIZE;
-        s_Statistics.AllocatedGPUBuffers++;
+        s_Statistics.AllocatedCPUMemory -= m_AllocatedCPUMemory;
     }
 
-    RenderingQueue::~RenderingQueue()
+    RenderingQueue::RenderingQueue(size_t sizeInBytes) : m_InstanceRing(sizeInBytes) {}
+
+    void RenderingQueue::SubmitInstance(Model& model,
+                                        std::span<BindingSet* const> bindingSets,
+                                        gsl::span<byte> instanceData,
+                                        float depth)
     {
-        s_Statistics.AllocatedGPUMemory -=
-            std::accumulate(m_InstanceBuffers.begin(),
-                            m_InstanceBuffers.end(),
-                            0,
-                            [](size_t acc, const auto& buffer) { return acc + buffer->GetSize(); });
-        s_Statistics.AllocatedGPUBuffers -= m_InstanceBuffers.size();
-        s_Statistics.AllocatedCPUMemory -=
-            std::accumulate(m_SubmittedInstances.begin(),
-                            m_SubmittedInstances.end(),
-                            0,
-                            [](size_t acc, const auto& instance) { return acc + instance.second.Data.size(); });
+        auto storage = m_InstanceData.Allocate(instanceData.size());
+        memcpy(storage.data(), instanceData.data(), instanceData.size());
+        SubmitInstanceView(model, bindingSets, {storage.data(), storage.size()}, depth);
     }
 
-    RenderingQueue::RenderingQueue(size_t sizeInBytes)
+    void RenderingQueue::SubmitInstanceView(Model& model,
+                                            std::span<BindingSet* const> bindingSets,
+                                            gsl::span<const byte> instanceData,
+                                            float depth)
     {
-        m_InstanceBuffers.push_back(InstancedBuffer::Create(sizeInBytes));
-        s_Statistics.AllocatedGPUMemory += sizeInBytes;
-        s_Statistics.AllocatedGPUBuffers++;
+        const uint16_t drawStateIndex = GetDrawStateIndex(model, bindingSets);
+        const uint16_t materialIndex = GetMaterialIndex(model.GetMaterial());
+        BeeExpects(instanceData.size() <= std::numeric_limits<uint32_t>::max());
+        m_Packets.push_back({.SortKey = DrawSortKey::Make(materialIndex, drawStateIndex, DrawSortKey::FromDepth(depth)),
+                             .Data = instanceData.data(),
+                             .DataSize = static_cast<uint32_t>(instanceData.size()),
+                             .DrawState = drawStateIndex});
+        s_Statistics.TotalInstanceCount++;
     }
 
-    void RenderingQueue::SubmitInstance(RenderInstance&& instance, gsl::span<byte> instanceData)
+    uint16_t RenderingQueue::GetDrawStateIndex(Model& model, std::span<BindingSet* const> bindingSets)
     {
-        if (!m_SubmittedInstances.contains(instance))
+        // Consecutive submits usually share the state, so check the last one before hashing
+        if (!m_DrawStates.empty())
         {
-            m_SubmittedInstances[instance] = RenderData{};
-            auto newSize = instanceData.size() * 100;
-            m_SubmittedInstances[instance].Data.resize(newSize);
-            s_Statistics.AllocatedCPUMemory += newSize;
+            const auto& last = m_DrawStates[m_LastDrawStateIndex];
+            if (last.Model == &model && std::ranges::equal(last.GetBindingSets(), bindingSets))
+            {
+                return m_LastDrawStateIndex;
+            }
         }
-        auto& renderData = m_SubmittedInstances[instance];
-        if (renderData.Offset + instanceData.size() > renderData.Data.size())
+        DrawState state(model, bindingSets);
+        auto [it, inserted] = m_DrawStateIndices.try_emplace(state, static_cast<uint16_t>(m_DrawStates.size()));
+        if (inserted)
         {
-            auto deltaSize = instanceData.size() * 100;
-            renderData.Data.resize(renderData.Data.size() + deltaSize);
-            s_Statistics.AllocatedCPUMemory += deltaSize;
+            BeeExpects(m_DrawStates.size() <= std::numeric_limits<uint16_t>::max());
+            m_DrawStates.push_back(state);
         }
-        memcpy(renderData.Data.data() + renderData.Offset, instanceData.data(), instanceData.size());
-        // renderData.Data[renderData.Offset] = *instanceData.data();
-        renderData.Offset += instanceData.size();
-        renderData.InstanceCount++;
-        s_Statistics.TotalInstanceCount++;
+        m_LastDrawStateIndex = it->second;
+        return m_LastDrawStateIndex;
     }
 
-    void RenderingQueue::Flush(CommandBuffer& commandBuffer)
+    uint16_t RenderingQueue::GetMaterialIndex(Material& material)
     {
-        for (auto& [instance, data] : m_SubmittedInstances)
+        auto [it, inserted] = m_MaterialIndices.try_emplace(&material, static_cast<uint16_t>(m_MaterialIndices.size()));
+        // The index is the pipeline part of the sort key, that has 16 bits
+        BeeExpects(!inserted || m_MaterialIndices.size() - 1 <= std::numeric_limits<uint16_t>::max());
+        return it->second;
+    }
+
+    void RenderingQueue::Flush(CommandBuffer& commandBuffer, DrawOrder order)
+    {
+        BEE_PROFILE_FUNCTION();
+        if (order == DrawOrder::BackToFront)
+        {
+            for (auto& packet : m_Packets)
+            {
+                packet.SortKey = DrawSortKey::ToBackToFront(packet.SortKey);
+            }
+        }
+        SortDrawPackets(m_Packets, m_SortScratch);
+        const DrawState* previousState = nullptr;
+        for (size_t begin = 0; begin < m_Packets.size();)
         {
-            if (data.InstanceCount == 0)
-                continue;
-            // size_t startingIndex = m_CurrentInstanceBufferIndex;
-            while (data.Offset > m_InstanceBuffers[m_CurrentInstanceBufferIndex]->GetSize() ||
-                   m_InstanceBuffers[m_CurrentInstanceBufferIndex]->IsSubmitted())
+            const uint16_t drawState = m_Packets[begin].DrawState;
+            size_t end = begin;
+            size_t size = 0;
+            for (; end < m_Packets.size() && m_Packets[end].DrawState == drawState; ++end)
             {
-                m_CurrentInstanceBufferIndex++;
-                if (m_CurrentInstanceBufferIndex >= m_InstanceBuffers.size())
-                {
-                    auto newSize = std::max(data.Offset, MIN_SIZE);
-                    m_InstanceBuffers.push_back(InstancedBuffer::Create(newSize));
-                    s_Statistics.AllocatedGPUMemory += newSize;
-                    s_Statistics.AllocatedGPUBuffers++;
-                }
+                size += m_Packets[end].DataSize;
             }
-            m_InstanceBuffers[m_CurrentInstanceBufferIndex]->SetData(data.Data.data(), data.Offset);
-            Renderer::DrawInstanced(commandBuffer,
-                                    *instance.Model,
-                                    *m_InstanceBuffers[m_CurrentInstanceBufferIndex],
-                                    instance.BindingSets,
-                                    data.InstanceCount);
-            s_Statistics.DrawCallCount++;
-            s_Statistics.VertexCount += instance.Model->GetVertexCount() * data.InstanceCount;
-            s_Statistics.IndexCount += instance.Model->GetIndexCount() * data.InstanceCount;
-            m_InstanceBuffers[m_CurrentInstanceBufferIndex]->Submit();
-            data.Reset();
-            // m_CurrentInstanceBufferIndex++;
-            m_CurrentInstanceBufferIndex = 0;
+            const DrawState& state = m_DrawStates[drawState];
+            CountStateChanges(previousState, state);
+            Draw(commandBuffer, state, std::span(m_Packets).subspan(begin, end - begin), size);
+            previousState = &state;
+            begin = end;
         }
+        Reset();
         DeletionQueue::RendererFlush().Flush();
     }
 
+    void RenderingQueue::Draw(CommandBuffer& commandBuffer,
+                              const DrawState& state,
+                              std::span<const DrawPacket> packets,
+                              size_t size)
+    {
+        auto [instanceBuffer, offset] = m_InstanceRing.Allocate(size);
+        // Instance data is gathered straight into the buffer, packets with adjacent data are copied at once
+        auto target = instanceBuffer.BeginWrite(offset, size);
+        size_t written = 0;
+        for (size_t i = 0; i < packets.size();)
+        {
+            const byte* data = packets[i].Data;
+            size_t length = packets[i].DataSize;
+            for (++i; i < packets.size() && packets[i].Data == data + length; ++i)
+            {
+                length += packets[i].DataSize;
+            }
+            memcpy(target.data() + written, data, length);
+            written += length;
+        }
+        instanceBuffer.EndWrite(offset, size);
+        m_BindingSets.assign(state.GetBindingSets().begin(), state.GetBindingSets().end());
+        const auto instanceCount = static_cast<uint32_t>(packets.size());
+        Renderer::DrawInstanced(commandBuffer, *state.Model, instanceBuffer, m_BindingSets, instanceCount, offset);
+        s_Statistics.DrawCallCount++;
+        s_Statistics.VertexCount += state.Model->GetVertexCount() * instanceCount;
+        s_Statistics.IndexCount += state.Model->GetIndexCount() * instanceCount;
+    }
+
+    void RenderingQueue::CountStateChanges(const DrawState* previous, const DrawState& next)
+    {
+        if (!previous || &previous->Model->GetMaterial() != &next.Model->GetMaterial())
+        {
+            s_Statistics.PipelineChangeCount++;
+        }
+        const auto nextBindingSets = next.GetBindingSets();
+        for (size_t i = 0; i < nextBindingSets.size(); ++i)
+        {
+            if (!previous || i >= previous->BindingSetCount || previous->BindingSets[i] != nextBindingSets[i])
+            {
+                s_Statistics.BindingSetChangeCount++;
+            }
+        }
+    }
+
+    void RenderingQueue::Reset()
+    {
+        UpdateAllocatedCPUMemory();
+        m_Packets.clear();
+        m_InstanceData.Reset();
+        m_DrawStates.clear();
+        m_DrawStateIndices.clear();
+        m_MaterialIndices.clear();
+        m_LastDrawStateIndex = 0;
+    }
+
+    void RenderingQueue::UpdateAllocatedCPUMemory()
+    {
+        const size_t allocated = m_InstanceData.GetAllocatedSize() +
+                                 (m_Packets.capacity() + m_SortScratch.capacity()) * sizeof(DrawPacket);
+        s_Statistics.AllocatedCPUMemory += allocated;
+        s_Statistics.AllocatedCPUMemory -= m_AllocatedCPUMemory;
+        m_AllocatedCPUMemory = allocated;
+    }
+
     void RenderingQueue::FinishFrame(CommandBuffer& commandBuffer)
     {
         // size_t takenSize = 0;
         // while (true)
         //{
-        Flush(commandBuffer);
+        Flush(commandBuffer, DrawOrder::State);
         //}
-        DeletionQueue::Frame().PushFunction(
-            [this]()
-            {
-                for (auto& buffer : m_InstanceBuffers)
-                {
-                    buffer->ResetSubmition();
-                }
-            });
+        m_InstanceRing.FinishFrame();
     }
 
     void RenderingQueue::ResetStatistics()
@@ -131,9 +197,20 @@ namespace BeeEngine::Internal
         s_Statistics.TotalInstanceCount = 0;
         s_Statistics.TransparentInstanceCount = 0;
         s_Statistics.OpaqueInstanceCount = 0;
+        s_Statistics.VisibleInstanceCount = 0;
+        s_Statistics.CulledInstanceCount = 0;
+        s_Statistics.StaticInstanceCount = 0;
+        s_Statistics.GPUDrivenInstanceCount = 0;
+        s_Statistics.ComputeDispatchCount = 0;
+        s_Statistics.LodInstanceCounts.fill(0);
+        s_Statistics.LodTriangleCounts.fill(0);
         s_Statistics.DrawCallCount = 0;
         s_Statistics.VertexCount = 0;
         s_Statistics.IndexCount = 0;
+        s_Statistics.PipelineChangeCount = 0;
+        s_Statistics.BindingSetChangeCount = 0;
+        s_Statistics.EstimatedOverdraw = 0.0;
+        s_Statistics.UploadedBytes = 0;
     }
     void RenderingQueue::SubmitText(const String& text,
                                     Font& font,
@@ -142,120 +219,14 @@ namespace BeeEngine::Internal
                                     const TextRenderingConfiguration& config,
                                     int32_t entityId)
     {
-        BeeExpects(IsValidString(text));
         auto& textModel = Application::GetInstance().GetAssetManager().GetModel("Renderer_Font");
-
-        auto& fontGeometry = font.GetMSDFData().FontGeometry;
-        auto& metrics = fontGeometry.getMetrics();
-        auto& atlasTexture = font.GetAtlasTexture();
-        auto& atlasBindingSet = font.GetAtlasBindingSet();
-
-        double x = 0.0;
-        double fsScale = 1.0 / (metrics.ascenderY - metrics.descenderY);
-        double y = 0.0; //-fsScale * metrics.ascenderY;
-
-        const auto* const spaceGlyph = fontGeometry.getGlyph(' ');
-
-        UTF8StringView textView(text);
-        auto it = textView.begin();
-        auto end = textView.end();
-
-        while (it != text.end())
+        // Texts of scripts have no component to cache the layout in, but the layout still reuses its memory
+        m_TextLayout.Rebuild(text, font.GetMetrics(), config);
+        BindingSet* const bindingSets[] = {&cameraBindingSet, &font.GetAtlasBindingSet()};
+        for (const auto& glyph : m_TextLayout.GetGlyphs())
         {
-            char32_t character = *it++;
-
-            if (character == '\r')
-                continue;
-
-            if (character == '\n')
-            {
-                x = 0;
-                y -= fsScale * metrics.lineHeight + config.LineSpacing;
-                continue;
-            }
-            if (character == ' ')
-            {
-                if (it != end)
-                {
-                    double advance = spaceGlyph->getAdvance();
-                    char32_t nextCharacter = *it;
-                    fontGeometry.getAdvance(advance, character, nextCharacter);
-
-                    x += fsScale * advance + config.KerningOffset;
-                }
-
-                continue;
-            }
-            if (character == '\t')
-            {
-                if (it != end)
-                {
-                    for (int j = 0; j < 3; ++j)
-                    {
-                        double advance = spaceGlyph->getAdvance();
-                        char32_t nextCharacter = ' ';
-                        fontGeometry.getAdvance(advance, character, nextCharacter);
-
-                        x += fsScale * advance + config.KerningOffset;
-                    }
-                    double advance = spaceGlyph->getAdvance();
-                    char32_t nextCharacter = *it;
-                    fontGeometry.getAdvance(advance, character, nextCharacter);
-
-                    x += fsScale * advance + config.KerningOffset;
-                }
-                continue;
-            }
-            auto glyph = fontGeometry.getGlyph(character);
-            if (!glyph)
-            {
-                glyph = fontGeometry.getGlyph('?');
-                if (!glyph)
-                    continue;
-            }
-            double al, ab, ar, at;
-            glyph->getQuadAtlasBounds(al, ab, ar, at);
-
-            glm::vec2 texCoordMin{al, ab};
-            glm::vec2 texCoordMax{ar, at};
-
-            double pl, pb, pr, pt;
-            glyph->getQuadPlaneBounds(pl, pb, pr, pt);
-
-            glm::vec2 quadMin{pl, pb};
-            glm::vec2 quadMax{pr, pt};
-
-            quadMin *= fsScale, quadMax *= fsScale;
-            quadMin += glm::vec2(x, y), quadMax += glm::vec2(x, y);
-
-            float texelWidth = 1.0f / (float)atlasTexture.GetWidth();
-            float texelHeight = 1.0f / (float)atlasTexture.GetHeight();
-
-            texCoordMin *= glm::vec2(texelWidth, texelHeight);
-            texCoordMax *= glm::vec2(texelWidth, texelHeight);
-
-            TextInstancedData data{.TexCoord0 = texCoordMin,
-                                   .TexCoord1 = {texCoordMin.x, texCoordMax.y},
-                                   .TexCoord2 = texCoordMax,
-                                   .TexCoord3 = {texCoordMax.x, texCoordMin.y},
-                                   .PositionOffset0 = transform * glm::vec4(quadMin, 0.0f, 1.0f),
-                                   .PositionOffset1 = transform * glm::vec4{quadMin.x, quadMax.y, 0.0f, 1.0f},
-                                   .PositionOffset2 = transform * glm::vec4(quadMax, 0.0f, 1.0f),
-                                   .PositionOffset3 = transform * glm::vec4{quadMax.x, quadMin.y, 0.0f, 1.0f},
-                                   .ForegroundColor = config.ForegroundColor,
-                                   .BackgroundColor = config.BackgroundColor,
-                                   .EntityID = entityId + 1};
-            SubmitInstance({.Model = &textModel, .BindingSets = {&cameraBindingSet, &atlasBindingSet}},
-                           {(byte*)&data, sizeof(TextInstancedData)});
-
-            if (it != end)
-            {
-                double advance = glyph->getAdvance();
-                char32_t nextCharacter = *it;
-                fontGeometry.getAdvance(advance, character, nextCharacter);
-
-                x += fsScale * advance + config.KerningOffset;
-            }
+            auto data = TextInstancedData::FromGlyph(glyph, transform, config, entityId + 1);
+            SubmitInstance(textModel, bindingSets, {(byte*)&data, sizeof(TextInstancedData)});
         }
     }
 
@@ -283,8 +254,8 @@ namespace BeeEngine::Internal
             .PositionOffset3 = transform * glm::vec4(0.5f, -0.5f, 0.0f, 1.0f),
         };
 
-        SubmitInstance({.Model = &lineModel, .BindingSets = {&cameraBindingSet}},
-                       {(byte*)&data, sizeof(LineInstancedData)});
+        BindingSet* const bindingSets[] = {&cameraBindingSet};
+        SubmitInstance(lineModel, bindingSets, {(byte*)&data, sizeof(LineInstancedData)});
     }
 
 } // namespace BeeEngine::Internal
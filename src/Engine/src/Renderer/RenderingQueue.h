@@ -6,69 +6,52 @@
 
 #include "Core/Color4.h"
 #include "Core/TypeDefines.h"
+#include "DrawPacket.h"
 #include "Font.h"
+#include "InstanceRingBuffer.h"
 #include "Model.h"
 #include "RendererStatistics.h"
+#include "TextLayout.h"
 #include "TextRenderingConfiguration.h"
 #include <gsl/span>
+#include <span>
+#include <unordered_map>
+#include <vector>
 
-namespace BeeEngine::Internal
-{
-    struct RenderInstance
-    {
-        Model* Model;
-        std::vector<BindingSet*> BindingSets;
-
-        bool operator==(const RenderInstance& other) const
-        {
-            return Model == other.Model && BindingSets == other.BindingSets;
-        }
-        bool operator!=(const RenderInstance& other) const { return !(*this == other); }
-    };
-    struct RenderData
-    {
-        std::vector<byte> Data{};
-        size_t Offset{0};
-        size_t InstanceCount{0};
-
-        void Reset()
-        {
-            Offset = 0;
-            InstanceCount = 0;
-        }
-    };
-} // namespace BeeEngine::Internal
-    template <>
-    struct std::hash<BeeEngine::Internal::RenderInstance>
-    {
-        std::size_t operator()(const BeeEngine::Internal::RenderInstance& k) const
-        {
-            // Compute individual hash values for first,
-            // second and third and combine them using XOR
-            // and bit shifting:
-            auto hashResult = (std::hash<BeeEngine::Model*>()(k.Model));
-            for (auto& bindingSet : k.BindingSets)
-            {
-                hashResult ^= (std::hash<BeeEngine::BindingSet*>()(bindingSet) << 1);
-            }
-            return hashResult >> 1;
-        }
-    };
 namespace BeeEngine
 {
     class SceneRenderer;
+    class StaticBatches;
 }
 namespace BeeEngine::Internal
 {
     class RenderingQueue final
     {
         friend BeeEngine::SceneRenderer;
+        friend BeeEngine::StaticBatches;
+        friend BeeEngine::InstanceRingBuffer;
 
     public:
         RenderingQueue();
         RenderingQueue(size_t sizeInBytes);
         ~RenderingQueue();
-        void SubmitInstance(RenderInstance&& instance, gsl::span<byte> instanceData);
+        /**
+         * @brief Records a draw packet for the instance and copies its data into the per frame arena.
+         * Instances with the same model and binding sets are drawn with one instanced draw call on Flush
+         * @param depth view depth of the instance, that orders the instances on Flush
+         */
+        void SubmitInstance(Model& model,
+                            std::span<BindingSet* const> bindingSets,
+                            gsl::span<byte> instanceData,
+                            float depth = 0.0f);
+        /**
+         * @brief Same as SubmitInstance, but the instance data is not copied.
+         * It is read once on Flush, when it is written into the instance buffer, so it must stay alive until then
+         */
+        void SubmitInstanceView(Model& model,
+                                std::span<BindingSet* const> bindingSets,
+                                gsl::span<const byte> instanceData,
+                                float depth = 0.0f);
         void SubmitLine(const glm::vec3& start,
                         const glm::vec3& end,
                         const Color4& color,
@@ -80,17 +63,39 @@ namespace BeeEngine::Internal
                         const glm::mat4& transform,
                         const TextRenderingConfiguration& config,
                         int32_t entityId = -1);
-        void Flush(CommandBuffer& commandBuffer);
+        void Flush(CommandBuffer& commandBuffer, DrawOrder order = DrawOrder::State);
         void FinishFrame(CommandBuffer& commandBuffer);
 
         static const RendererStatistics& GetGlobalStatistics() { return s_Statistics; }
 
         static void ResetStatistics();
+        static void CountUploadedBytes(size_t bytes) { s_Statistics.UploadedBytes += bytes; }
 
     private:
-        std::unordered_map<RenderInstance, RenderData> m_SubmittedInstances;
-        std::vector<Scope<InstancedBuffer>> m_InstanceBuffers;
-        size_t m_CurrentInstanceBufferIndex{0};
+        uint16_t GetDrawStateIndex(Model& model, std::span<BindingSet* const> bindingSets);
+        uint16_t GetMaterialIndex(Material& material);
+        void Draw(CommandBuffer& commandBuffer,
+                  const DrawState& state,
+                  std::span<const DrawPacket> packets,
+                  size_t size);
+        void CountStateChanges(const DrawState* previous, const DrawState& next);
+        void Reset();
+        void UpdateAllocatedCPUMemory();
+
+    private:
+        std::vector<DrawPacket> m_Packets;
+        std::vector<DrawPacket> m_SortScratch;
+        InstanceDataArena m_InstanceData;
+        TextLayout m_TextLayout;
+        std::vector<BindingSet*> m_BindingSets;
+
+        std::vector<DrawState> m_DrawStates;
+        std::unordered_map<DrawState, uint16_t> m_DrawStateIndices;
+        std::unordered_map<Material*, uint16_t> m_MaterialIndices;
+        uint16_t m_LastDrawStateIndex{0};
+        size_t m_AllocatedCPUMemory{0};
+
+        InstanceRingBuffer m_InstanceRing;
         static RendererStatistics s_Statistics;
     };
 } // namespace BeeEngine::Internal
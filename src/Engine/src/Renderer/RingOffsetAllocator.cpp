@@ -0,0 +1,75 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#include "RingOffsetAllocator.h"
+#include "Core/CodeSafety/Expects.h"
+
+namespace BeeEngine
+{
+    std::optional<size_t> RingOffsetAllocator::Allocate(size_t size, size_t alignment)
+    {
+        BeeExpects(alignment > 0 && (alignment & (alignment - 1)) == 0);
+        const size_t offset = (m_Head + alignment - 1) & ~(alignment - 1);
+        if (m_Head >= m_Tail)
+        {
+            if (offset + size <= m_Capacity)
+            {
+                m_Head = offset + size;
+                return offset;
+            }
+            // Wraps around. The rest of the buffer is skipped and freed with the frame, that was allocated before it
+            if (size < m_Tail)
+            {
+                m_Head = size;
+                return 0;
+            }
+            return std::nullopt;
+        }
+        if (offset + size < m_Tail)
+        {
+            m_Head = offset + size;
+            return offset;
+        }
+        return std::nullopt;
+    }
+
+    void RingOffsetAllocator::FinishFrame()
+    {
+        m_FrameEnds.push_back(m_Head);
+    }
+
+    void RingOffsetAllocator::ReleaseFrame()
+    {
+        BeeExpects(!m_FrameEnds.empty());
+        m_Tail = m_FrameEnds.front();
+        m_FrameEnds.pop_front();
+        if (m_Tail == m_Head)
+        {
+            // Empty, so the next allocations start at the beginning without wrapping
+            m_Head = 0;
+            m_Tail = 0;
+            for (auto& end : m_FrameEnds)
+            {
+                end = 0;
+            }
+        }
+    }
+
+    void RingOffsetAllocator::Reset(size_t capacity)
+    {
+        m_Capacity = capacity;
+        m_Head = 0;
+        m_Tail = 0;
+        m_FrameEnds.clear();
+    }
+
+    size_t RingOffsetAllocator::GetUsedSize() const
+    {
+        if (m_Head >= m_Tail)
+        {
+            return m_Head - m_Tail;
+        }
+        return m_Capacity - m_Tail + m_Head;
+    }
+} // namespace BeeEngine
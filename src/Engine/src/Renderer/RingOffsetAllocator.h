@@ -0,0 +1,52 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#pragma once
+#include <cstddef>
+#include <deque>
+#include <optional>
+
+namespace BeeEngine
+{
+    /**
+     * @brief Suballocates offsets in a buffer, that is used as a ring. Allocations of a frame are closed
+     * by FinishFrame and freed together by ReleaseFrame, oldest frame first, when the GPU does not read them anymore.
+     * Only offsets are managed, the memory itself belongs to the caller
+     */
+    class RingOffsetAllocator
+    {
+    public:
+        explicit RingOffsetAllocator(size_t capacity = 0) : m_Capacity(capacity) {}
+
+        /**
+         * @brief Allocates size bytes at an offset, that is a multiple of alignment (power of two)
+         * @return offset of the allocation or nullopt, if the free space is not large enough
+         */
+        std::optional<size_t> Allocate(size_t size, size_t alignment);
+        /**
+         * @brief Closes the allocations, that were made since the last call
+         */
+        void FinishFrame();
+        /**
+         * @brief Frees the allocations of the oldest finished frame
+         */
+        void ReleaseFrame();
+        /**
+         * @brief Frees everything, including finished frames, and changes the capacity
+         */
+        void Reset(size_t capacity);
+
+        [[nodiscard]] size_t GetCapacity() const { return m_Capacity; }
+        [[nodiscard]] size_t GetUsedSize() const;
+        [[nodiscard]] size_t GetFinishedFrameCount() const { return m_FrameEnds.size(); }
+
+    private:
+        size_t m_Capacity;
+        // Live allocations are in [m_Tail, m_Head), wrapped around the end of the buffer, if m_Head < m_Tail.
+        // Allocations never fill the ring completely, so m_Head == m_Tail means, that it is empty
+        size_t m_Head = 0;
+        size_t m_Tail = 0;
+        std::deque<size_t> m_FrameEnds;
+    };
+} // namespace BeeEngine
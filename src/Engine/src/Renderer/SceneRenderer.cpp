@@ -5,150 +5,29 @@
 #include "SceneRenderer.h"
 #include "BindingSet.h"
 #include "Core/Application.h"
+#include "Core/AssetManagement/MeshSource.h"
 #include "Core/Logging/Log.h"
 #include "Debug/Instrumentor.h"
+#include "FrustumCulling.h"
+#include "GPUDrivenMeshes.h"
 #include "IBindable.h"
 #include "Renderer.h"
 #include "RenderingQueue.h"
 #include "Scene/Components.h"
 #include "Scripting/ScriptingEngine.h"
+#include "StaticBatches.h"
 #include "UniformBuffer.h"
 #include "gtc/type_ptr.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cmath>
 #include <glm/glm.hpp>
+#include <span>
+#include <unordered_map>
 
 namespace BeeEngine
 {
-    std::vector<glm::vec4> GetFrustumPlanes(const glm::mat4& viewProj)
-    {
-        // x, y, z, and w represent A, B, C and D in the plane equation
-        // where ABC are the xyz of the planes normal, and D is the plane constant
-        std::vector<glm::vec4> tempFrustumPlane(6);
-
-        // Left Frustum Plane
-        // Add first column of the matrix to the fourth column
-        tempFrustumPlane[0].x = viewProj[0][3] + viewProj[0][0];
-        tempFrustumPlane[0].y = viewProj[1][3] + viewProj[1][0];
-        tempFrustumPlane[0].z = viewProj[2][3] + viewProj[2][0];
-        tempFrustumPlane[0].w = viewProj[3][3] + viewProj[3][0];
-
-        // Right Frustum Plane
-        // Subtract first column of matrix from the fourth column
-        tempFrustumPlane[1].x = viewProj[0][3] - viewProj[0][0];
-        tempFrustumPlane[1].y = viewProj[1][3] - viewProj[1][0];
-        tempFrustumPlane[1].z = viewProj[2][3] - viewProj[2][0];
-        tempFrustumPlane[1].w = viewProj[3][3] - viewProj[3][0];
-
-        // Top Frustum Plane
-        // Subtract second column of matrix from the fourth column
-        tempFrustumPlane[2].x = viewProj[0][3] - viewProj[0][1];
-        tempFrustumPlane[2].y = viewProj[1][3] - viewProj[1][1];
-        tempFrustumPlane[2].z = viewProj[2][3] - viewProj[2][1];
-        tempFrustumPlane[2].w = viewProj[3][3] - viewProj[3][1];
-
-        // Bottom Frustum Plane
-        // Add second column of the matrix to the fourth column
-        tempFrustumPlane[3].x = viewProj[0][3] + viewProj[0][1];
-        tempFrustumPlane[3].y = viewProj[1][3] + viewProj[1][1];
-        tempFrustumPlane[3].z = viewProj[2][3] + viewProj[2][1];
-        tempFrustumPlane[3].w = viewProj[3][3] + viewProj[3][1];
-
-        // Near Frustum Plane
-        // We could add the third column to the fourth column to get the near plane,
-        // but we don't have to do this because the third column IS the near plane
-        tempFrustumPlane[4].x = viewProj[0][2];
-        tempFrustumPlane[4].y = viewProj[1][2];
-        tempFrustumPlane[4].z = viewProj[2][2];
-        tempFrustumPlane[4].w = viewProj[3][2];
-
-        // Far Frustum Plane
-        // Subtract third column of matrix from the fourth column
-        tempFrustumPlane[5].x = viewProj[0][3] - viewProj[0][2];
-        tempFrustumPlane[5].y = viewProj[1][3] - viewProj[1][2];
-        tempFrustumPlane[5].z = viewProj[2][3] - viewProj[2][2];
-        tempFrustumPlane[5].w = viewProj[3][3] - viewProj[3][2];
-
-        // Normalize plane normals (A, B and C (xyz))
-        // Also take note that planes face inward
-        for (int i = 0; i < 6; ++i)
-        {
-            // float length = sqrt((tempFrustumPlane[i].x * tempFrustumPlane[i].x) + (tempFrustumPlane[i].y *
-            // tempFrustumPlane[i].y) + (tempFrustumPlane[i].z * tempFrustumPlane[i].z));
-            tempFrustumPlane[i] = glm::normalize(tempFrustumPlane[i]); ///= length;
-            /*tempFrustumPlane[i].y /= length;
-            tempFrustumPlane[i].z /= length;
-            tempFrustumPlane[i].w /= length;*/
-        }
-
-        return tempFrustumPlane;
-    }
-
-    struct AABB
-    {
-        glm::vec3 min = glm::vec3(FLT_MAX, FLT_MAX, FLT_MAX);
-        glm::vec3 max = glm::vec3(FLT_MIN, FLT_MIN, FLT_MIN);
-    };
-    bool IsInFrustum(const std::vector<glm::vec4>& frustumPlanes, const AABB& boundingBox)
-    {
-        // Loop through each frustum plane
-        for (int planeID = 0; planeID < 6; ++planeID)
-        {
-            auto planeNormal = glm::vec3(frustumPlanes[planeID]);
-            float planeConstant = frustumPlanes[planeID].w;
-            // Check each axis (x,y,z) to get the AABB vertex furthest away from the direction the plane is facing
-            // (plane normal)
-            glm::vec3 axisVert;
-            // x-axis
-            if (frustumPlanes[planeID].x <
-                0.0f) // Which AABB vertex is furthest down (plane normals direction) the x axis
-                axisVert.x = boundingBox.min.x; // min x plus tree positions x
-            else
-                axisVert.x = boundingBox.max.x; // max x plus tree positions x// y-axis
-            if (frustumPlanes[planeID].y <
-                0.0f) // Which AABB vertex is furthest down (plane normals direction) the y axis
-                axisVert.y = boundingBox.min.y; // min y plus tree positions y
-            else
-                axisVert.y = boundingBox.max.y; // max y plus tree positions y// z-axis
-            if (frustumPlanes[planeID].z <
-                0.0f) // Which AABB vertex is furthest down (plane normals direction) the z axis
-                axisVert.z = boundingBox.min.z; // min z plus tree positions z
-            else
-                axisVert.z = boundingBox.max.z; // max z plus tree positions z// Now we get the signed distance from the
-                                                // AABB vertex that's furthest down the frustum planes normal,// and if
-                                                // the signed distance is negative, then the entire bounding box is
-                                                // behind the frustum plane, which means// that it should be culled
-            if (glm::dot(planeNormal, axisVert) + planeConstant < 0.0f)
-            {
-                return false;
-            }
-        }
-        return true;
-    }
-
-    AABB CreateAABB(const std::vector<glm::vec3>& vertPosArray)
-    {
-        AABB boundingBox;
-        auto& minVertex = boundingBox.min;
-        auto& maxVertex = boundingBox.max;
-        for (size_t i = 0; i < vertPosArray.size(); i++)
-        {
-            // The minVertex and maxVertex will most likely not be actual vertices in the model, but vertices
-            // that use the smallest and largest x, y, and z values from the model to be sure ALL vertices are
-            // covered by the bounding volume
-
-            // Get the smallest vertex
-            minVertex.x = std::min(minVertex.x, vertPosArray[i].x); // Find smallest x value in model
-            minVertex.y = std::min(minVertex.y, vertPosArray[i].y); // Find smallest y value in model
-            minVertex.z = std::min(minVertex.z, vertPosArray[i].z); // Find smallest z value in model
-
-            // Get the largest vertex
-            maxVertex.x = std::max(maxVertex.x, vertPosArray[i].x); // Find largest x value in model
-            maxVertex.y = std::max(maxVertex.y, vertPosArray[i].y); // Find largest y value in model
-            maxVertex.z = std::max(maxVertex.z, vertPosArray[i].z); // Find largest z value in model
-        }
-
-        return boundingBox;
-    }
     Model* SceneRenderer::s_RectModel = nullptr;
     Model* SceneRenderer::s_CircleModel = nullptr;
     Texture2D* SceneRenderer::s_BlankTexture = nullptr;
@@ -173,6 +52,21 @@ namespace BeeEngine
         // Сфера пересекает все плоскости фрустума или полностью внутри фрустума
         return true;
     }
+    namespace
+    {
+        // Adds StaticRenderingComponent to the renderers, that don't have it yet
+        template <typename RendererComponent>
+        void TrackRenderers(entt::registry& registry)
+        {
+            auto untracked = registry.view<RendererComponent>(entt::exclude<StaticRenderingComponent>);
+            std::vector<entt::entity> entities(untracked.begin(), untracked.end());
+            for (auto entity : entities)
+            {
+                registry.emplace<StaticRenderingComponent>(entity);
+            }
+        }
+    } // namespace
+
     void
     SceneRenderer::RenderScene(Scene& scene,
                                CommandBuffer& commandBuffer,
@@ -184,6 +78,7 @@ namespace BeeEngine
         auto& locale = localization.GetLanguageString();
         auto& sceneRendererData = scene.GetSceneRendererData();
         sceneRendererData.CameraUniformBuffer->SetData(glm::value_ptr(viewProjectionMatrix), sizeof(glm::mat4));
+        scene.UpdateWorldTransforms();
 
         Scene::GPUSceneData sceneData{};
         sceneData.viewproj = viewProjectionMatrix;
@@ -195,82 +90,371 @@ namespace BeeEngine
 
         SceneTreeRenderer sceneTreeRenderer(viewProjectionMatrix, sceneRendererData.CameraBindingSet.get());
 
-        // auto frustumPlanes = GetFrustumPlanes(viewProjectionMatrix);
+        FrustumCuller culler(frustumPlanes);
+        auto& staticInstances = sceneRendererData.StaticInstances;
+        auto& gpuMeshes = sceneRendererData.GPUMeshes;
+        BoundsBatch bounds;
+        std::vector<uint8_t> visibility;
+        std::atomic<size_t> visibleCount = 0;
+        std::atomic<size_t> culledCount = 0;
+        // Bounds of a category are collected first and tested in one batch before AddEntity
+        auto cullBatch = [&](const BoundsBatch& batch, std::vector<uint8_t>& result)
+        {
+            const size_t visible = culler.Cull(batch, result);
+            visibleCount.fetch_add(visible, std::memory_order_relaxed);
+            culledCount.fetch_add(batch.Size() - visible, std::memory_order_relaxed);
+        };
         {
             BEE_PROFILE_SCOPE("SceneTreeRenderer::AddEntities");
-            auto spriteView = scene.m_Registry.view<SpriteRendererComponent>();
-            for (auto entity : spriteView)
+            // Opaque renderers, that have not changed for a while, are drawn from static batches and skip
+            // the extraction. They are tracked by StaticRenderingComponent, that is added here, because the registry
+            // must not be changed during the extraction
+            TrackRenderers<SpriteRendererComponent>(scene.m_Registry);
+            TrackRenderers<CircleRendererComponent>(scene.m_Registry);
+            TrackRenderers<MeshComponent>(scene.m_Registry);
+
+            // Sprites, circles and texts are extracted in parallel chunks. Asset manager loads assets
+            // lazily and is not thread safe, so assets are resolved on this thread before the extraction
+            auto spriteView =
+                scene.m_Registry.view<SpriteRendererComponent, WorldTransformComponent, StaticRenderingComponent>();
+            FrameVector<entt::entity> sprites(spriteView.begin(), spriteView.end());
+            BindingSet* blankTextureBindingSet = &s_BlankTexture->GetBindingSet();
+            std::unordered_map<AssetHandle, Texture2D*> textures;
+            for (auto entity : sprites)
             {
-                Entity e = {entity, scene.weak_from_this()};
-                glm::mat4 transform = Math::ToGlobalTransform(e);
                 auto& spriteComponent = spriteView.get<SpriteRendererComponent>(entity);
-                SpriteInstanceBufferData data{
-                    transform, spriteComponent.Color, spriteComponent.TilingFactor, static_cast<int32_t>(entity) + 1};
-                std::vector<BindingSet*> bindingSets{sceneRendererData.CameraBindingSet.get(),
-                                                     (spriteComponent.HasTexture
-                                                          ? &spriteComponent.Texture(locale)->GetBindingSet()
-                                                          : &s_BlankTexture->GetBindingSet())};
-                sceneTreeRenderer.AddEntity(data.Model,
-                                            data.Color.A() < 0.95f || spriteComponent.HasTexture,
-                                            *s_RectModel,
-                                            bindingSets,
-                                            {(byte*)&data, sizeof(SpriteInstanceBufferData)});
+                if (spriteComponent.HasTexture && !textures.contains(spriteComponent.TextureHandle))
+                {
+                    textures.emplace(spriteComponent.TextureHandle, spriteComponent.Texture(locale));
+                }
             }
-
-            auto circleGroup = scene.m_Registry.view<CircleRendererComponent>();
-            std::vector<BindingSet*> circleBindingSets{sceneRendererData.CameraBindingSet.get()};
-            for (auto entity : circleGroup)
+            const Math::AABB& rectBounds = s_RectModel->GetLocalBounds();
+            struct SpriteInstance
             {
-                Entity e = {entity, scene.weak_from_this()};
-                auto& transformComponent = e.GetComponent<TransformComponent>();
-                glm::mat4 transform = Math::ToGlobalTransform(e);
-                auto& circleComponent = circleGroup.get<CircleRendererComponent>(entity);
-                CircleInstanceBufferData data{transform,
-                                              circleComponent.Color,
-                                              circleComponent.Thickness,
-                                              circleComponent.Fade,
-                                              static_cast<int32_t>(entity) + 1};
-                sceneTreeRenderer.AddEntity(data.Model,
-                                            true,
-                                            *s_CircleModel,
-                                            circleBindingSets,
-                                            {(byte*)&data, sizeof(CircleInstanceBufferData)});
-            }
-
-            auto textGroup = scene.m_Registry.view<TextRendererComponent>();
-            for (auto entity : textGroup)
+                SpriteInstanceBufferData Data;
+                std::array<BindingSet*, 2> BindingSets;
+                bool Transparent = false;
+            };
+            auto makeSprite = [&](entt::entity entity)
+            {
+                auto [spriteComponent, worldTransform] =
+                    spriteView.get<SpriteRendererComponent, WorldTransformComponent>(entity);
+                Texture2D* texture = spriteComponent.HasTexture ? textures.at(spriteComponent.TextureHandle) : nullptr;
+                SpriteInstance sprite{.Data = {worldTransform.Transform,
+                                               spriteComponent.Color,
+                                               spriteComponent.TilingFactor,
+                                               static_cast<int32_t>(entity) + 1},
+                                      .BindingSets = {sceneRendererData.CameraBindingSet.get(),
+                                                      texture ? &texture->GetBindingSet() : blankTextureBindingSet}};
+                sprite.Transparent = IsTransparent(sprite.Data, texture);
+                return sprite;
+            };
+            sceneTreeRenderer.ExtractInParallel(
+                sprites.size(),
+                [&](SceneTreeRenderer& bucket, size_t begin, size_t end)
+                {
+                    BoundsBatch chunkBounds;
+                    FrameVector<SpriteInstance> dynamicSprites;
+                    FrameVector<Math::AABB> worldBounds;
+                    std::vector<uint8_t> chunkVisibility;
+                    chunkBounds.Reserve(end - begin);
+                    dynamicSprites.reserve(end - begin);
+                    worldBounds.reserve(end - begin);
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        auto entity = sprites[i];
+                        const Math::AABB bounds =
+                            rectBounds.Transformed(spriteView.get<WorldTransformComponent>(entity).Transform);
+                        auto& staticRendering = spriteView.get<StaticRenderingComponent>(entity).Sprite;
+                        const auto sprite = makeSprite(entity);
+                        if (sprite.Transparent)
+                        {
+                            staticInstances.Untrack(staticRendering);
+                        }
+                        else
+                        {
+                            const StaticBatches::Instance instance{
+                                .State = {*s_RectModel, sprite.BindingSets},
+                                .Data = {(const byte*)&sprite.Data, sizeof(SpriteInstanceBufferData)},
+                                .WorldBounds = bounds};
+                            if (staticInstances.Track(staticRendering, {&instance, 1}))
+                            {
+                                continue;
+                            }
+                        }
+                        dynamicSprites.push_back(sprite);
+                        worldBounds.push_back(bounds);
+                        chunkBounds.Add(bounds);
+                    }
+                    cullBatch(chunkBounds, chunkVisibility);
+                    for (size_t i = 0; i < dynamicSprites.size(); ++i)
+                    {
+                        if (!chunkVisibility[i])
+                        {
+                            continue;
+                        }
+                        const auto& sprite = dynamicSprites[i];
+                        bucket.AddEntity(sprite.Data.Model,
+                                         worldBounds[i],
+                                         sprite.Transparent,
+                                         *s_RectModel,
+                                         sprite.BindingSets,
+                                         {(const byte*)&sprite.Data, sizeof(SpriteInstanceBufferData)});
+                    }
+                });
+
+            auto circleGroup =
+                scene.m_Registry.view<CircleRendererComponent, WorldTransformComponent, StaticRenderingComponent>();
+            FrameVector<entt::entity> circles(circleGroup.begin(), circleGroup.end());
+            BindingSet* const circleBindingSets[] = {sceneRendererData.CameraBindingSet.get()};
+            const Internal::DrawState circleState(*s_CircleModel, circleBindingSets);
+            const Math::AABB& circleBounds = s_CircleModel->GetLocalBounds();
+            auto makeCircle = [&](entt::entity entity)
+            {
+                auto [circleComponent, worldTransform] =
+                    circleGroup.get<CircleRendererComponent, WorldTransformComponent>(entity);
+                return CircleInstanceBufferData{worldTransform.Transform,
+                                                circleComponent.Color,
+                                                circleComponent.Thickness,
+                                                circleComponent.Fade,
+                                                static_cast<int32_t>(entity) + 1};
+            };
+            sceneTreeRenderer.ExtractInParallel(
+                circles.size(),
+                [&](SceneTreeRenderer& bucket, size_t begin, size_t end)
+                {
+                    BoundsBatch chunkBounds;
+                    FrameVector<CircleInstanceBufferData> dynamicCircles;
+                    FrameVector<Math::AABB> worldBounds;
+                    std::vector<uint8_t> chunkVisibility;
+                    chunkBounds.Reserve(end - begin);
+                    dynamicCircles.reserve(end - begin);
+                    worldBounds.reserve(end - begin);
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        auto entity = circles[i];
+                        const Math::AABB bounds =
+                            circleBounds.Transformed(circleGroup.get<WorldTransformComponent>(entity).Transform);
+                        auto& staticRendering = circleGroup.get<StaticRenderingComponent>(entity).Circle;
+                        const auto data = makeCircle(entity);
+                        if (IsTransparent(data))
+                        {
+                            staticInstances.Untrack(staticRendering);
+                        }
+                        else
+                        {
+                            const StaticBatches::Instance instance{
+                                .State = circleState,
+                                .Data = {(const byte*)&data, sizeof(CircleInstanceBufferData)},
+                                .WorldBounds = bounds};
+                            if (staticInstances.Track(staticRendering, {&instance, 1}))
+                            {
+                                continue;
+                            }
+                        }
+                        dynamicCircles.push_back(data);
+                        worldBounds.push_back(bounds);
+                        chunkBounds.Add(bounds);
+                    }
+                    cullBatch(chunkBounds, chunkVisibility);
+                    for (size_t i = 0; i < dynamicCircles.size(); ++i)
+                    {
+                        if (!chunkVisibility[i])
+                        {
+                            continue;
+                        }
+                        const auto& data = dynamicCircles[i];
+                        bucket.AddEntity(data.Model,
+                                         worldBounds[i],
+                                         IsTransparent(data),
+                                         *s_CircleModel,
+                                         circleBindingSets,
+                                         {(const byte*)&data, sizeof(CircleInstanceBufferData)});
+                    }
+                });
+
+            // Bounds of a text are known only after the layout, so it is tested on its own.
+            // Layouts are cached in TextLayoutComponent, that is added here, because the registry
+            // must not be changed during the extraction
+            auto textGroup = scene.m_Registry.view<TextRendererComponent, WorldTransformComponent>();
+            FrameVector<entt::entity> texts(textGroup.begin(), textGroup.end());
+            std::unordered_map<AssetHandle, Font*> fonts;
+            for (auto entity : texts)
             {
                 auto& textComponent = textGroup.get<TextRendererComponent>(entity);
-                sceneTreeRenderer.AddText(textComponent.Text,
-                                          &textComponent.Font(locale),
-                                          Math::ToGlobalTransform(Entity{entity, scene.weak_from_this()}),
-                                          textComponent.Configuration,
-                                          static_cast<int32_t>(entity) + 1);
+                if (!fonts.contains(textComponent.FontHandle))
+                {
+                    fonts.emplace(textComponent.FontHandle, &textComponent.Font(locale));
+                }
+                scene.m_Registry.get_or_emplace<TextLayoutComponent>(entity);
             }
-
-            auto meshGroup = scene.m_Registry.view<MeshComponent>();
-
+            auto textLayouts = scene.m_Registry.view<TextLayoutComponent>();
+            sceneTreeRenderer.ExtractInParallel(
+                texts.size(),
+                [&](SceneTreeRenderer& bucket, size_t begin, size_t end)
+                {
+                    size_t visible = 0;
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        auto entity = texts[i];
+                        auto [textComponent, worldTransform] =
+                            textGroup.get<TextRendererComponent, WorldTransformComponent>(entity);
+                        Font& font = *fonts.at(textComponent.FontHandle);
+                        auto& textLayout = textLayouts.get<TextLayoutComponent>(entity);
+                        if (textLayout.IsOutdated(textComponent, font))
+                        {
+                            textLayout.Rebuild(textComponent, font);
+                        }
+                        visible += bucket.AddText(textLayout.Layout,
+                                                  font,
+                                                  worldTransform.Transform,
+                                                  textComponent.Configuration,
+                                                  static_cast<int32_t>(entity) + 1,
+                                                  &culler);
+                    }
+                    visibleCount.fetch_add(visible, std::memory_order_relaxed);
+                    culledCount.fetch_add(end - begin - visible, std::memory_order_relaxed);
+                });
+
+            // Meshes are extracted on this thread, because MaterialInstance::LoadData uploads to the GPU.
+            // Every model of a mesh source is culled separately
+            std::vector<glm::mat4> transforms;
+            struct MeshCandidate
+            {
+                entt::entity Entity;
+                size_t FirstModel;
+                size_t NumberOfModels;
+            };
+            std::vector<MeshCandidate> meshCandidates;
+            std::vector<Model*> models;
+            struct MeshInstancedData
+            {
+                glm::mat4 Model;
+                int32_t EntityID;
+            };
+            std::vector<StaticBatches::Instance> meshInstances;
+            // Indexed models are culled by a compute pass and drawn with indirect draw calls, if the API can do it
+            const bool gpuDriven = Renderer::SupportsIndirectDrawing();
+            // Level of detail is selected from the projected size of the full detail bounds, that all levels share
+            auto selectLod = [&](MeshSource& source, size_t index, const Math::AABB& worldBounds)
+            {
+                return std::min(MeshSource::SelectLod(GetScreenSize(viewProjectionMatrix, worldBounds)),
+                                source.GetLodCount(index) - 1);
+            };
+            auto& lodStatistics = Internal::RenderingQueue::s_Statistics;
+            auto countLod = [&](const Model& model, uint32_t lod)
+            {
+                lodStatistics.LodInstanceCounts[lod]++;
+                lodStatistics.LodTriangleCounts[lod] +=
+                    (model.IsIndexed() ? model.GetIndexCount() : model.GetVertexCount()) / 3;
+            };
+            std::vector<uint32_t> modelLods;
+            std::vector<uint32_t> meshLods;
+            auto meshGroup = scene.m_Registry.view<MeshComponent, WorldTransformComponent, StaticRenderingComponent>();
             for (auto entity : meshGroup)
             {
                 auto& meshComponent = meshGroup.get<MeshComponent>(entity);
+                auto& staticRendering = meshGroup.get<StaticRenderingComponent>(entity).Mesh;
                 if (!meshComponent.HasMeshes)
+                {
+                    staticInstances.Untrack(staticRendering);
                     continue;
-                Entity e = {entity, scene.weak_from_this()};
-                glm::mat4 transform = Math::ToGlobalTransform(e);
-
-                struct MeshInstancedData
+                }
+                glm::mat4 transform = meshGroup.get<WorldTransformComponent>(entity).Transform;
+                auto& source = *meshComponent.MeshSource();
+                auto& sourceModels = source.GetModels();
+                const MeshInstancedData meshInstancedData{transform, static_cast<int32_t>(entity) + 1};
+                BindingSet* const bindingSets[] = {sceneRendererData.MeshSceneDataBindingSet.get(),
+                                                   meshComponent.MaterialInstance.bindingSet.get()};
+                if (gpuDriven)
+                {
+                    staticInstances.Untrack(staticRendering);
+                    meshComponent.MaterialInstance.LoadData();
+                    for (size_t j = 0; j < sourceModels.size(); ++j)
+                    {
+                        const Math::AABB worldBounds = sourceModels[j].GetLocalBounds().Transformed(transform);
+                        const uint32_t lod = selectLod(source, j, worldBounds);
+                        Model& model = source.GetModel(j, lod);
+                        if (model.IsIndexed())
+                        {
+                            // Culled later by the compute pass, so it is counted before culling
+                            countLod(model, lod);
+                            gpuMeshes.Add(model, bindingSets, transform, meshInstancedData.EntityID, worldBounds);
+                        }
+                        else if (culler.IsVisible(worldBounds))
+                        {
+                            countLod(model, lod);
+                            sceneTreeRenderer.AddEntity(transform,
+                                                        worldBounds,
+                                                        false,
+                                                        model,
+                                                        bindingSets,
+                                                        {(const byte*)&meshInstancedData, sizeof(MeshInstancedData)});
+                        }
+                    }
+                    continue;
+                }
+                meshInstances.clear();
+                meshLods.clear();
+                for (size_t j = 0; j < sourceModels.size(); ++j)
+                {
+                    const Math::AABB worldBounds = sourceModels[j].GetLocalBounds().Transformed(transform);
+                    meshLods.push_back(selectLod(source, j, worldBounds));
+                    meshInstances.push_back({.State = {source.GetModel(j, meshLods.back()), bindingSets},
+                                             .Data = {(const byte*)&meshInstancedData, sizeof(MeshInstancedData)},
+                                             .WorldBounds = worldBounds});
+                }
+                if (staticInstances.Track(staticRendering, meshInstances))
+                {
+                    // Static batches are culled as a whole, when they are drawn, so they are counted before culling
+                    for (size_t j = 0; j < meshInstances.size(); ++j)
+                    {
+                        countLod(*meshInstances[j].State.Model, meshLods[j]);
+                    }
+                    // Material data is not a part of the instance data, so its changes are still uploaded
+                    meshComponent.MaterialInstance.LoadData();
+                    continue;
+                }
+                meshCandidates.push_back({entity, models.size(), sourceModels.size()});
+                transforms.push_back(transform);
+                for (size_t j = 0; j < sourceModels.size(); ++j)
+                {
+                    bounds.Add(meshInstances[j].WorldBounds);
+                    models.push_back(meshInstances[j].State.Model);
+                    modelLods.push_back(meshLods[j]);
+                }
+            }
+            cullBatch(bounds, visibility);
+            for (size_t i = 0; i < meshCandidates.size(); ++i)
+            {
+                auto& candidate = meshCandidates[i];
+                std::span<const uint8_t> modelVisibility{visibility.data() + candidate.FirstModel,
+                                                         candidate.NumberOfModels};
+                if (std::ranges::none_of(modelVisibility, [](uint8_t visible) { return visible != 0; }))
                 {
-                    glm::mat4 Model;
-                    int32_t EntityID;
-                } meshInstancedData{transform, static_cast<int32_t>(entity) + 1};
+                    continue;
+                }
+                auto& meshComponent = meshGroup.get<MeshComponent>(candidate.Entity);
+                const glm::mat4& transform = transforms[i];
+                MeshInstancedData meshInstancedData{transform, static_cast<int32_t>(candidate.Entity) + 1};
 
                 meshComponent.MaterialInstance.LoadData();
-                std::vector bindingSets{sceneRendererData.MeshSceneDataBindingSet.get(),
-                                        meshComponent.MaterialInstance.bindingSet.get()};
-                for (auto& model : meshComponent.MeshSource()->GetModels())
+                BindingSet* const bindingSets[] = {sceneRendererData.MeshSceneDataBindingSet.get(),
+                                                   meshComponent.MaterialInstance.bindingSet.get()};
+                for (size_t j = 0; j < modelVisibility.size(); ++j)
                 {
-                    sceneTreeRenderer.AddEntity(
-                        transform, false, model, bindingSets, {(byte*)&meshInstancedData, sizeof(MeshInstancedData)});
+                    if (!modelVisibility[j])
+                    {
+                        continue;
+                    }
+                    Model& model = *models[candidate.FirstModel + j];
+                    countLod(model, modelLods[candidate.FirstModel + j]);
+                    sceneTreeRenderer.AddEntity(transform,
+                                                model.GetLocalBounds().Transformed(transform),
+                                                false,
+                                                model,
+                                                bindingSets,
+                                                {(byte*)&meshInstancedData, sizeof(MeshInstancedData)});
                 }
             }
 
@@ -285,24 +469,40 @@ namespace BeeEngine
                 }
             }
         }
+        staticInstances.Commit();
+        gpuMeshes.Cull(frustumPlanes);
         BeeCoreTrace("SceneTreeRenderer::AddEntities done");
-        // auto& statistics = Internal::RenderingQueue::GetInstance().m_Statistics;
-        // statistics.OpaqueInstanceCount += sceneTreeRenderer.m_NotTransparent.size();
-        // statistics.TransparentInstanceCount += sceneTreeRenderer.m_Transparent.size();
+        auto& statistics = Internal::RenderingQueue::s_Statistics;
+        statistics.VisibleInstanceCount += visibleCount.load();
+        statistics.CulledInstanceCount += culledCount.load();
+        statistics.OpaqueInstanceCount += sceneTreeRenderer.m_Opaque.size();
+        statistics.TransparentInstanceCount += sceneTreeRenderer.m_Transparent.size();
         // auto& tlas = scene.GetTLAS();
         // tlas.UpdateInstances(std::move(sceneTreeRenderer.GetAllEntities()));
 
-        // TODO: this is temporary
-        for (auto& entity : sceneTreeRenderer.m_Opaque)
+        // Opaque instances are grouped by state and drawn front to back inside of a group, so the depth test
+        // rejects hidden fragments early. Transparent ones are drawn back to front for correct blending.
+        // Ties keep the extraction order, so the order is the same every frame
+        double overdraw = 0.0;
+        auto submit = [&](SceneTreeRenderer::EntityList& entities, DrawOrder order)
         {
-            commandBuffer.SubmitInstance(*entity.Model, entity.BindingSets, entity.InstancedData);
-        }
-        commandBuffer.Flush();
-        for (auto& entity : sceneTreeRenderer.m_Transparent)
-        {
-            commandBuffer.SubmitInstance(*entity.Model, entity.BindingSets, entity.InstancedData);
-        }
-        commandBuffer.Flush();
+            for (auto& entity : entities)
+            {
+                overdraw += GetScreenCoverage(viewProjectionMatrix, entity.WorldBounds);
+                // Instance data stays in the frame arena until the end of the next frame
+                commandBuffer.SubmitInstanceView(*entity.State.Model,
+                                                 entity.State.GetBindingSets(),
+                                                 entity.InstancedData,
+                                                 GetViewDepth(viewProjectionMatrix, entity.WorldBounds));
+            }
+            commandBuffer.Flush(order);
+        };
+        // Static batches and GPU-driven meshes are opaque, so they are drawn before the rest
+        staticInstances.Draw(commandBuffer, culler);
+        gpuMeshes.Draw(commandBuffer);
+        submit(sceneTreeRenderer.m_Opaque, DrawOrder::State);
+        submit(sceneTreeRenderer.m_Transparent, DrawOrder::BackToFront);
+        statistics.EstimatedOverdraw += overdraw;
         BeeCoreTrace("Finished Rendering scene");
     }
 
@@ -361,14 +561,15 @@ namespace BeeEngine
 
     void SceneRenderer::RenderPhysicsColliders(Scene& scene, CommandBuffer& commandBuffer, BindingSet& cameraBindingSet)
     {
+        scene.UpdateWorldTransforms();
         auto& registry = scene.m_Registry;
-        auto view = registry.view<BoxCollider2DComponent>();
+        auto view = registry.view<BoxCollider2DComponent, WorldTransformComponent>();
         {
             for (auto entity : view)
             {
                 auto bc2d = view.get<BoxCollider2DComponent>(entity);
                 auto [translation, rotation, scale] =
-                    Math::DecomposeTransform(Math::ToGlobalTransform(Entity{entity, scene.weak_from_this()}));
+                    Math::DecomposeTransform(view.get<WorldTransformComponent>(entity).Transform);
                 if (bc2d.Type == BoxCollider2DComponent::ColliderType::Box)
                 {
                     translation = translation + glm::vec3(bc2d.Offset, 0.001f);
@@ -388,7 +589,7 @@ namespace BeeEngine
 
                     glm::mat4 transform =
                         glm::translate(glm::mat4(1.0f), translation) * glm::scale(glm::mat4(1.0f), scale);
-                    std::vector<BindingSet*> bindingSets{&cameraBindingSet};
+                    BindingSet* const bindingSets[] = {&cameraBindingSet};
                     CircleInstanceBufferData data{
                         transform, Color4::DarkGreen, 0.05f, 0.005f, static_cast<int32_t>(entity) + 1};
                     commandBuffer.SubmitInstance(
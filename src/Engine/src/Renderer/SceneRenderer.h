@@ -5,11 +5,11 @@
 #pragma once
 #include "Core/Math/Math.h"
 #include "FrameBuffer.h"
+#include "FrustumCulling.h"
 #include "Scene/Scene.h"
 #include "glm/glm.hpp"
 namespace BeeEngine
 {
-    std::vector<glm::vec4> GetFrustumPlanes(const glm::mat4& viewProj);
     template <typename T>
     concept CameraClass = requires(T a) {
         { a.GetAspectRatio() } -> std::convertible_to<float>;
@@ -32,20 +32,22 @@ namespace BeeEngine
         float Fade = 0.005f;
         int32_t EntityID = -1;
     };
-    struct TextInstancedData
+    // Static batches compare instance data byte by byte, so it must not have padding
+    static_assert(sizeof(SpriteInstanceBufferData) == sizeof(glm::mat4) + sizeof(Color4) + 2 * sizeof(float));
+    static_assert(sizeof(CircleInstanceBufferData) == sizeof(glm::mat4) + sizeof(Color4) + 3 * sizeof(float));
+    /**
+     * @brief Sprites, that are blended with the scene behind them, are drawn in the transparent pass
+     * and never from static batches
+     */
+    inline bool IsTransparent(const SpriteInstanceBufferData& data, const Texture2D* texture)
     {
-        glm::vec2 TexCoord0;
-        glm::vec2 TexCoord1;
-        glm::vec2 TexCoord2;
-        glm::vec2 TexCoord3;
-        glm::vec3 PositionOffset0;
-        glm::vec3 PositionOffset1;
-        glm::vec3 PositionOffset2;
-        glm::vec3 PositionOffset3;
-        Color4 ForegroundColor;
-        Color4 BackgroundColor;
-        int32_t EntityID;
-    };
+        return data.Color.A() < 1.0f || (texture && texture->HasTranslucency());
+    }
+    // Faded edges of a circle are blended
+    inline bool IsTransparent(const CircleInstanceBufferData& data)
+    {
+        return data.Color.A() < 1.0f || data.Fade > 0.0f;
+    }
     class SceneRenderer
     {
     private:
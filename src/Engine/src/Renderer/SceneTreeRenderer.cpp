@@ -4,8 +4,8 @@
 
 #include "SceneTreeRenderer.h"
 #include "Core/Application.h"
+#include "Debug/Instrumentor.h"
 #include "FrameBuffer.h"
-#include "MSDFData.h"
 #include "Renderer.h"
 #include "RenderingQueue.h"
 #include <ranges>
@@ -18,154 +18,80 @@ namespace BeeEngine
     }
 
     void SceneTreeRenderer::AddEntity(glm::mat4 transform,
+                                      const Math::AABB& worldBounds,
                                       bool isTransparent,
                                       Model& model,
-                                      const std::vector<BindingSet*>& bindingSets,
-                                      gsl::span<byte> instancedData)
+                                      std::span<BindingSet* const> bindingSets,
+                                      gsl::span<const byte> instancedData)
     {
         auto& vec = isTransparent ? m_Transparent : m_Opaque;
-        std::vector<byte> instancedDataVector(instancedData.size());
-        memcpy(instancedDataVector.data(), instancedData.data(), instancedData.size());
-        vec.emplace_back(Entity{transform, &model, bindingSets, std::move(instancedDataVector)});
+        auto storage = FrameAllocator().AllocateAligned(instancedData.size(), Internal::InstanceDataArena::Alignment);
+        memcpy(storage.Ptr, instancedData.data(), instancedData.size());
+        vec.emplace_back(
+            Entity{transform, worldBounds, {model, bindingSets}, {static_cast<const byte*>(storage.Ptr), storage.Size}});
     }
-    struct TextInstancedData
+    void SceneTreeRenderer::Append(std::span<SceneTreeRenderer> buckets)
     {
-        glm::vec2 TexCoord0;
-        glm::vec2 TexCoord1;
-        glm::vec2 TexCoord2;
-        glm::vec2 TexCoord3;
-        glm::vec3 PositionOffset0;
-        glm::vec3 PositionOffset1;
-        glm::vec3 PositionOffset2;
-        glm::vec3 PositionOffset3;
-        Color4 ForegroundColor;
-        Color4 BackgroundColor;
-        int32_t EntityID;
-    };
-    void SceneTreeRenderer::AddText(const UTF8String& text,
-                                    Font* font,
-                                    const glm::mat4& transform,
-                                    const TextRenderingConfiguration& config,
-                                    int32_t entityID)
-    {
-        BeeExpects(IsValidString(text));
-        auto& textModel = Application::GetInstance().GetAssetManager().GetModel("Renderer_Font");
-
-        auto& fontGeometry = font->GetMSDFData().FontGeometry;
-        auto& metrics = fontGeometry.getMetrics();
-        auto& atlasTexture = font->GetAtlasTexture();
-        auto& atlasBindingSet = font->GetAtlasBindingSet();
-
-        double x = 0.0;
-        double fsScale = 1.0 / (metrics.ascenderY - metrics.descenderY);
-        double y = 0.0; //-fsScale * metrics.ascenderY;
-
-        const auto spaceGlyph = fontGeometry.getGlyph(' ');
-
-        UTF8StringView textView(text);
-        auto it = textView.begin();
-        auto end = textView.end();
-
-        while (it != text.end())
+        BEE_PROFILE_FUNCTION();
+        auto append = [buckets](EntityList& target, EntityList SceneTreeRenderer::*source)
         {
-            char32_t character = *it++;
-
-            if (character == '\r')
-                continue;
-
-            if (character == '\n')
+            FrameVector<size_t> offsets;
+            offsets.reserve(buckets.size());
+            size_t total = target.size();
+            for (auto& bucket : buckets)
             {
-                x = 0;
-                y -= fsScale * metrics.lineHeight + config.LineSpacing;
-                continue;
+                offsets.push_back(total);
+                total += (bucket.*source).size();
             }
-            if (character == ' ')
-            {
-                if (it != end)
-                {
-                    double advance = spaceGlyph->getAdvance();
-                    char32_t nextCharacter = *it;
-                    fontGeometry.getAdvance(advance, character, nextCharacter);
-
-                    x += fsScale * advance + config.KerningOffset;
-                }
-
-                continue;
-            }
-            if (character == '\t')
-            {
-                if (it != end)
+            target.resize(total);
+            Jobs::ParallelFor(
+                0,
+                buckets.size(),
+                [&](size_t i)
                 {
-                    for (int j = 0; j < 3; ++j)
-                    {
-                        double advance = spaceGlyph->getAdvance();
-                        char32_t nextCharacter = ' ';
-                        fontGeometry.getAdvance(advance, character, nextCharacter);
-
-                        x += fsScale * advance + config.KerningOffset;
-                    }
-                    double advance = spaceGlyph->getAdvance();
-                    char32_t nextCharacter = *it;
-                    fontGeometry.getAdvance(advance, character, nextCharacter);
-
-                    x += fsScale * advance + config.KerningOffset;
-                }
-                continue;
-            }
-            auto glyph = fontGeometry.getGlyph(character);
-            if (!glyph)
-            {
-                glyph = fontGeometry.getGlyph('?');
-                if (!glyph)
-                    continue;
-            }
-            double al, ab, ar, at;
-            glyph->getQuadAtlasBounds(al, ab, ar, at);
-
-            glm::vec2 texCoordMin{al, ab};
-            glm::vec2 texCoordMax{ar, at};
-
-            double pl, pb, pr, pt;
-            glyph->getQuadPlaneBounds(pl, pb, pr, pt);
-
-            glm::vec2 quadMin{pl, pb};
-            glm::vec2 quadMax{pr, pt};
-
-            quadMin *= fsScale, quadMax *= fsScale;
-            quadMin += glm::vec2(x, y), quadMax += glm::vec2(x, y);
-
-            float texelWidth = 1.0f / (float)atlasTexture.GetWidth();
-            float texelHeight = 1.0f / (float)atlasTexture.GetHeight();
-
-            texCoordMin *= glm::vec2(texelWidth, texelHeight);
-            texCoordMax *= glm::vec2(texelWidth, texelHeight);
-
-            TextInstancedData data{.TexCoord0 = texCoordMin,
-                                   .TexCoord1 = {texCoordMin.x, texCoordMax.y},
-                                   .TexCoord2 = texCoordMax,
-                                   .TexCoord3 = {texCoordMax.x, texCoordMin.y},
-                                   .PositionOffset0 = transform * glm::vec4(quadMin, 0.0f, 1.0f),
-                                   .PositionOffset1 = transform * glm::vec4{quadMin.x, quadMax.y, 0.0f, 1.0f},
-                                   .PositionOffset2 = transform * glm::vec4(quadMax, 0.0f, 1.0f),
-                                   .PositionOffset3 = transform * glm::vec4{quadMax.x, quadMin.y, 0.0f, 1.0f},
-                                   .ForegroundColor = config.ForegroundColor,
-                                   .BackgroundColor = config.BackgroundColor,
-                                   .EntityID = entityID};
-            std::vector<byte> instancedData(sizeof(TextInstancedData));
-            memcpy(instancedData.data(), &data, sizeof(TextInstancedData));
-            m_Transparent.emplace_back(Entity{transform,
-                                              &textModel,
-                                              std::vector<BindingSet*>{m_TextBindingSet, &atlasBindingSet},
-                                              std::move(instancedData)});
-
-            if (it != end)
-            {
-                double advance = glyph->getAdvance();
-                char32_t nextCharacter = *it;
-                fontGeometry.getAdvance(advance, character, nextCharacter);
+                    auto& entities = buckets[i].*source;
+                    std::ranges::move(entities, target.begin() + static_cast<ptrdiff_t>(offsets[i]));
+                    entities.clear();
+                },
+                {.GrainSize = 1});
+        };
+        append(m_Opaque, &SceneTreeRenderer::m_Opaque);
+        append(m_Transparent, &SceneTreeRenderer::m_Transparent);
+    }
 
-                x += fsScale * advance + config.KerningOffset;
-            }
+    bool SceneTreeRenderer::AddText(const TextLayout& layout,
+                                    Font& font,
+                                    const glm::mat4& transform,
+                                    const TextRenderingConfiguration& config,
+                                    int32_t entityID,
+                                    const FrustumCuller* culler)
+    {
+        const auto glyphs = layout.GetGlyphs();
+        if (glyphs.empty())
+        {
+            return true;
+        }
+        if (culler && !culler->IsVisible(layout.GetLocalBounds().Transformed(transform)))
+        {
+            return false;
+        }
+        auto& textModel = Application::GetInstance().GetAssetManager().GetModel("Renderer_Font");
+        BindingSet* const bindingSets[] = {m_TextBindingSet, &font.GetAtlasBindingSet()};
+        for (const auto& glyph : glyphs)
+        {
+            const auto data = TextInstancedData::FromGlyph(glyph, transform, config, entityID);
+            Math::AABB glyphBounds;
+            glyphBounds.Expand(data.PositionOffset0);
+            glyphBounds.Expand(data.PositionOffset1);
+            glyphBounds.Expand(data.PositionOffset2);
+            glyphBounds.Expand(data.PositionOffset3);
+            AddEntity(transform,
+                      glyphBounds,
+                      true,
+                      textModel,
+                      bindingSets,
+                      {(const byte*)&data, sizeof(TextInstancedData)});
         }
+        return true;
     }
 } // namespace BeeEngine
\ No newline at end of file
@@ -4,13 +4,21 @@
 
 #pragma once
 #include "Core/String.h"
+#include "Core/Math/AABB.h"
+#include "Core/Memory/FrameAllocator.h"
 #include "Core/UUID.h"
+#include "DrawPacket.h"
 #include "Font.h"
+#include "FrustumCulling.h"
+#include "JobSystem/ParallelAlgorithms.h"
 #include "Renderer/BindingSet.h"
 #include "Renderer/Model.h"
+#include "TextLayout.h"
 #include "TextRenderingConfiguration.h"
 #include "gsl/gsl"
+#include <algorithm>
 #include <glm.hpp>
+#include <span>
 #include <vector>
 
 namespace BeeEngine
@@ -22,30 +30,84 @@ namespace BeeEngine
     public:
         SceneTreeRenderer(glm::mat4 cameraTransform, BindingSet* textBindingSet);
 
+        /**
+         * @brief Adds an instance. Its data is copied into the frame arena,
+         * so nothing is allocated from the heap per instance
+         */
         void AddEntity(glm::mat4 transform,
+                       const Math::AABB& worldBounds,
                        bool isTransparent,
                        Model& model,
-                       const std::vector<BindingSet*>& bindingSets,
-                       gsl::span<byte> instancedData);
-        void AddText(const UTF8String& text,
-                     Font* font,
+                       std::span<BindingSet* const> bindingSets,
+                       gsl::span<const byte> instancedData);
+        /**
+         * @brief Adds a glyph instance for every quad of the laid out text.
+         * If culler is provided and bounds of the whole text are outside of the frustum, nothing is added.
+         * @return true if the text was added
+         */
+        bool AddText(const TextLayout& layout,
+                     Font& font,
                      const glm::mat4& transform,
                      const TextRenderingConfiguration& configuration,
-                     int32_t entityID);
+                     int32_t entityID,
+                     const FrustumCuller* culler = nullptr);
+        /**
+         * @brief Splits [0, count) into contiguous chunks and calls extract(bucket, begin, end)
+         * for every chunk on the job system. Each chunk adds entities only to its own bucket and
+         * buckets are appended to this renderer in chunk order, so the result doesn't depend
+         * on the scheduling and is the same as of a serial loop over [0, count).
+         * extract must be safe to call concurrently for different chunks
+         */
+        template <typename Extract>
+        void ExtractInParallel(size_t count, Extract&& extract)
+        {
+            if (count == 0)
+            {
+                return;
+            }
+            const size_t chunkSize = std::max(MinExtractionChunkSize, Internal::ChooseGrainSize(count, 0));
+            const size_t numberOfChunks = (count + chunkSize - 1) / chunkSize;
+            FrameVector<SceneTreeRenderer> buckets;
+            buckets.reserve(numberOfChunks);
+            for (size_t i = 0; i < numberOfChunks; ++i)
+            {
+                buckets.emplace_back(m_CameraTransform, m_TextBindingSet);
+            }
+            Jobs::ParallelFor(
+                0,
+                numberOfChunks,
+                [&](size_t chunk)
+                {
+                    const size_t begin = chunk * chunkSize;
+                    extract(buckets[chunk], begin, std::min(count, begin + chunkSize));
+                },
+                {.GrainSize = 1});
+            Append(buckets);
+        }
+        /**
+         * @brief Moves entities of the buckets to the end of this renderer in the order of the buckets
+         */
+        void Append(std::span<SceneTreeRenderer> buckets);
+
+        // Entities and their instance data are allocated from the frame arena and are valid until the next frame
         auto&& GetTransparent() { return std::move(m_Transparent); }
         auto&& GetOpaque() { return std::move(m_Opaque); }
 
         struct Entity
         {
             glm::mat4 Transform;
-            Model* Model;
-            std::vector<BindingSet*> BindingSets;
-            std::vector<byte> InstancedData;
+            Math::AABB WorldBounds;
+            Internal::DrawState State;
+            gsl::span<const byte> InstancedData;
         };
+        using EntityList = FrameVector<Entity>;
 
     private:
-        std::vector<Entity> m_Transparent;
-        std::vector<Entity> m_Opaque;
+        // Smaller chunks cost more in scheduling and merging than they save
+        static constexpr size_t MinExtractionChunkSize = 512;
+
+        EntityList m_Transparent;
+        EntityList m_Opaque;
         BindingSet* m_TextBindingSet;
         glm::mat4 m_CameraTransform;
     };
@@ -6,6 +6,7 @@
 #include "Core/Application.h"
 #include "Core/ResourceManager.h"
 #include "FileSystem/File.h"
+#include "Platform/Null/NullShaderModule.h"
 #include "Platform/WebGPU/WebGPUShaderModule.h"
 #include "Renderer.h"
 #include "Utils/ShaderConverter.h"
@@ -43,6 +44,8 @@ namespace BeeEngine
             case Vulkan:
                 return CreateRef<Internal::VulkanShaderModule>(spirv, type, std::move(layout));
 #endif
+            case Null:
+                return CreateRef<Internal::NullShaderModule>(type, std::move(layout));
             case NotAvailable:
             default:
                 BeeCoreError("Unknown renderer API");
@@ -0,0 +1,379 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#include "StaticBatches.h"
+#include "Core/CodeSafety/Expects.h"
+#include "Core/Hash.h"
+#include "Debug/Instrumentor.h"
+#include "FrustumCulling.h"
+#include "Renderer.h"
+#include "RenderingQueue.h"
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+
+namespace BeeEngine
+{
+    StaticBatches::~StaticBatches()
+    {
+        auto& statistics = Internal::RenderingQueue::s_Statistics;
+        statistics.AllocatedGPUMemory -= m_AllocatedGPUMemory;
+        statistics.AllocatedGPUBuffers -= m_AllocatedGPUBuffers;
+    }
+
+    bool StaticBatches::Track(StaticRenderingState& state, std::span<const Instance> instances)
+    {
+        if (instances.empty())
+        {
+            Untrack(state);
+            return false;
+        }
+        // Instances were removed, because the renderer was not tracked in one of the previous frames
+        if (state.Handle.IsValid() && !Contains(state.Handle))
+        {
+            state.Handle = {};
+            state.UnchangedFrames = 0;
+        }
+        if (state.Handle.IsValid())
+        {
+            if (Matches(state.Handle, instances))
+            {
+                MarkTracked(state.Handle);
+                state.UnchangedFrames = std::min(state.UnchangedFrames + 1, FramesToBecomeStatic);
+                return true;
+            }
+            if (state.UnchangedFrames == 0)
+            {
+                // Changed in two frames in a row, so it is moving. Instances are removed on Commit
+                state.Handle = {};
+                state.InstancesHash = HashInstances(instances);
+                return false;
+            }
+            MarkTracked(state.Handle);
+            state.UnchangedFrames = 0;
+            Defer(state, instances);
+            return true;
+        }
+        const uint64_t hash = HashInstances(instances);
+        if (hash != state.InstancesHash)
+        {
+            state.InstancesHash = hash;
+            state.UnchangedFrames = 0;
+            return false;
+        }
+        if (++state.UnchangedFrames < FramesToBecomeStatic)
+        {
+            return false;
+        }
+        Defer(state, instances);
+        return true;
+    }
+
+    void StaticBatches::Untrack(StaticRenderingState& state)
+    {
+        state.Handle = {};
+        state.UnchangedFrames = 0;
+    }
+
+    void StaticBatches::Commit()
+    {
+        BEE_PROFILE_FUNCTION();
+        std::vector<Instance> instances;
+        for (const auto& change : m_DeferredChanges)
+        {
+            instances.clear();
+            for (size_t i = change.FirstInstance; i < change.FirstInstance + change.NumberOfInstances; ++i)
+            {
+                const auto& deferred = m_DeferredInstances[i];
+                instances.push_back({.State = deferred.State,
+                                     .Data = {m_DeferredData.data() + deferred.DataOffset, deferred.DataSize},
+                                     .WorldBounds = deferred.WorldBounds});
+            }
+            StaticRenderingState& state = *change.State;
+            state.Handle = Contains(state.Handle) ? Update(state.Handle, instances) : Add(instances);
+        }
+        m_DeferredChanges.clear();
+        m_DeferredInstances.clear();
+        m_DeferredData.clear();
+
+        for (uint32_t i = 0; i < m_Records.size(); ++i)
+        {
+            if (m_Records[i].Alive && m_Records[i].LastTrackedFrame != m_Frame)
+            {
+                Remove({i, m_Records[i].Generation});
+            }
+        }
+        ++m_Frame;
+    }
+
+    void StaticBatches::Draw(CommandBuffer& commandBuffer, const FrustumCuller& culler)
+    {
+        BEE_PROFILE_FUNCTION();
+        auto& statistics = Internal::RenderingQueue::s_Statistics;
+        for (auto& batch : m_Batches)
+        {
+            const uint32_t size = batch.GetSize();
+            if (size == 0)
+            {
+                continue;
+            }
+            if (batch.BoundsOutdated)
+            {
+                batch.WorldBounds = {};
+                for (const auto& bounds : batch.Bounds)
+                {
+                    batch.WorldBounds.Expand(bounds);
+                }
+                batch.BoundsOutdated = false;
+            }
+            if (!culler.IsVisible(batch.WorldBounds))
+            {
+                statistics.CulledInstanceCount += size;
+                continue;
+            }
+            InstancedBuffer& buffer = Upload(batch);
+            m_BindingSets.assign(batch.State.GetBindingSets().begin(), batch.State.GetBindingSets().end());
+            Renderer::DrawInstanced(commandBuffer, *batch.State.Model, buffer, m_BindingSets, size);
+            statistics.VisibleInstanceCount += size;
+            statistics.StaticInstanceCount += size;
+            statistics.DrawCallCount++;
+            statistics.VertexCount += batch.State.Model->GetVertexCount() * size;
+            statistics.IndexCount += batch.State.Model->GetIndexCount() * size;
+        }
+    }
+
+    bool StaticBatches::Contains(StaticBatchHandle handle) const
+    {
+        return handle.IsValid() && handle.Index < m_Records.size() && m_Records[handle.Index].Alive &&
+               m_Records[handle.Index].Generation == handle.Generation;
+    }
+
+    bool StaticBatches::Matches(StaticBatchHandle handle, std::span<const Instance> instances) const
+    {
+        if (!Contains(handle))
+        {
+            return false;
+        }
+        const auto& locations = m_Records[handle.Index].Locations;
+        if (locations.size() != instances.size())
+        {
+            return false;
+        }
+        for (size_t i = 0; i < locations.size(); ++i)
+        {
+            const Batch& batch = m_Batches[locations[i].Batch];
+            if (batch.Stride != instances[i].Data.size() || batch.State != instances[i].State ||
+                memcmp(batch.Data.data() + locations[i].Slot * batch.Stride, instances[i].Data.data(), batch.Stride) !=
+                    0)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    size_t StaticBatches::GetInstanceCount() const
+    {
+        size_t count = 0;
+        for (const auto& batch : m_Batches)
+        {
+            count += batch.GetSize();
+        }
+        return count;
+    }
+
+    StaticBatchHandle StaticBatches::Add(std::span<const Instance> instances)
+    {
+        uint32_t index;
+        if (!m_FreeRecords.empty())
+        {
+            index = m_FreeRecords.back();
+            m_FreeRecords.pop_back();
+        }
+        else
+        {
+            index = static_cast<uint32_t>(m_Records.size());
+            m_Records.emplace_back();
+        }
+        Record& record = m_Records[index];
+        record.Alive = true;
+        record.LastTrackedFrame = m_Frame;
+        for (const auto& instance : instances)
+        {
+            const uint32_t batchIndex = GetBatch(instance);
+            Batch& batch = m_Batches[batchIndex];
+            const uint32_t slot = batch.GetSize();
+            batch.Data.insert(batch.Data.end(), instance.Data.begin(), instance.Data.end());
+            batch.Bounds.push_back(instance.WorldBounds);
+            batch.Owners.push_back(index);
+            batch.WorldBounds.Expand(instance.WorldBounds);
+            MarkDirty(batch, slot);
+            record.Locations.push_back({batchIndex, slot});
+        }
+        return {index, record.Generation};
+    }
+
+    StaticBatchHandle StaticBatches::Update(StaticBatchHandle handle, std::span<const Instance> instances)
+    {
+        BeeExpects(Contains(handle));
+        const auto& locations = m_Records[handle.Index].Locations;
+        bool sameLayout = locations.size() == instances.size();
+        for (size_t i = 0; sameLayout && i < locations.size(); ++i)
+        {
+            const Batch& batch = m_Batches[locations[i].Batch];
+            sameLayout = batch.State == instances[i].State && batch.Stride == instances[i].Data.size();
+        }
+        if (!sameLayout)
+        {
+            Remove(handle);
+            return Add(instances);
+        }
+        for (size_t i = 0; i < locations.size(); ++i)
+        {
+            Batch& batch = m_Batches[locations[i].Batch];
+            byte* data = batch.Data.data() + locations[i].Slot * batch.Stride;
+            if (memcmp(data, instances[i].Data.data(), batch.Stride) == 0)
+            {
+                continue;
+            }
+            memcpy(data, instances[i].Data.data(), batch.Stride);
+            batch.Bounds[locations[i].Slot] = instances[i].WorldBounds;
+            batch.BoundsOutdated = true;
+            MarkDirty(batch, locations[i].Slot);
+        }
+        return handle;
+    }
+
+    void StaticBatches::Remove(StaticBatchHandle handle)
+    {
+        BeeExpects(Contains(handle));
+        Record& record = m_Records[handle.Index];
+        for (auto& location : record.Locations)
+        {
+            // Removing a slot can move another instance of this record, so the location is read again every time
+            const Location removed = location;
+            location.Slot = std::numeric_limits<uint32_t>::max();
+            RemoveSlot(removed.Batch, removed.Slot);
+        }
+        record.Locations.clear();
+        record.Alive = false;
+        ++record.Generation;
+        m_FreeRecords.push_back(handle.Index);
+    }
+
+    void StaticBatches::Defer(StaticRenderingState& state, std::span<const Instance> instances)
+    {
+        std::unique_lock<Jobs::SpinLock> lock(m_DeferredLock);
+        m_DeferredChanges.push_back({&state, m_DeferredInstances.size(), instances.size()});
+        for (const auto& instance : instances)
+        {
+            m_DeferredInstances.push_back(
+                {instance.State, m_DeferredData.size(), instance.Data.size(), instance.WorldBounds});
+            m_DeferredData.insert(m_DeferredData.end(), instance.Data.begin(), instance.Data.end());
+        }
+    }
+
+    uint32_t StaticBatches::GetBatch(const Instance& instance)
+    {
+        auto& candidates = m_BatchesByState[instance.State];
+        for (uint32_t candidate : candidates)
+        {
+            const Batch& batch = m_Batches[candidate];
+            if (batch.Stride == instance.Data.size() && batch.GetSize() < MaxInstancesPerBatch)
+            {
+                return candidate;
+            }
+        }
+        const auto index = static_cast<uint32_t>(m_Batches.size());
+        m_Batches.emplace_back(instance.State, instance.Data.size());
+        candidates.push_back(index);
+        return index;
+    }
+
+    void StaticBatches::RemoveSlot(uint32_t batchIndex, uint32_t slot)
+    {
+        Batch& batch = m_Batches[batchIndex];
+        const uint32_t last = batch.GetSize() - 1;
+        if (slot != last)
+        {
+            memcpy(batch.Data.data() + slot * batch.Stride, batch.Data.data() + last * batch.Stride, batch.Stride);
+            batch.Bounds[slot] = batch.Bounds[last];
+            const uint32_t owner = batch.Owners[last];
+            batch.Owners[slot] = owner;
+            for (auto& location : m_Records[owner].Locations)
+            {
+                if (location.Batch == batchIndex && location.Slot == last)
+                {
+                    location.Slot = slot;
+                    break;
+                }
+            }
+            MarkDirty(batch, slot);
+        }
+        batch.Data.resize(last * batch.Stride);
+        batch.Bounds.pop_back();
+        batch.Owners.pop_back();
+        batch.BoundsOutdated = true;
+    }
+
+    void StaticBatches::MarkDirty(Batch& batch, uint32_t slot)
+    {
+        for (size_t i = 0; i < Renderer::FramesInFlight; ++i)
+        {
+            batch.DirtyBegin[i] = std::min(batch.DirtyBegin[i], slot * batch.Stride);
+            batch.DirtyEnd[i] = std::max(batch.DirtyEnd[i], (slot + 1) * batch.Stride);
+        }
+    }
+
+    InstancedBuffer& StaticBatches::Upload(Batch& batch)
+    {
+        auto& statistics = Internal::RenderingQueue::s_Statistics;
+        // The buffer was last read FramesInFlight frames ago, so the GPU has finished with it
+        const size_t frame = Renderer::GetFrameNumber() % Renderer::FramesInFlight;
+        auto& buffer = batch.Buffers[frame];
+        size_t& dirtyBegin = batch.DirtyBegin[frame];
+        size_t& dirtyEnd = batch.DirtyEnd[frame];
+        if (!buffer || buffer->GetSize() < batch.Data.size())
+        {
+            // Previous buffer is destroyed by the device after the frame
+            if (buffer)
+            {
+                m_AllocatedGPUMemory -= buffer->GetSize();
+                statistics.AllocatedGPUMemory -= buffer->GetSize();
+                m_AllocatedGPUBuffers--;
+                statistics.AllocatedGPUBuffers--;
+            }
+            const size_t size = std::min(std::max(batch.Data.size() * 2, batch.Stride * 64),
+                                         batch.Stride * MaxInstancesPerBatch);
+            buffer = InstancedBuffer::Create(size);
+            m_AllocatedGPUMemory += size;
+            statistics.AllocatedGPUMemory += size;
+            m_AllocatedGPUBuffers++;
+            statistics.AllocatedGPUBuffers++;
+            dirtyBegin = 0;
+            dirtyEnd = batch.Data.size();
+        }
+        // Removed slots may leave the range behind the end
+        dirtyEnd = std::min(dirtyEnd, batch.Data.size());
+        if (dirtyBegin < dirtyEnd)
+        {
+            buffer->UpdateRange(dirtyBegin, {batch.Data.data() + dirtyBegin, dirtyEnd - dirtyBegin});
+        }
+        dirtyBegin = std::numeric_limits<size_t>::max();
+        dirtyEnd = 0;
+        return *buffer;
+    }
+
+    uint64_t StaticBatches::HashInstances(std::span<const Instance> instances)
+    {
+        uint64_t hash = 0;
+        for (const auto& instance : instances)
+        {
+            const uint64_t state = std::hash<Internal::DrawState>()(instance.State);
+            hash = HashAlgorithm::MurmurHash2_64(&state, sizeof(state), hash);
+            hash = HashAlgorithm::MurmurHash2_64(instance.Data.data(), instance.Data.size(), hash);
+        }
+        return hash;
+    }
+} // namespace BeeEngine
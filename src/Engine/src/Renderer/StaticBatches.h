@@ -0,0 +1,177 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#pragma once
+#include "Core/Math/AABB.h"
+#include "Core/TypeDefines.h"
+#include "DrawPacket.h"
+#include "InstancedBuffer.h"
+#include "JobSystem/SpinLock.h"
+#include "Renderer.h"
+#include <array>
+#include <cstdint>
+#include <gsl/span>
+#include <limits>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace BeeEngine
+{
+    class CommandBuffer;
+    class FrustumCuller;
+
+    /**
+     * @brief Handle of the instances of one renderer in StaticBatches.
+     * Becomes invalid, when the instances are removed, even if the slot is reused
+     */
+    struct StaticBatchHandle
+    {
+        uint32_t Index = std::numeric_limits<uint32_t>::max();
+        uint32_t Generation = 0;
+
+        [[nodiscard]] bool IsValid() const { return Index != std::numeric_limits<uint32_t>::max(); }
+    };
+
+    /**
+     * @brief Tracking state of one renderer of an entity, that is stored in the scene
+     */
+    struct StaticRenderingState
+    {
+        // Hash of the instances of the last frame, while the renderer is drawn dynamically
+        uint64_t InstancesHash = 0;
+        uint32_t UnchangedFrames = 0;
+        StaticBatchHandle Handle;
+    };
+
+    /**
+     * @brief Persistent instance buffers for opaque renderers, whose instance data does not change.
+     * Every frame renderers are passed to Track. A renderer, whose instances have not changed
+     * for FramesToBecomeStatic frames, is moved to a batch with the same draw state and is not extracted anymore:
+     * it is only compared with the data in the batch. Changed instances are written in place and only the changed
+     * range is uploaded. Every batch has a buffer per frame in flight, so the range is written to the buffer of the
+     * current frame, that the GPU no longer reads, and to the other ones, when their frames come.
+     * A renderer, that changes in two consecutive frames, is drawn dynamically again. Batches are culled as a whole
+     */
+    class StaticBatches
+    {
+    public:
+        static constexpr uint32_t FramesToBecomeStatic = 30;
+        static constexpr uint32_t MaxInstancesPerBatch = 4096;
+
+        struct Instance
+        {
+            Internal::DrawState State;
+            gsl::span<const byte> Data;
+            Math::AABB WorldBounds;
+        };
+
+        StaticBatches() = default;
+        ~StaticBatches();
+        StaticBatches(const StaticBatches&) = delete;
+        StaticBatches& operator=(const StaticBatches&) = delete;
+
+        /**
+         * @brief Compares the instances of the renderer with the last frame. Thread safe for different states.
+         * Additions and changes of batches are deferred until Commit
+         * @return true if the renderer is drawn from the batches and must not be extracted
+         */
+        bool Track(StaticRenderingState& state, std::span<const Instance> instances);
+        /**
+         * @brief For renderers, that can not be static this frame, e.g. transparent ones
+         */
+        void Untrack(StaticRenderingState& state);
+        /**
+         * @brief Applies deferred changes and removes instances of renderers, that were not tracked since
+         * the last Commit, e.g. of destroyed entities. Called once after all renderers were tracked
+         */
+        void Commit();
+        /**
+         * @brief Uploads changed ranges and draws visible batches
+         */
+        void Draw(CommandBuffer& commandBuffer, const FrustumCuller& culler);
+
+        [[nodiscard]] bool Contains(StaticBatchHandle handle) const;
+        [[nodiscard]] bool Matches(StaticBatchHandle handle, std::span<const Instance> instances) const;
+        [[nodiscard]] size_t GetInstanceCount() const;
+        [[nodiscard]] size_t GetBatchCount() const { return m_Batches.size(); }
+
+    private:
+        struct Location
+        {
+            uint32_t Batch;
+            uint32_t Slot;
+        };
+        struct Record
+        {
+            std::vector<Location> Locations;
+            uint32_t Generation = 0;
+            uint32_t LastTrackedFrame = 0;
+            bool Alive = false;
+        };
+        struct Batch
+        {
+            Internal::DrawState State;
+            size_t Stride;
+            std::vector<byte> Data;
+            std::vector<Math::AABB> Bounds;
+            // Record of every slot
+            std::vector<uint32_t> Owners;
+            Math::AABB WorldBounds;
+            bool BoundsOutdated = false;
+            std::array<Scope<InstancedBuffer>, Renderer::FramesInFlight> Buffers;
+            // Byte range of every buffer, that must be uploaded, empty if DirtyBegin >= DirtyEnd
+            std::array<size_t, Renderer::FramesInFlight> DirtyBegin;
+            std::array<size_t, Renderer::FramesInFlight> DirtyEnd{};
+
+            Batch(const Internal::DrawState& state, size_t stride) : State(state), Stride(stride)
+            {
+                DirtyBegin.fill(std::numeric_limits<size_t>::max());
+            }
+
+            [[nodiscard]] uint32_t GetSize() const { return static_cast<uint32_t>(Owners.size()); }
+        };
+        struct DeferredChange
+        {
+            StaticRenderingState* State;
+            size_t FirstInstance;
+            size_t NumberOfInstances;
+        };
+        struct DeferredInstance
+        {
+            Internal::DrawState State;
+            size_t DataOffset;
+            size_t DataSize;
+            Math::AABB WorldBounds;
+        };
+
+        StaticBatchHandle Add(std::span<const Instance> instances);
+        StaticBatchHandle Update(StaticBatchHandle handle, std::span<const Instance> instances);
+        void Remove(StaticBatchHandle handle);
+        void Defer(StaticRenderingState& state, std::span<const Instance> instances);
+        void MarkTracked(StaticBatchHandle handle) { m_Records[handle.Index].LastTrackedFrame = m_Frame; }
+        uint32_t GetBatch(const Instance& instance);
+        void RemoveSlot(uint32_t batchIndex, uint32_t slot);
+        static void MarkDirty(Batch& batch, uint32_t slot);
+        // Returns the buffer of the current frame with the data of the batch
+        InstancedBuffer& Upload(Batch& batch);
+        static uint64_t HashInstances(std::span<const Instance> instances);
+
+        std::vector<Record> m_Records;
+        std::vector<uint32_t> m_FreeRecords;
+        std::vector<Batch> m_Batches;
+        std::unordered_map<Internal::DrawState, std::vector<uint32_t>> m_BatchesByState;
+        // Starts with 1, so new records are not tracked yet
+        uint32_t m_Frame = 1;
+
+        std::vector<DeferredChange> m_DeferredChanges;
+        std::vector<DeferredInstance> m_DeferredInstances;
+        std::vector<byte> m_DeferredData;
+        Jobs::SpinLock m_DeferredLock;
+
+        std::vector<BindingSet*> m_BindingSets;
+        size_t m_AllocatedGPUMemory = 0;
+        size_t m_AllocatedGPUBuffers = 0;
+    };
+} // namespace BeeEngine
@@ -0,0 +1,29 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#include "StorageBuffer.h"
+#include "Platform/Null/NullStorageBuffer.h"
+#include "Platform/Vulkan/VulkanStorageBuffer.h"
+#include "Renderer.h"
+
+namespace BeeEngine
+{
+    Scope<StorageBuffer> StorageBuffer::Create(size_t size, StorageBufferUsage usage)
+    {
+        BeeExpects(size > 0);
+        switch (Renderer::GetAPI())
+        {
+#if defined(BEE_COMPILE_VULKAN)
+            case Vulkan:
+                return CreateScope<Internal::VulkanStorageBuffer>(size, usage);
+#endif
+            case Null:
+                return CreateScope<Internal::NullStorageBuffer>(size, usage);
+            default:
+                break;
+        }
+        BeeCoreError("Unknown RendererAPI!");
+        return nullptr;
+    }
+} // namespace BeeEngine
@@ -0,0 +1,48 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#pragma once
+#include "Core/TypeDefines.h"
+#include "IBindable.h"
+#include <gsl/span>
+#include <vector>
+
+namespace BeeEngine
+{
+    enum class StorageBufferUsage
+    {
+        // Written by the CPU with SetData and read by compute shaders
+        CPUToGPU,
+        // Written by compute shaders and read by the GPU as instance data or as arguments of indirect draws
+        GPUOnly
+    };
+
+    /**
+     * @brief Buffer of arbitrary size, that compute shaders read and write. Bound as a storage buffer of a binding set.
+     * Can be bound as the instance buffer or as the command buffer of RendererAPI::DrawIndexedIndirect
+     */
+    class StorageBuffer : public IBindable
+    {
+    public:
+        StorageBuffer() = default;
+        ~StorageBuffer() override = default;
+        StorageBuffer(const StorageBuffer& other) = delete;
+        StorageBuffer& operator=(const StorageBuffer& other) = delete;
+
+        /**
+         * @brief Writes data at the offset and leaves the rest of the buffer as it is.
+         * Only for CPUToGPU buffers, the GPU must not read the range anymore
+         */
+        virtual void SetData(size_t offset, gsl::span<const byte> data) = 0;
+        /**
+         * @brief Waits, until the GPU has finished all submitted work, and copies the contents of the buffer.
+         * Slow, for tests and debugging
+         */
+        [[nodiscard]] virtual std::vector<byte> ReadData() = 0;
+        [[nodiscard]] virtual size_t GetSize() const = 0;
+        [[nodiscard]] virtual StorageBufferUsage GetUsage() const = 0;
+
+        static Scope<StorageBuffer> Create(size_t size, StorageBufferUsage usage);
+    };
+} // namespace BeeEngine
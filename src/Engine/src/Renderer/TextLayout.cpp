@@ -0,0 +1,154 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#include "TextLayout.h"
+#include "Core/CodeSafety/Expects.h"
+#include "Debug/Instrumentor.h"
+
+namespace BeeEngine
+{
+    namespace
+    {
+        constexpr uint64_t MakeKerningKey(int32_t first, int32_t second)
+        {
+            return (static_cast<uint64_t>(static_cast<uint32_t>(first)) << 32) | static_cast<uint32_t>(second);
+        }
+    } // namespace
+
+    void FontMetrics::AddGlyph(char32_t codepoint, const Glyph& glyph)
+    {
+        if (codepoint >= m_GlyphIndices.size())
+        {
+            m_GlyphIndices.resize(codepoint + 1, InvalidIndex);
+        }
+        m_GlyphIndices[codepoint] = static_cast<uint32_t>(m_Glyphs.size());
+        m_Glyphs.push_back(glyph);
+    }
+
+    void FontMetrics::AddKerning(int32_t firstFontIndex, int32_t secondFontIndex, float kerning)
+    {
+        m_Kerning[MakeKerningKey(firstFontIndex, secondFontIndex)] = kerning;
+    }
+
+    float FontMetrics::GetAdvance(char32_t first, char32_t second, float fallback) const
+    {
+        const Glyph* firstGlyph = GetGlyph(first);
+        if (!firstGlyph)
+        {
+            return fallback;
+        }
+        float advance = firstGlyph->Advance;
+        const Glyph* secondGlyph = GetGlyph(second);
+        if (secondGlyph && !m_Kerning.empty())
+        {
+            auto it = m_Kerning.find(MakeKerningKey(firstGlyph->FontIndex, secondGlyph->FontIndex));
+            if (it != m_Kerning.end())
+            {
+                advance += it->second;
+            }
+        }
+        return advance;
+    }
+
+    TextLayout::TextLayout(const UTF8String& text, const FontMetrics& metrics, const TextRenderingConfiguration& config)
+    {
+        Rebuild(text, metrics, config);
+    }
+
+    void TextLayout::Rebuild(const UTF8String& text, const FontMetrics& metrics, const TextRenderingConfiguration& config)
+    {
+        BEE_PROFILE_FUNCTION();
+        BeeExpects(IsValidString(text));
+        const FontMetrics::Glyph* spaceGlyph = metrics.GetGlyph(' ');
+        const FontMetrics::Glyph* fallbackGlyph = metrics.GetGlyph('?');
+        const float spaceAdvance = spaceGlyph ? spaceGlyph->Advance : 0.0f;
+
+        float x = 0.0f;
+        float y = 0.0f;
+        m_Glyphs.clear();
+        m_Glyphs.reserve(text.size());
+        m_LocalBounds = {};
+
+        UTF8StringView textView(text);
+        auto it = textView.begin();
+        const auto end = textView.end();
+        while (it != end)
+        {
+            const char32_t character = *it++;
+            // Advance after the last character is not needed
+            const bool hasNext = it != end;
+            switch (character)
+            {
+                case '\r':
+                    continue;
+                case '\n':
+                    x = 0.0f;
+                    y -= metrics.GetLineHeight() + config.LineSpacing;
+                    continue;
+                case ' ':
+                    if (hasNext)
+                    {
+                        x += metrics.GetAdvance(character, *it, spaceAdvance) + config.KerningOffset;
+                    }
+                    continue;
+                case '\t':
+                    // Tab is four spaces
+                    if (hasNext)
+                    {
+                        for (int j = 0; j < 3; ++j)
+                        {
+                            x += metrics.GetAdvance(character, ' ', spaceAdvance) + config.KerningOffset;
+                        }
+                        x += metrics.GetAdvance(character, *it, spaceAdvance) + config.KerningOffset;
+                    }
+                    continue;
+                default:
+                    break;
+            }
+            const FontMetrics::Glyph* glyph = metrics.GetGlyph(character);
+            if (!glyph)
+            {
+                glyph = fallbackGlyph;
+                if (!glyph)
+                {
+                    continue;
+                }
+            }
+            const glm::vec2 offset{x, y};
+            GlyphQuad& quad = m_Glyphs.emplace_back(GlyphQuad{.QuadMin = glyph->QuadMin + offset,
+                                                              .QuadMax = glyph->QuadMax + offset,
+                                                              .TexCoordMin = glyph->TexCoordMin,
+                                                              .TexCoordMax = glyph->TexCoordMax});
+            m_LocalBounds.Expand(glm::vec3(quad.QuadMin, 0.0f));
+            m_LocalBounds.Expand(glm::vec3(quad.QuadMax, 0.0f));
+
+            if (hasNext)
+            {
+                x += metrics.GetAdvance(character, *it, glyph->Advance) + config.KerningOffset;
+            }
+        }
+    }
+
+    TextInstancedData TextInstancedData::FromGlyph(const GlyphQuad& glyph,
+                                                   const glm::mat4& transform,
+                                                   const TextRenderingConfiguration& config,
+                                                   int32_t entityID)
+    {
+        const glm::vec2& quadMin = glyph.QuadMin;
+        const glm::vec2& quadMax = glyph.QuadMax;
+        const glm::vec2& texCoordMin = glyph.TexCoordMin;
+        const glm::vec2& texCoordMax = glyph.TexCoordMax;
+        return {.TexCoord0 = texCoordMin,
+                .TexCoord1 = {texCoordMin.x, texCoordMax.y},
+                .TexCoord2 = texCoordMax,
+                .TexCoord3 = {texCoordMax.x, texCoordMin.y},
+                .PositionOffset0 = transform * glm::vec4(quadMin, 0.0f, 1.0f),
+                .PositionOffset1 = transform * glm::vec4{quadMin.x, quadMax.y, 0.0f, 1.0f},
+                .PositionOffset2 = transform * glm::vec4(quadMax, 0.0f, 1.0f),
+                .PositionOffset3 = transform * glm::vec4{quadMax.x, quadMin.y, 0.0f, 1.0f},
+                .ForegroundColor = config.ForegroundColor,
+                .BackgroundColor = config.BackgroundColor,
+                .EntityID = entityID};
+    }
+} // namespace BeeEngine
@@ -0,0 +1,124 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#pragma once
+#include "Core/Color4.h"
+#include "Core/Math/AABB.h"
+#include "Core/String.h"
+#include "TextRenderingConfiguration.h"
+#include <cstdint>
+#include <glm.hpp>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace BeeEngine
+{
+    /**
+     * @brief Glyph metrics of a font in flat tables, that are filled once, when the font is loaded,
+     * so text layout does not query msdf FontGeometry. Sizes are in units of the line height of the font
+     * (ascender - descender), texture coordinates are normalized
+     */
+    class FontMetrics
+    {
+    public:
+        struct Glyph
+        {
+            glm::vec2 QuadMin;
+            glm::vec2 QuadMax;
+            glm::vec2 TexCoordMin;
+            glm::vec2 TexCoordMax;
+            float Advance;
+            // Index of the glyph in the font file, kerning pairs refer to it
+            int32_t FontIndex;
+        };
+
+        void AddGlyph(char32_t codepoint, const Glyph& glyph);
+        void AddKerning(int32_t firstFontIndex, int32_t secondFontIndex, float kerning);
+        void SetLineHeight(float lineHeight) { m_LineHeight = lineHeight; }
+
+        [[nodiscard]] const Glyph* GetGlyph(char32_t codepoint) const
+        {
+            if (codepoint >= m_GlyphIndices.size() || m_GlyphIndices[codepoint] == InvalidIndex)
+            {
+                return nullptr;
+            }
+            return &m_Glyphs[m_GlyphIndices[codepoint]];
+        }
+        /**
+         * @brief Advance after the first character including kerning with the second one.
+         * If the font has no glyph for the first character, returns fallback
+         */
+        [[nodiscard]] float GetAdvance(char32_t first, char32_t second, float fallback) const;
+        [[nodiscard]] float GetLineHeight() const { return m_LineHeight; }
+
+    private:
+        static constexpr uint32_t InvalidIndex = UINT32_MAX;
+
+        // Indexed by codepoint. Loaded charsets are dense ranges, so it is small
+        std::vector<uint32_t> m_GlyphIndices;
+        std::vector<Glyph> m_Glyphs;
+        // Key is both font indices of the pair
+        std::unordered_map<uint64_t, float> m_Kerning;
+        float m_LineHeight = 1.0f;
+    };
+
+    /**
+     * @brief Quad of one glyph in the local space of the text
+     */
+    struct GlyphQuad
+    {
+        glm::vec2 QuadMin;
+        glm::vec2 QuadMax;
+        glm::vec2 TexCoordMin;
+        glm::vec2 TexCoordMax;
+    };
+
+    /**
+     * @brief Laid out glyph quads of a text. Depends only on the text, the font and the spacing
+     * of the configuration, so it is built once and only transformed every frame
+     */
+    class TextLayout
+    {
+    public:
+        TextLayout() = default;
+        TextLayout(const UTF8String& text, const FontMetrics& metrics, const TextRenderingConfiguration& config);
+
+        /**
+         * @brief Lays out the text again. Memory of the previous layout is reused
+         */
+        void Rebuild(const UTF8String& text, const FontMetrics& metrics, const TextRenderingConfiguration& config);
+
+        [[nodiscard]] std::span<const GlyphQuad> GetGlyphs() const { return m_Glyphs; }
+        // Bounds of all quads in the local space of the text, empty if there are no glyphs
+        [[nodiscard]] const Math::AABB& GetLocalBounds() const { return m_LocalBounds; }
+
+    private:
+        std::vector<GlyphQuad> m_Glyphs;
+        Math::AABB m_LocalBounds;
+    };
+
+    /**
+     * @brief Instance data of a glyph for the text shader
+     */
+    struct TextInstancedData
+    {
+        glm::vec2 TexCoord0;
+        glm::vec2 TexCoord1;
+        glm::vec2 TexCoord2;
+        glm::vec2 TexCoord3;
+        glm::vec3 PositionOffset0;
+        glm::vec3 PositionOffset1;
+        glm::vec3 PositionOffset2;
+        glm::vec3 PositionOffset3;
+        Color4 ForegroundColor;
+        Color4 BackgroundColor;
+        int32_t EntityID;
+
+        static TextInstancedData FromGlyph(const GlyphQuad& glyph,
+                                           const glm::mat4& transform,
+                                           const TextRenderingConfiguration& config,
+                                           int32_t entityID);
+    };
+} // namespace BeeEngine
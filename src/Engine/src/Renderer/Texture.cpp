@@ -5,38 +5,62 @@
 #include "Texture.h"
 #include "Core/AssetManagement/TextureImporter.h"
 #include "Core/Logging/Log.h"
+#include "Platform/Null/NullTexture2D.h"
 #include "Platform/Vulkan/VulkanTexture2D.h"
 #include "Platform/WebGPU/WebGPUTexture2D.h"
 #include "Renderer.h"
 
 namespace BeeEngine
 {
+    // Alpha of 0 is discarded in the shaders and alpha of 255 is opaque, anything between must be blended
+    static bool HasTranslucentPixels(gsl::span<std::byte> data, uint32_t numberOfChannels)
+    {
+        if (numberOfChannels != 4)
+        {
+            return false;
+        }
+        for (size_t i = 3; i < data.size(); i += 4)
+        {
+            const auto alpha = std::to_integer<uint8_t>(data[i]);
+            if (alpha != 0 && alpha != 255)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
 
     Ref<Texture2D>
     Texture2D::Create(uint32_t width, uint32_t height, gsl::span<std::byte> data, uint32_t numberOfChannels)
     {
-        return CreateRef<Texture2D>(
-            CreateScope<Internal::VulkanGPUTextureResource>(width, height, data, numberOfChannels));
+        return CreateRef<Texture2D>(GPUTextureResource::Create(width, height, data, numberOfChannels));
     }
     Scope<GPUTextureResource>
     GPUTextureResource::Create(uint32_t width, uint32_t height, gsl::span<std::byte> data, uint32_t numberOfChannels)
     {
         BEE_PROFILE_FUNCTION();
-        switch (Renderer::GetAPI())
+        Scope<GPUTextureResource> texture = [&]() -> Scope<GPUTextureResource>
         {
+            switch (Renderer::GetAPI())
+            {
 #if defined(BEE_COMPILE_VULKAN)
-            case RenderAPI::Vulkan:
-                return CreateScope<Internal::VulkanGPUTextureResource>(width, height, data, numberOfChannels);
+                case RenderAPI::Vulkan:
+                    return CreateScope<Internal::VulkanGPUTextureResource>(width, height, data, numberOfChannels);
 #endif
 #if defined(BEE_COMPILE_WEBGPU)
-            case RenderAPI::WebGPU:
-                return CreateRef<Internal::WebGPUTexture2D>(width, height, data, numberOfChannels);
+                case RenderAPI::WebGPU:
+                    return CreateRef<Internal::WebGPUTexture2D>(width, height, data, numberOfChannels);
 #endif
+                case RenderAPI::Null:
+                    return CreateScope<Internal::NullGPUTextureResource>(width, height);
 
-            default:
-                BeeCoreError("Unknown RenderAPI");
-                throw std::exception();
-        }
+                default:
+                    BeeCoreError("Unknown RenderAPI");
+                    throw std::exception();
+            }
+        }();
+        texture->m_HasTranslucency = HasTranslucentPixels(data, numberOfChannels);
+        return texture;
     }
     Scope<GPUTextureResource> GPUTextureResource::Create(const Path& path)
     {
@@ -53,6 +53,15 @@ namespace BeeEngine
          */
         [[nodiscard]] uintptr_t GetRendererID() const { return m_RendererID; }
 
+        /**
+         * @brief Checks if the texture has pixels, that must be blended.
+         * Fully transparent pixels are discarded by the shaders, so only partially transparent ones count.
+         * Textures, that were not created from pixel data, are assumed to have them
+         *
+         * @return True if the texture has partially transparent pixels.
+         */
+        [[nodiscard]] bool HasTranslucency() const { return m_HasTranslucency; }
+
         /**
          * @brief Compares this texture resource with another for equality.
          *
@@ -93,6 +102,7 @@ namespace BeeEngine
         uintptr_t m_RendererID; ///< Renderer ID used to bind the texture in the GPU.
         uint32_t m_Width;       ///< Width of the texture.
         uint32_t m_Height;      ///< Height of the texture.
+        bool m_HasTranslucency = true; ///< Whether the texture has partially transparent pixels.
     };
 
     /**
@@ -149,6 +159,13 @@ namespace BeeEngine
          */
         [[nodiscard]] uint32_t GetHeight() const { return m_TextureResource->GetHeight(); }
 
+        /**
+         * @brief Checks if the texture has partially transparent pixels and must be blended.
+         *
+         * @return True if the texture has partially transparent pixels.
+         */
+        [[nodiscard]] bool HasTranslucency() const { return m_TextureResource->HasTranslucency(); }
+
         /**
          * @brief Gets the binding set associated with the texture.
          *
@@ -20,6 +20,9 @@ namespace BeeEngine
             case Vulkan:
                 return CreateRef<Internal::VulkanTLAS>();
 #endif
+            case Null:
+                BeeCoreError("Null renderer does not support TopLevelAccelerationStructure");
+                return nullptr;
             case NotAvailable:
                 BeeCoreError("Renderer API is not available");
                 break;
@@ -11,7 +11,7 @@ namespace BeeEngine
     {
     public:
         virtual ~TopLevelAccelerationStructure() = default;
-        virtual void UpdateInstances(std::vector<BeeEngine::SceneTreeRenderer::Entity>&& entities) = 0;
+        virtual void UpdateInstances(BeeEngine::SceneTreeRenderer::EntityList&& entities) = 0;
 
         static Ref<TopLevelAccelerationStructure> Create();
     };
@@ -3,6 +3,7 @@
 //
 
 #include "UniformBuffer.h"
+#include "Platform/Null/NullUniformBuffer.h"
 
 #include "Platform/Vulkan/VulkanUniformBuffer.h"
 #include "Platform/WebGPU/WebGPUUniformBuffer.h"
@@ -23,6 +24,25 @@ namespace BeeEngine
             case Vulkan:
                 return CreateScope<Internal::VulkanUniformBuffer>(size);
 #endif
+            case Null:
+                return CreateScope<Internal::NullUniformBuffer>(size);
+        }
+        BeeCoreError("Unknown RendererAPI!");
+        return nullptr;
+    }
+
+    Scope<UniformBuffer> UniformBuffer::CreateArray(size_t elementSize, uint32_t count)
+    {
+        switch (Renderer::GetAPI())
+        {
+#if defined(BEE_COMPILE_VULKAN)
+            case Vulkan:
+                return CreateScope<Internal::VulkanUniformBuffer>(elementSize, count, 1);
+#endif
+            case Null:
+                return CreateScope<Internal::NullUniformBuffer>(elementSize, count);
+            default:
+                break;
         }
         BeeCoreError("Unknown RendererAPI!");
         return nullptr;
@@ -15,7 +15,41 @@ namespace BeeEngine
         ~UniformBuffer() override = default;
         UniformBuffer(const UniformBuffer& other) = delete;
         UniformBuffer& operator=(const UniformBuffer& other) = delete;
+        /**
+         * @brief Buffer for data, that changes every frame, e.g. of the camera. Every SetData writes a new version
+         * into a ring, while the GPU may still read the previous ones, and selects it with the dynamic offset
+         */
         static Scope<UniformBuffer> Create(size_t size);
+        /**
+         * @brief Array of elements of the same size, that are updated in place with SetElement
+         * and bound with UniformBufferElement. Pools data of many objects, that rarely changes
+         */
+        static Scope<UniformBuffer> CreateArray(size_t elementSize, uint32_t count);
         virtual void SetData(const void* data, size_t size) = 0;
+        virtual void SetElement(uint32_t index, const void* data, size_t size) = 0;
+        [[nodiscard]] virtual uint32_t GetElementOffset(uint32_t index) const = 0;
+    };
+
+    /**
+     * @brief Binds one element of an array uniform buffer
+     */
+    class UniformBufferElement : public IBindable
+    {
+    public:
+        UniformBufferElement(UniformBuffer& buffer, uint32_t index) : m_Buffer(buffer), m_Index(index) {}
+
+        std::vector<BindGroupLayoutEntryType> GetBindGroupLayoutEntry() const override
+        {
+            return m_Buffer.GetBindGroupLayoutEntry();
+        }
+        std::vector<BindGroupEntryType> GetBindGroupEntry() const override { return m_Buffer.GetBindGroupEntry(); }
+        uint32_t GetDynamicOffset() const override { return m_Buffer.GetElementOffset(m_Index); }
+
+        void SetData(const void* data, size_t size) { m_Buffer.SetElement(m_Index, data, size); }
+        [[nodiscard]] uint32_t GetIndex() const { return m_Index; }
+
+    private:
+        UniformBuffer& m_Buffer;
+        uint32_t m_Index;
     };
 } // namespace BeeEngine
@@ -0,0 +1,53 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#include "UniformBufferPool.h"
+#include "Core/CodeSafety/Expects.h"
+
+namespace BeeEngine
+{
+    UniformBufferPool::Element::Element(Ref<Page> page, uint32_t index)
+        : UniformBufferElement(*page->Buffer, index), m_Page(std::move(page))
+    {
+    }
+
+    UniformBufferPool::Element::~Element()
+    {
+        std::lock_guard lock(m_Page->Mutex);
+        m_Page->FreeIndices.push_back(GetIndex());
+    }
+
+    Ref<UniformBufferPool::Element> UniformBufferPool::Allocate()
+    {
+        std::lock_guard lock(m_Mutex);
+        std::erase_if(m_Pages, [](const WeakRef<Page>& page) { return page.expired(); });
+        for (auto& weakPage : m_Pages)
+        {
+            auto page = weakPage.lock();
+            if (!page)
+            {
+                continue;
+            }
+            std::unique_lock pageLock(page->Mutex);
+            if (page->FreeIndices.empty())
+            {
+                continue;
+            }
+            const uint32_t index = page->FreeIndices.back();
+            page->FreeIndices.pop_back();
+            pageLock.unlock();
+            return CreateRef<Element>(std::move(page), index);
+        }
+        auto page = CreateRef<Page>();
+        page->Buffer = UniformBuffer::CreateArray(m_ElementSize, ElementsPerPage);
+        page->FreeIndices.reserve(ElementsPerPage);
+        // Lowest indices are allocated first
+        for (uint32_t index = ElementsPerPage; index-- > 1;)
+        {
+            page->FreeIndices.push_back(index);
+        }
+        m_Pages.push_back(page);
+        return CreateRef<Element>(std::move(page), 0);
+    }
+} // namespace BeeEngine
@@ -0,0 +1,53 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#pragma once
+#include "Core/TypeDefines.h"
+#include "UniformBuffer.h"
+#include <mutex>
+#include <vector>
+
+namespace BeeEngine
+{
+    /**
+     * @brief Allocates elements of the same size from pages of array uniform buffers, so data of many objects,
+     * e.g. constants of material instances, is not stored in a buffer per object. A page is destroyed with
+     * its last element. Elements are updated in place, so the data should change rarely
+     */
+    class UniformBufferPool
+    {
+        struct Page;
+
+    public:
+        static constexpr uint32_t ElementsPerPage = 256;
+
+        class Element final : public UniformBufferElement
+        {
+        public:
+            Element(Ref<Page> page, uint32_t index);
+            ~Element() override;
+            Element(const Element&) = delete;
+            Element& operator=(const Element&) = delete;
+
+        private:
+            Ref<Page> m_Page;
+        };
+
+        explicit UniformBufferPool(size_t elementSize) : m_ElementSize(elementSize) {}
+
+        Ref<Element> Allocate();
+
+    private:
+        struct Page
+        {
+            Scope<UniformBuffer> Buffer;
+            std::vector<uint32_t> FreeIndices;
+            std::mutex Mutex;
+        };
+
+        size_t m_ElementSize;
+        std::vector<WeakRef<Page>> m_Pages;
+        std::mutex m_Mutex;
+    };
+} // namespace BeeEngine
@@ -2,6 +2,7 @@
 // Created by alexl on 02.08.2023.
 //
 #include "Components.h"
+#include "Debug/Instrumentor.h"
 #include "Scripting/GameScript.h"
 #include "Scripting/MClass.h"
 #include "Scripting/ScriptingEngine.h"
@@ -21,6 +22,57 @@ namespace BeeEngine
         Class = mClass;
         EditableFields = ScriptingEngine::GetDefaultScriptFields(Class);
     }
+
+    void UpdateWorldTransforms(entt::registry& registry)
+    {
+        BEE_PROFILE_FUNCTION();
+        {
+            auto missing = registry.view<TransformComponent>(entt::exclude<WorldTransformComponent>);
+            std::vector<entt::entity> entities(missing.begin(), missing.end());
+            for (auto entity : entities)
+            {
+                registry.emplace<WorldTransformComponent>(entity);
+            }
+        }
+
+        struct Node
+        {
+            entt::entity Entity;
+            // nullptr for the roots. Storages don't change during the walk, so the pointer stays valid
+            const glm::mat4* ParentTransform;
+            bool ParentChanged;
+        };
+        std::vector<Node> stack;
+        auto hierarchyView = registry.view<HierarchyComponent>();
+        for (auto entity : hierarchyView)
+        {
+            if (!hierarchyView.get<HierarchyComponent>(entity).Parent)
+            {
+                stack.push_back({entity, nullptr, false});
+            }
+        }
+        while (!stack.empty())
+        {
+            const Node node = stack.back();
+            stack.pop_back();
+            auto& local = registry.get<TransformComponent>(node.Entity);
+            auto& world = registry.get<WorldTransformComponent>(node.Entity);
+            const bool changed = node.ParentChanged || world.IsOutdated(local);
+            if (changed)
+            {
+                world.Transform =
+                    node.ParentTransform ? *node.ParentTransform * local.GetTransform() : local.GetTransform();
+                world.CachedTranslation = local.Translation;
+                world.CachedRotation = local.Rotation;
+                world.CachedScale = local.Scale;
+                world.Dirty = false;
+            }
+            for (auto child : hierarchyView.get<HierarchyComponent>(node.Entity).Children)
+            {
+                stack.push_back({static_cast<entt::entity>(child), &world.Transform, changed});
+            }
+        }
+    }
     REFLECT_STRUCT_BEGIN(UUIDComponent)
     REFLECT_STRUCT_MEMBER(ID)
     REFLECT_STRUCT_END()
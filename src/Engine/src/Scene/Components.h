@@ -18,6 +18,8 @@
 #include "Renderer/Material.h"
 #include "Renderer/MaterialData.h"
 #include "Renderer/Mesh.h"
+#include "Renderer/StaticBatches.h"
+#include "Renderer/TextLayout.h"
 #include "Renderer/TextRenderingConfiguration.h"
 #include "Renderer/Texture.h"
 #include "SceneCamera.h"
@@ -101,6 +103,29 @@ namespace BeeEngine
         REFLECT()
     };
 
+    /**
+     * @brief Cached world space transform of the entity. Is not serialized and is not copied,
+     * UpdateWorldTransforms recomputes it parent before children, but only for entities,
+     * whose local transform or any of the parents changed since the last update
+     */
+    struct WorldTransformComponent
+    {
+        glm::mat4 Transform = glm::mat4(1.0f);
+
+        // Local transform, from which Transform was computed
+        glm::vec3 CachedTranslation = glm::vec3(0.0f);
+        glm::vec3 CachedRotation = glm::vec3(0.0f);
+        glm::vec3 CachedScale = glm::vec3(1.0f);
+        // Forces the update of the entity and its children (new entity or change of the hierarchy)
+        bool Dirty = true;
+
+        [[nodiscard]] bool IsOutdated(const TransformComponent& local) const
+        {
+            return Dirty || local.Translation != CachedTranslation || local.Rotation != CachedRotation ||
+                   local.Scale != CachedScale;
+        }
+    };
+
     struct CameraComponent
     {
         SceneCamera Camera;
@@ -182,6 +207,46 @@ namespace BeeEngine
         }
     };
 
+    /**
+     * @brief Cached layout of TextRendererComponent. Is not serialized and is not copied,
+     * the layout is rebuilt only when the text, the font or the spacing of the configuration changes
+     */
+    struct TextLayoutComponent
+    {
+        TextLayout Layout;
+
+        // Input, from which Layout was built
+        String CachedText;
+        const BeeEngine::Font* CachedFont = nullptr;
+        float CachedKerningOffset = 0.0f;
+        float CachedLineSpacing = 0.0f;
+
+        [[nodiscard]] bool IsOutdated(const TextRendererComponent& text, const BeeEngine::Font& font) const
+        {
+            return CachedFont != &font || text.Configuration.KerningOffset != CachedKerningOffset ||
+                   text.Configuration.LineSpacing != CachedLineSpacing || text.Text != CachedText;
+        }
+        void Rebuild(const TextRendererComponent& text, const BeeEngine::Font& font)
+        {
+            Layout.Rebuild(text.Text, font.GetMetrics(), text.Configuration);
+            CachedText = text.Text;
+            CachedFont = &font;
+            CachedKerningOffset = text.Configuration.KerningOffset;
+            CachedLineSpacing = text.Configuration.LineSpacing;
+        }
+    };
+
+    /**
+     * @brief Tracks, whether the renderers of the entity change, so unchanged ones are drawn from StaticBatches
+     * of the scene. Is not serialized and is not copied
+     */
+    struct StaticRenderingComponent
+    {
+        StaticRenderingState Sprite;
+        StaticRenderingState Circle;
+        StaticRenderingState Mesh;
+    };
+
     /*struct MeshComponent
     {
         Ref<Mesh> Mesh = nullptr;
@@ -362,4 +427,11 @@ namespace BeeEngine
                                        BoxCollider2DComponent,
                                        HierarchyComponent,
                                        MeshComponent>;
+
+    /**
+     * @brief Recomputes WorldTransformComponent of every entity, whose local transform or
+     * any of the parents changed. Entities without WorldTransformComponent get it.
+     * Walks the hierarchy from the roots, so every parent is updated before its children
+     */
+    void UpdateWorldTransforms(entt::registry& registry);
 } // namespace BeeEngine
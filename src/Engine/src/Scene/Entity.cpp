@@ -7,6 +7,14 @@
 
 namespace BeeEngine
 {
+    // World transform of the entity and its children depends on the parent now
+    static void MarkWorldTransformDirty(Entity& entity)
+    {
+        if (entity.HasComponent<WorldTransformComponent>())
+        {
+            entity.GetComponent<WorldTransformComponent>().Dirty = true;
+        }
+    }
 
     UUID Entity::GetUUID()
     {
@@ -24,6 +32,7 @@ namespace BeeEngine
         BeeCoreAssert(it != parentHierarchy.Children.end(), "Entity is not a child of its parent");
         parentHierarchy.Children.erase(it);
         hierarchy.Parent = Entity::Null;
+        MarkWorldTransformDirty(*this);
     }
     std::optional<Entity> IfEntityPresentInChildren(Entity who, Entity where)
     {
@@ -77,6 +86,7 @@ namespace BeeEngine
         childHierarchy.Parent = parent;
         parentHierarchy.Children.push_back(child);
         GetComponent<TransformComponent>().SetTransform(Math::ToLocalTransform(*this));
+        MarkWorldTransformDirty(*this);
         BeeEnsures(childHierarchy.Parent == parent);
         BeeEnsures(std::find(parentHierarchy.Children.begin(), parentHierarchy.Children.end(), child) !=
                    parentHierarchy.Children.end());
@@ -90,6 +100,7 @@ namespace BeeEngine
         auto& childHierarchy = child.GetComponent<HierarchyComponent>();
         childHierarchy.Parent = parent;
         parentHierarchy.Children.push_back(child);
+        MarkWorldTransformDirty(child);
     }
 
     bool Entity::HasChild(Entity& child)
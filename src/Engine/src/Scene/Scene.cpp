@@ -146,6 +146,11 @@ namespace BeeEngine
         m_CollisionEnded.clear();
     }
 
+    void Scene::UpdateWorldTransforms()
+    {
+        BeeEngine::UpdateWorldTransforms(m_Registry);
+    }
+
     void Scene::StartRuntime()
     {
         /*if(m_NativeScripts == nullptr)
@@ -190,6 +195,7 @@ namespace BeeEngine
         Entity entity(EntityID{m_Registry.create()}, weak_from_this());
         entity.AddComponent<UUIDComponent>(uuid);
         entity.AddComponent<TransformComponent>();
+        entity.AddComponent<WorldTransformComponent>();
         entity.AddComponent<HierarchyComponent>();
         auto& tag = entity.AddComponent<TagComponent>();
         tag.Tag = name;
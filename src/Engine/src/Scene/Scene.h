@@ -5,8 +5,10 @@
 #pragma once
 
 #include "Renderer/EditorCamera.h"
+#include "Renderer/GPUDrivenMeshes.h"
 #include "Renderer/Model.h"
 #include "Renderer/SceneTreeRenderer.h"
+#include "Renderer/StaticBatches.h"
 #include "Renderer/Texture.h"
 #include "Renderer/TopLevelAccelerationStructure.h"
 #include "Renderer/UniformBuffer.h"
@@ -58,12 +60,19 @@ namespace BeeEngine
             Ref<BindingSet> CameraBindingSet = BindingSet::Create({{0, *CameraUniformBuffer}});
             Ref<UniformBuffer> MeshSceneDataUniformBuffer = UniformBuffer::Create(sizeof(GPUSceneData));
             Ref<BindingSet> MeshSceneDataBindingSet = BindingSet::Create({{0, *MeshSceneDataUniformBuffer}});
+            StaticBatches StaticInstances;
+            GPUDrivenMeshes GPUMeshes;
         };
 
         static Ref<Scene> Copy(Scene& scene);
 
         Scene();
         void UpdateRuntime();
+        /**
+         * @brief Brings WorldTransformComponent of all entities up to date.
+         * Only subtrees with changed local transforms are recomputed
+         */
+        void UpdateWorldTransforms();
         void OnViewPortResize(uint32_t width, uint32_t height);
 
         Entity CreateEntity(const String& name = "Entity");
@@ -670,7 +670,7 @@ namespace BeeEngine
         {
             bindingSet = GetBindingSetForModelType(modelType, handle);
         }
-        std::vector<BindingSet*> bindingSets = {
+        BindingSet* const bindingSets[] = {
             cameraBindingSet ? cameraBindingSet
                              : ScriptingEngine::GetSceneContext()->GetSceneRendererData().CameraBindingSet.get(),
             bindingSet};
@@ -248,6 +248,14 @@ namespace BeeEngine
                                           qualifier.layoutBinding,
                                           GetUniformSize(symbol->getType()));
                     }
+                    else if (qualifier.storage == glslang::EvqBuffer)
+                    {
+                        // Size of a storage buffer is set, when it is created, size of one element is stored
+                        layout.AddUniform(ShaderUniformDataType::StorageBuffer,
+                                          qualifier.layoutSet,
+                                          qualifier.layoutBinding,
+                                          GetUniformSize(symbol->getType()));
+                    }
                 }
             }
 
@@ -488,9 +496,8 @@ namespace BeeEngine
             case tint::inspector::ResourceBinding::ResourceType::kUniformBuffer:
                 return ShaderUniformDataType::Data;
             case tint::inspector::ResourceBinding::ResourceType::kStorageBuffer:
-                break;
             case tint::inspector::ResourceBinding::ResourceType::kReadOnlyStorageBuffer:
-                break;
+                return ShaderUniformDataType::StorageBuffer;
             case tint::inspector::ResourceBinding::ResourceType::kSampler:
                 return ShaderUniformDataType::Sampler;
             case tint::inspector::ResourceBinding::ResourceType::kComparisonSampler:
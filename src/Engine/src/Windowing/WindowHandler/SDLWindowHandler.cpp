@@ -13,6 +13,7 @@
 #if defined(BEE_COMPILE_SDL)
 #include "Core/Application.h"
 #include "Hardware.h"
+#include "Platform/Null/NullGraphicsDevice.h"
 #include "Platform/Vulkan/VulkanGraphicsDevice.h"
 #include "Platform/Vulkan/VulkanInstance.h"
 #include "Platform/WebGPU/WebGPUGraphicsDevice.h"
@@ -248,7 +249,13 @@ namespace BeeEngine::Internal
         s_Instance = this;
         m_vsync = properties.Vsync;
         bool result = false;
-        if (Application::GetOsPlatform() == OSPlatform::Linux)
+        if (properties.PreferredRenderAPI == Null)
+        {
+            // Nothing is presented with the null renderer, so it runs without a display
+            SDL_SetHint(SDL_HINT_VIDEO_DRIVER, "offscreen");
+            result = SDL_Init(SDL_INIT_VIDEO);
+        }
+        else if (Application::GetOsPlatform() == OSPlatform::Linux)
         {
             BeeCoreInfo("Choosing backend for Linux");
             std::array videoDrivers = {"wayland", "x11"};
@@ -290,6 +297,9 @@ namespace BeeEngine::Internal
                     windowFlags |= SDL_WINDOW_METAL;
                 }
                 break;
+            case Null:
+                windowFlags |= SDL_WINDOW_HIDDEN;
+                break;
             default:
                 BeeCoreFatalError("Invalid Renderer API chosen for SDL");
         }
@@ -343,6 +353,9 @@ namespace BeeEngine::Internal
             case WebGPU:
                 InitializeWebGPU();
                 break;
+            case Null:
+                InitializeNull();
+                break;
             default:
                 BeeCoreFatalError("Invalid Renderer API chosen for SDL");
         }
@@ -365,6 +378,12 @@ namespace BeeEngine::Internal
 #endif
     }
 
+    void SDLWindowHandler::InitializeNull()
+    {
+        m_Instance = CreateScope<NullInstance>();
+        m_GraphicsDevice = CreateScope<NullGraphicsDevice>();
+    }
+
     SDLWindowHandler::~SDLWindowHandler()
     {
         m_Finalizer.window = m_Window;
@@ -45,6 +45,7 @@ namespace BeeEngine::Internal
         static MouseButton ConvertMouseButton(uint8_t button);
         void InitializeVulkan();
         void InitializeWebGPU();
+        void InitializeNull();
         void HandleDragDropLinux(const SDL_Event& event);
 
         struct sdlFinalizer
@@ -46,6 +46,7 @@ namespace BeeEngine::Runtime
         {
             BeeCoreTrace("{}", std::source_location::current().function_name());
             m_FpsCounter.Update();
+            m_RendererStatisticsGUI.Update();
         }
         void OnGUIRendering() override
         {
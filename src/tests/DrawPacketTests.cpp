@@ -0,0 +1,175 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#include <Renderer/DrawPacket.h>
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <limits>
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+using namespace BeeEngine;
+using namespace BeeEngine::Internal;
+
+TEST(DrawPacketTest, SortKeyOrdersByPipelineThenStateThenDepth)
+{
+    EXPECT_LT(DrawSortKey::Make(0, 65535, 0xFFFFFFFF), DrawSortKey::Make(1, 0, 0));
+    EXPECT_LT(DrawSortKey::Make(3, 1, 0xFFFFFFFF), DrawSortKey::Make(3, 2, 0));
+    EXPECT_LT(DrawSortKey::Make(3, 2, 5), DrawSortKey::Make(3, 2, 6));
+}
+
+TEST(DrawPacketTest, BackToFrontKeyOrdersByDepthFirst)
+{
+    const uint32_t near = DrawSortKey::FromDepth(1.0f);
+    const uint32_t far = DrawSortKey::FromDepth(50.0f);
+    EXPECT_LT(DrawSortKey::MakeBackToFront(9, 9, far), DrawSortKey::MakeBackToFront(0, 0, near));
+    EXPECT_LT(DrawSortKey::MakeBackToFront(0, 9, far), DrawSortKey::MakeBackToFront(1, 0, far));
+    EXPECT_LT(DrawSortKey::MakeBackToFront(1, 2, far), DrawSortKey::MakeBackToFront(1, 3, far));
+    EXPECT_EQ(DrawSortKey::ToBackToFront(DrawSortKey::Make(7, 42, far)), DrawSortKey::MakeBackToFront(7, 42, far));
+}
+
+TEST(DrawPacketTest, DepthBitsKeepFloatOrder)
+{
+    const std::vector<float> depths{-std::numeric_limits<float>::infinity(),
+                                    -1000.0f,
+                                    -1.5f,
+                                    -std::numeric_limits<float>::denorm_min(),
+                                    0.0f,
+                                    std::numeric_limits<float>::denorm_min(),
+                                    0.25f,
+                                    1.0f,
+                                    1000.0f,
+                                    std::numeric_limits<float>::infinity()};
+    for (size_t i = 1; i < depths.size(); ++i)
+    {
+        EXPECT_LT(DrawSortKey::FromDepth(depths[i - 1]), DrawSortKey::FromDepth(depths[i]))
+            << depths[i - 1] << " and " << depths[i];
+    }
+}
+
+TEST(DrawPacketTest, RadixSortMatchesStableSort)
+{
+    std::mt19937_64 random(42);
+    for (size_t count : {0, 1, 2, 100, 10'000})
+    {
+        std::vector<std::byte> data(count);
+        std::vector<DrawPacket> packets(count);
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            // Few distinct keys, so stability is actually checked
+            packets[i] = {.SortKey = DrawSortKey::Make(random() % 3, random() % 5, random() % 4),
+                          .Data = data.data() + i,
+                          .DataSize = 1,
+                          .DrawState = 0};
+        }
+        auto expected = packets;
+        std::ranges::stable_sort(expected, {}, &DrawPacket::SortKey);
+
+        std::vector<DrawPacket> scratch;
+        SortDrawPackets(packets, scratch);
+        ASSERT_EQ(packets.size(), expected.size());
+        for (size_t i = 0; i < count; ++i)
+        {
+            EXPECT_EQ(packets[i].SortKey, expected[i].SortKey);
+            EXPECT_EQ(packets[i].Data, expected[i].Data);
+        }
+    }
+}
+
+TEST(DrawPacketTest, RadixSortKeepsAlreadySortedPackets)
+{
+    std::vector<std::byte> data(1000);
+    std::vector<DrawPacket> packets;
+    for (uint32_t i = 0; i < data.size(); ++i)
+    {
+        packets.push_back(
+            {.SortKey = DrawSortKey::Make(1, 2, 0), .Data = data.data() + i, .DataSize = 1, .DrawState = 2});
+    }
+    std::vector<DrawPacket> scratch;
+    SortDrawPackets(packets, scratch);
+    for (uint32_t i = 0; i < packets.size(); ++i)
+    {
+        EXPECT_EQ(packets[i].Data, data.data() + i);
+    }
+}
+
+TEST(DrawPacketTest, DrawStatesAreComparedByValue)
+{
+    auto* model = reinterpret_cast<Model*>(0x1000);
+    auto* first = reinterpret_cast<BindingSet*>(0x2000);
+    auto* second = reinterpret_cast<BindingSet*>(0x3000);
+    BindingSet* const bindingSets[] = {first, second};
+    BindingSet* const reversed[] = {second, first};
+
+    DrawState state(*model, bindingSets);
+    DrawState same(*model, bindingSets);
+    DrawState other(*model, reversed);
+    DrawState shorter(*model, std::span<BindingSet* const>(bindingSets, 1));
+
+    EXPECT_EQ(state, same);
+    EXPECT_NE(state, other);
+    EXPECT_NE(state, shorter);
+    EXPECT_EQ(std::hash<DrawState>()(state), std::hash<DrawState>()(same));
+
+    std::unordered_set<DrawState> states{state, same, other, shorter};
+    EXPECT_EQ(states.size(), 3);
+}
+
+TEST(InstanceDataArenaTest, AllocationsStayValidWhenArenaGrows)
+{
+    InstanceDataArena arena;
+    std::vector<std::span<std::byte>> allocations;
+    for (uint32_t i = 0; i < 10'000; ++i)
+    {
+        auto allocation = arena.Allocate(sizeof(uint32_t) * (1 + i % 30));
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(allocation.data()) % InstanceDataArena::Alignment, 0);
+        std::ranges::fill(allocation, static_cast<std::byte>(i));
+        allocations.push_back(allocation);
+    }
+    // Bigger than a block
+    auto big = arena.Allocate(InstanceDataArena::BlockSize * 2);
+    std::ranges::fill(big, std::byte{0xAB});
+    for (uint32_t i = 0; i < allocations.size(); ++i)
+    {
+        EXPECT_TRUE(std::ranges::all_of(allocations[i], [i](std::byte b) { return b == static_cast<std::byte>(i); }))
+            << "Allocation " << i;
+    }
+    EXPECT_GE(arena.GetAllocatedSize(), InstanceDataArena::BlockSize * 3);
+}
+
+TEST(InstanceDataArenaTest, ResetReusesBlocks)
+{
+    InstanceDataArena arena;
+    for (int i = 0; i < 1000; ++i)
+    {
+        (void)arena.Allocate(1024);
+    }
+    const size_t allocated = arena.GetAllocatedSize();
+    arena.Reset();
+    for (int i = 0; i < 1000; ++i)
+    {
+        (void)arena.Allocate(1024);
+    }
+    EXPECT_EQ(arena.GetAllocatedSize(), allocated);
+}
+
+TEST(InstanceDataArenaTest, AppendKeepsMemoryOfBothArenas)
+{
+    InstanceDataArena first;
+    InstanceDataArena second;
+    auto a = first.Allocate(16);
+    auto b = second.Allocate(InstanceDataArena::BlockSize);
+    std::ranges::fill(a, std::byte{1});
+    std::ranges::fill(b, std::byte{2});
+
+    first.Append(std::move(second));
+    EXPECT_EQ(second.GetAllocatedSize(), 0);
+    auto c = first.Allocate(16);
+    std::ranges::fill(c, std::byte{3});
+
+    EXPECT_TRUE(std::ranges::all_of(a, [](std::byte x) { return x == std::byte{1}; }));
+    EXPECT_TRUE(std::ranges::all_of(b, [](std::byte x) { return x == std::byte{2}; }));
+    EXPECT_TRUE(std::ranges::all_of(c, [](std::byte x) { return x == std::byte{3}; }));
+}
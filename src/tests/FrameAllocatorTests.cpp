@@ -0,0 +1,166 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#include <Core/DeletionQueue.h>
+#include <Core/Memory/FrameAllocator.h>
+#include <Core/TypeDefines.h>
+#include <algorithm>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+using namespace BeeEngine;
+
+namespace
+{
+    bool IsFilledWith(const MemoryBlock& block, std::byte value)
+    {
+        const auto* bytes = static_cast<const std::byte*>(block.Ptr);
+        return std::all_of(bytes, bytes + block.Size, [value](std::byte b) { return b == value; });
+    }
+} // namespace
+
+TEST(LinearArenaTest, AllocationsAreAlignedAndStayValidWhenArenaGrows)
+{
+    LinearArena arena(4096);
+    std::vector<MemoryBlock> blocks;
+    for (uint32_t i = 0; i < 1000; ++i)
+    {
+        const size_t alignment = size_t{1} << (i % 7);
+        MemoryBlock block = arena.Allocate(1 + i % 100, alignment);
+        ASSERT_NE(block.Ptr, nullptr);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(block.Ptr) % alignment, 0);
+        memset(block.Ptr, static_cast<int>(i & 0xFF), block.Size);
+        blocks.push_back(block);
+    }
+    // Bigger than a page
+    MemoryBlock big = arena.Allocate(4096 * 3, 64);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(big.Ptr) % 64, 0);
+    memset(big.Ptr, 0xAB, big.Size);
+    for (uint32_t i = 0; i < blocks.size(); ++i)
+    {
+        EXPECT_TRUE(IsFilledWith(blocks[i], static_cast<std::byte>(i & 0xFF))) << "Allocation " << i;
+        EXPECT_TRUE(arena.Owns(blocks[i].Ptr));
+    }
+    EXPECT_TRUE(IsFilledWith(big, std::byte{0xAB}));
+    int onStack = 0;
+    EXPECT_FALSE(arena.Owns(&onStack));
+}
+
+TEST(LinearArenaTest, ResetReusesPagesAndKeepsHighWaterMark)
+{
+    LinearArena arena(4096);
+    for (int i = 0; i < 100; ++i)
+    {
+        (void)arena.Allocate(1000);
+    }
+    const size_t used = arena.GetUsedSize();
+    const size_t reserved = arena.GetReservedSize();
+    EXPECT_GE(used, 100 * 1000);
+    arena.Reset();
+    EXPECT_EQ(arena.GetUsedSize(), 0);
+    EXPECT_EQ(arena.GetHighWaterMark(), used);
+
+    for (int i = 0; i < 10; ++i)
+    {
+        (void)arena.Allocate(1000);
+    }
+    arena.Reset();
+    for (int i = 0; i < 100; ++i)
+    {
+        (void)arena.Allocate(1000);
+    }
+    EXPECT_EQ(arena.GetReservedSize(), reserved);
+    EXPECT_EQ(arena.GetHighWaterMark(), used);
+}
+
+TEST(LinearArenaTest, DeallocateGivesBackOnlyTheLastAllocation)
+{
+    LinearArena arena;
+    MemoryBlock first = arena.Allocate(64);
+    MemoryBlock second = arena.Allocate(64);
+    const size_t used = arena.GetUsedSize();
+
+    arena.Deallocate(first);
+    EXPECT_EQ(arena.GetUsedSize(), used);
+    arena.Deallocate(second);
+    EXPECT_EQ(arena.GetUsedSize(), used - 64);
+    EXPECT_EQ(arena.Allocate(64).Ptr, second.Ptr);
+}
+
+TEST(LinearArenaTest, ConcurrentAllocationsDoNotOverlap)
+{
+    constexpr size_t NumberOfThreads = 8;
+    constexpr size_t AllocationsPerThread = 10'000;
+    LinearArena arena(16 * 1024);
+    std::vector<std::vector<MemoryBlock>> blocks(NumberOfThreads);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < NumberOfThreads; ++t)
+    {
+        threads.emplace_back(
+            [&, t]()
+            {
+                for (size_t i = 0; i < AllocationsPerThread; ++i)
+                {
+                    MemoryBlock block = arena.Allocate(8 + (i % 5) * 8);
+                    memset(block.Ptr, static_cast<int>(t), block.Size);
+                    blocks[t].push_back(block);
+                }
+            });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    std::vector<MemoryBlock> all;
+    for (size_t t = 0; t < NumberOfThreads; ++t)
+    {
+        for (const auto& block : blocks[t])
+        {
+            EXPECT_TRUE(IsFilledWith(block, static_cast<std::byte>(t)));
+            all.push_back(block);
+        }
+    }
+    std::ranges::sort(all, {}, [](const MemoryBlock& block) { return reinterpret_cast<uintptr_t>(block.Ptr); });
+    for (size_t i = 1; i < all.size(); ++i)
+    {
+        EXPECT_LE(static_cast<std::byte*>(all[i - 1].Ptr) + all[i - 1].Size, static_cast<std::byte*>(all[i].Ptr));
+    }
+}
+
+TEST(FrameAllocatorTest, MemoryOfThePreviousFrameStaysValid)
+{
+    FrameVector<int> previous(1000, 42);
+    FrameAllocator::NextFrame();
+    FrameVector<int> current(1000, 7);
+    EXPECT_TRUE(std::ranges::all_of(previous, [](int value) { return value == 42; }));
+    EXPECT_TRUE(FrameAllocator().Owns({previous.data(), sizeof(int)}));
+    EXPECT_TRUE(FrameAllocator::GetCurrentArena().Owns(current.data()));
+    EXPECT_FALSE(FrameAllocator::GetCurrentArena().Owns(previous.data()));
+
+    const auto statistics = FrameAllocator::GetStatistics();
+    EXPECT_GE(statistics.LastFrameUsed, 1000 * sizeof(int));
+    EXPECT_GE(statistics.HighWaterMark, statistics.LastFrameUsed);
+    EXPECT_GE(statistics.Reserved, statistics.HighWaterMark);
+}
+
+TEST(FrameAllocatorTest, FrameScopeIsDestroyedWithTheFrameQueue)
+{
+    struct Tracked
+    {
+        int& Destroyed;
+        explicit Tracked(int& destroyed) : Destroyed(destroyed) {}
+        ~Tracked() { ++Destroyed; }
+    };
+    int destroyed = 0;
+    {
+        auto tracked = CreateFrameScope<Tracked>(destroyed);
+        EXPECT_TRUE(FrameAllocator::GetCurrentArena().Owns(tracked.Get()));
+    }
+    EXPECT_EQ(destroyed, 0);
+    DeletionQueue::Frame().Flush();
+    EXPECT_EQ(destroyed, 1);
+    FrameAllocator::NextFrame();
+}
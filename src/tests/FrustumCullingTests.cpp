@@ -0,0 +1,178 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#include <Core/Math/AABB.h>
+#include <Renderer/FrustumCulling.h>
+#include <cmath>
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+using namespace BeeEngine;
+
+namespace
+{
+    Math::AABB Box(glm::vec3 center, glm::vec3 extents)
+    {
+        return {center - extents, center + extents};
+    }
+
+    // 2D camera, that looks along +z and sees x and y in [-10, 10]
+    std::vector<glm::vec4> OrthographicPlanes()
+    {
+        return GetFrustumPlanes(glm::ortho(-10.0f, 10.0f, -10.0f, 10.0f, 0.1f, 100.0f));
+    }
+} // namespace
+
+TEST(AABBTest, DefaultIsEmpty)
+{
+    Math::AABB box;
+    EXPECT_TRUE(box.IsEmpty());
+    box.Expand(glm::vec3{1.0f, 2.0f, 3.0f});
+    EXPECT_FALSE(box.IsEmpty());
+    EXPECT_EQ(box.Min, box.Max);
+    EXPECT_TRUE(Math::AABB{}.Transformed(glm::mat4(1.0f)).IsEmpty());
+}
+
+TEST(AABBTest, TransformedContainsRotatedBox)
+{
+    Math::AABB square = Box({0.0f, 0.0f, 0.0f}, {0.5f, 0.5f, 0.0f});
+    glm::mat4 transform = glm::translate(glm::mat4(1.0f), glm::vec3{3.0f, 0.0f, 0.0f}) *
+                          glm::rotate(glm::mat4(1.0f), glm::radians(45.0f), glm::vec3{0.0f, 0.0f, 1.0f}) *
+                          glm::scale(glm::mat4(1.0f), glm::vec3{2.0f, 2.0f, 1.0f});
+    auto world = square.Transformed(transform);
+    const float halfDiagonal = std::sqrt(2.0f);
+    EXPECT_NEAR(world.Min.x, 3.0f - halfDiagonal, 1e-5f);
+    EXPECT_NEAR(world.Max.x, 3.0f + halfDiagonal, 1e-5f);
+    EXPECT_NEAR(world.Min.y, -halfDiagonal, 1e-5f);
+    EXPECT_NEAR(world.Max.y, halfDiagonal, 1e-5f);
+    EXPECT_NEAR(world.Min.z, 0.0f, 1e-5f);
+    EXPECT_NEAR(world.Max.z, 0.0f, 1e-5f);
+}
+
+TEST(FrustumCullerTest, PlanesAreNormalized)
+{
+    for (auto& plane : OrthographicPlanes())
+    {
+        EXPECT_NEAR(glm::length(glm::vec3(plane)), 1.0f, 1e-5f);
+    }
+}
+
+TEST(FrustumCullerTest, OrthographicCamera)
+{
+    auto planes = OrthographicPlanes();
+    FrustumCuller culler(planes);
+    EXPECT_TRUE(culler.IsVisible(Box({0.0f, 0.0f, 1.0f}, {1.0f, 1.0f, 0.0f})));
+    EXPECT_FALSE(culler.IsVisible(Box({50.0f, 0.0f, 1.0f}, {1.0f, 1.0f, 0.0f})));
+    EXPECT_FALSE(culler.IsVisible(Box({0.0f, -12.0f, 1.0f}, {1.0f, 1.0f, 0.0f})));
+    // Partially visible boxes are not culled
+    EXPECT_TRUE(culler.IsVisible(Box({10.5f, 0.0f, 1.0f}, {1.0f, 1.0f, 0.0f})));
+    // Behind the near plane and beyond the far plane
+    EXPECT_FALSE(culler.IsVisible(Box({0.0f, 0.0f, -5.0f}, {1.0f, 1.0f, 1.0f})));
+    EXPECT_FALSE(culler.IsVisible(Box({0.0f, 0.0f, 150.0f}, {1.0f, 1.0f, 1.0f})));
+    // Unknown bounds are never culled
+    EXPECT_TRUE(culler.IsVisible(Math::AABB{}));
+}
+
+TEST(FrustumCullerTest, PerspectiveCamera)
+{
+    glm::mat4 projection = glm::perspective(glm::radians(90.0f), 1.0f, 0.1f, 100.0f);
+    FrustumCuller culler(GetFrustumPlanes(projection));
+    EXPECT_TRUE(culler.IsVisible(Box({0.0f, 0.0f, 10.0f}, {1.0f, 1.0f, 1.0f})));
+    // 90 degrees field of view: at distance 10 the frustum is 20 units wide
+    EXPECT_TRUE(culler.IsVisible(Box({9.0f, 0.0f, 10.0f}, {0.5f, 0.5f, 0.5f})));
+    EXPECT_FALSE(culler.IsVisible(Box({15.0f, 0.0f, 10.0f}, {0.5f, 0.5f, 0.5f})));
+    EXPECT_FALSE(culler.IsVisible(Box({0.0f, 0.0f, -10.0f}, {1.0f, 1.0f, 1.0f})));
+    EXPECT_FALSE(culler.IsVisible(Box({0.0f, 0.0f, 200.0f}, {1.0f, 1.0f, 1.0f})));
+}
+
+TEST(FrustumCullerTest, BatchMatchesSingleTests)
+{
+    FrustumCuller culler(OrthographicPlanes());
+    std::mt19937 random(42);
+    std::uniform_real_distribution<float> position(-40.0f, 40.0f);
+    std::uniform_real_distribution<float> size(0.0f, 5.0f);
+    BoundsBatch batch;
+    std::vector<Math::AABB> boxes;
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        auto box = Box({position(random), position(random), position(random) + 40.0f},
+                       {size(random), size(random), size(random)});
+        boxes.push_back(box);
+        EXPECT_EQ(batch.Add(box), i);
+    }
+    // Unknown bounds in the middle of a batch
+    boxes.emplace_back();
+    batch.Add(boxes.back());
+
+    std::vector<uint8_t> visibility;
+    size_t visible = culler.Cull(batch, visibility);
+    ASSERT_EQ(visibility.size(), boxes.size());
+    size_t expectedVisible = 0;
+    for (size_t i = 0; i < boxes.size(); ++i)
+    {
+        const bool expected = culler.IsVisible(boxes[i]);
+        EXPECT_EQ(visibility[i] != 0, expected) << "Box " << i;
+        expectedVisible += expected;
+    }
+    EXPECT_EQ(visible, expectedVisible);
+    EXPECT_GT(visible, 0);
+    EXPECT_LT(visible, boxes.size());
+    EXPECT_EQ(visibility.back(), 1);
+
+    batch.Clear();
+    EXPECT_TRUE(batch.Empty());
+    EXPECT_EQ(culler.Cull(batch, visibility), 0);
+    EXPECT_TRUE(visibility.empty());
+}
+
+TEST(FrustumCullingTest, ViewDepthGrowsWithDistance)
+{
+    for (const glm::mat4& viewProj : {glm::ortho(-10.0f, 10.0f, -10.0f, 10.0f, 0.1f, 100.0f),
+                                      glm::perspective(glm::radians(60.0f), 1.0f, 0.1f, 100.0f)})
+    {
+        float previous = GetViewDepth(viewProj, Box({1.0f, -1.0f, 0.5f}, glm::vec3(0.25f)));
+        for (float z : {1.0f, 5.0f, 20.0f, 99.0f, 150.0f})
+        {
+            const float depth = GetViewDepth(viewProj, Box({1.0f, -1.0f, z}, glm::vec3(0.25f)));
+            EXPECT_GT(depth, previous) << "z = " << z;
+            previous = depth;
+        }
+    }
+}
+
+TEST(FrustumCullingTest, ScreenCoverage)
+{
+    const glm::mat4 viewProj = glm::ortho(-10.0f, 10.0f, -10.0f, 10.0f, 0.1f, 100.0f);
+    EXPECT_FLOAT_EQ(GetScreenCoverage(viewProj, Box({0.0f, 0.0f, 50.0f}, {10.0f, 10.0f, 1.0f})), 1.0f);
+    EXPECT_FLOAT_EQ(GetScreenCoverage(viewProj, Box({0.0f, 0.0f, 50.0f}, {50.0f, 50.0f, 1.0f})), 1.0f);
+    EXPECT_FLOAT_EQ(GetScreenCoverage(viewProj, Box({5.0f, 0.0f, 50.0f}, {5.0f, 10.0f, 0.0f})), 0.5f);
+    EXPECT_FLOAT_EQ(GetScreenCoverage(viewProj, Box({0.0f, 0.0f, 50.0f}, {1.0f, 1.0f, 0.0f})), 0.01f);
+    EXPECT_FLOAT_EQ(GetScreenCoverage(viewProj, Box({30.0f, 0.0f, 50.0f}, {1.0f, 1.0f, 0.0f})), 0.0f);
+    EXPECT_FLOAT_EQ(GetScreenCoverage(viewProj, Math::AABB{}), 0.0f);
+
+    // Box around the camera of a perspective projection can't be projected
+    const glm::mat4 perspective = glm::perspective(glm::radians(60.0f), 1.0f, 0.1f, 100.0f);
+    EXPECT_FLOAT_EQ(GetScreenCoverage(perspective, Box({0.0f, 0.0f, 0.0f}, glm::vec3(1.0f))), 1.0f);
+}
+
+TEST(FrustumCullingTest, ScreenSize)
+{
+    const glm::mat4 viewProj = glm::ortho(-10.0f, 10.0f, -10.0f, 10.0f, 0.1f, 100.0f);
+    EXPECT_FLOAT_EQ(GetScreenSize(viewProj, Box({0.0f, 0.0f, 50.0f}, {10.0f, 10.0f, 1.0f})), 1.0f);
+    EXPECT_FLOAT_EQ(GetScreenSize(viewProj, Box({0.0f, 0.0f, 50.0f}, {1.0f, 2.0f, 0.0f})), 0.2f);
+    // Not clipped to the screen
+    EXPECT_FLOAT_EQ(GetScreenSize(viewProj, Box({30.0f, 0.0f, 50.0f}, {1.0f, 1.0f, 0.0f})), 0.1f);
+    EXPECT_FLOAT_EQ(GetScreenSize(viewProj, Box({0.0f, 0.0f, 50.0f}, {50.0f, 1.0f, 0.0f})), 5.0f);
+    EXPECT_FLOAT_EQ(GetScreenSize(viewProj, Math::AABB{}), 1.0f);
+
+    // Size of a box shrinks with the distance in a perspective projection
+    const glm::mat4 perspective = glm::perspective(glm::radians(60.0f), 1.0f, 0.1f, 100.0f);
+    const float nearSize = GetScreenSize(perspective, Box({0.0f, 0.0f, 10.0f}, glm::vec3(1.0f)));
+    const float farSize = GetScreenSize(perspective, Box({0.0f, 0.0f, 40.0f}, glm::vec3(1.0f)));
+    EXPECT_GT(nearSize, farSize * 3.0f);
+    EXPECT_FLOAT_EQ(GetScreenSize(perspective, Box({0.0f, 0.0f, 0.0f}, glm::vec3(1.0f))), 1.0f);
+}
@@ -0,0 +1,92 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#include <Core/Application.h>
+#include <Renderer/FrustumCulling.h>
+#include <Renderer/GPUDrivenMeshes.h>
+#include <Renderer/Renderer.h>
+#include <Renderer/RenderingQueue.h>
+#include <algorithm>
+#include <cstring>
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace BeeEngine;
+
+namespace
+{
+    template <typename T>
+    std::vector<T> Read(StorageBuffer& buffer)
+    {
+        auto data = buffer.ReadData();
+        std::vector<T> result(data.size() / sizeof(T));
+        memcpy(result.data(), data.data(), result.size() * sizeof(T));
+        return result;
+    }
+
+    Math::AABB UnitBoxAt(float x)
+    {
+        return {{x - 0.5f, -0.5f, -0.5f}, {x + 0.5f, 0.5f, 0.5f}};
+    }
+} // namespace
+
+// Runs the culling pass on the device of the test application, e.g. lavapipe
+TEST(GPUDrivenMeshesTest, CullingPassCompactsVisibleInstances)
+{
+    if (!Renderer::SupportsIndirectDrawing())
+    {
+        GTEST_SKIP() << "Renderer API can not draw indirectly";
+    }
+    auto& assets = Application::GetInstance().GetAssetManager();
+    Model& rectangle = assets.GetModel("Renderer2D_Rectangle");
+    Model& circle = assets.GetModel("Renderer2D_Circle");
+    // Sees x and y in [-10, 10] and z = 0 for both handednesses
+    const auto planes = GetFrustumPlanes(glm::ortho(-10.0f, 10.0f, -10.0f, 10.0f, -10.0f, 10.0f));
+
+    GPUDrivenMeshes meshes;
+    auto add = [&](Model& model, float x, int32_t entityID, const Math::AABB& bounds)
+    { meshes.Add(model, {}, glm::translate(glm::mat4(1.0f), {x, 0.0f, 0.0f}), entityID, bounds); };
+    add(rectangle, 0.0f, 1, UnitBoxAt(0.0f));
+    add(rectangle, 100.0f, 2, UnitBoxAt(100.0f));
+    add(circle, -5.0f, 3, UnitBoxAt(-5.0f));
+    add(rectangle, 5.0f, 4, UnitBoxAt(5.0f));
+    add(circle, -100.0f, 5, UnitBoxAt(-100.0f));
+    // Unknown bounds are never culled
+    add(circle, -100.0f, 6, {});
+    EXPECT_EQ(meshes.GetDrawCount(), 2);
+    EXPECT_EQ(meshes.GetInstanceCount(), 6);
+
+    const size_t dispatches = Internal::RenderingQueue::GetGlobalStatistics().ComputeDispatchCount;
+    meshes.Cull(planes);
+    EXPECT_EQ(Internal::RenderingQueue::GetGlobalStatistics().ComputeDispatchCount, dispatches + 1);
+
+    // Both models have a mesh without surfaces, so every draw has one command
+    auto commands = Read<IndirectDrawCommand>(meshes.GetCommandBuffer());
+    ASSERT_GE(commands.size(), 2);
+    EXPECT_EQ(commands[0].IndexCount, rectangle.GetIndexCount());
+    EXPECT_EQ(commands[0].FirstInstance, 0);
+    EXPECT_EQ(commands[0].InstanceCount, 2);
+    EXPECT_EQ(commands[1].IndexCount, circle.GetIndexCount());
+    EXPECT_EQ(commands[1].FirstInstance, 3);
+    EXPECT_EQ(commands[1].InstanceCount, 2);
+
+    // Order of instances inside of a draw depends on the order of the atomic additions
+    auto visible = Read<GPUDrivenMeshes::VisibleInstance>(meshes.GetVisibleInstanceBuffer());
+    auto entitiesOf = [&](const IndirectDrawCommand& command)
+    {
+        std::vector<int32_t> entities;
+        for (uint32_t i = command.FirstInstance; i < command.FirstInstance + command.InstanceCount; ++i)
+        {
+            entities.push_back(visible[i].EntityID);
+            const float expectedX = entities.back() == 4 ? 5.0f : entities.back() == 3 ? -5.0f : 0.0f;
+            EXPECT_FLOAT_EQ(visible[i].Model[3][0], entities.back() == 6 ? -100.0f : expectedX);
+        }
+        std::ranges::sort(entities);
+        return entities;
+    };
+    EXPECT_EQ(entitiesOf(commands[0]), (std::vector<int32_t>{1, 4}));
+    EXPECT_EQ(entitiesOf(commands[1]), (std::vector<int32_t>{3, 6}));
+}
@@ -0,0 +1,167 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#include <JobSystem/JobScheduler.h>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <gtest/gtest.h>
+#include <new>
+#include <thread>
+
+// Counts heap allocations of the whole test executable, while counting is enabled.
+// Only allocations of the job system should happen inside of the measured sections.
+// Built as BeeEngine_JobAllocationTests, so the replaced operator new does not affect other tests
+namespace
+{
+    std::atomic<bool> g_CountAllocations = false;
+    std::atomic<uint64_t> g_Allocations = 0;
+
+    void* CountedAllocate(std::size_t size, std::size_t alignment)
+    {
+        if (g_CountAllocations.load(std::memory_order_relaxed))
+        {
+            g_Allocations.fetch_add(1, std::memory_order_relaxed);
+        }
+        if (size == 0)
+        {
+            size = 1;
+        }
+        void* ptr = alignment <= alignof(std::max_align_t)
+                        ? std::malloc(size)
+                        : std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+        if (!ptr)
+        {
+            throw std::bad_alloc();
+        }
+        return ptr;
+    }
+
+    class AllocationCounter
+    {
+    public:
+        AllocationCounter()
+        {
+            g_Allocations.store(0, std::memory_order_relaxed);
+            g_CountAllocations.store(true, std::memory_order_seq_cst);
+        }
+        ~AllocationCounter() { Stop(); }
+        uint64_t Stop()
+        {
+            g_CountAllocations.store(false, std::memory_order_seq_cst);
+            return g_Allocations.load(std::memory_order_relaxed);
+        }
+    };
+} // namespace
+
+void* operator new(std::size_t size)
+{
+    return CountedAllocate(size, alignof(std::max_align_t));
+}
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    return CountedAllocate(size, static_cast<std::size_t>(alignment));
+}
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+void operator delete(void* ptr, std::align_val_t) noexcept
+{
+    std::free(ptr);
+}
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept
+{
+    std::free(ptr);
+}
+
+TEST(JobAllocationTest, SmallJobsAreStoredInline)
+{
+    int a = 0, b = 0;
+    auto job = BeeEngine::Jobs::CreateJob([&a, &b](int value) { a = b = value; }, 5);
+    auto bigJob = BeeEngine::Jobs::CreateJob([data = std::array<char, 512>{}]() { (void)data; });
+    auto call = [job = std::move(job)]() mutable { job.Call(); };
+    auto bigCall = [job = std::move(bigJob)]() mutable { job.Call(); };
+    EXPECT_TRUE(BeeEngine::Internal::JobWrapper::FitsInline<decltype(call)>());
+    EXPECT_FALSE(BeeEngine::Internal::JobWrapper::FitsInline<decltype(bigCall)>());
+}
+
+TEST(JobAllocationTest, SchedulingDoesNotAllocateInSteadyState)
+{
+    constexpr uint32_t numberOfJobs = 256;
+    BeeEngine::Jobs::Counter rootCounter;
+    std::atomic<uint32_t> executed = 0;
+    uint64_t allocations = 0;
+    BeeEngine::Jobs::Schedule(BeeEngine::Jobs::CreateJob(rootCounter,
+                                                         [&executed, &allocations]()
+                                                         {
+                                                             auto scheduleJobs = [&executed](uint32_t count)
+                                                             {
+                                                                 BeeEngine::Jobs::Counter counter;
+                                                                 for (uint32_t i = 0; i < count; ++i)
+                                                                 {
+                                                                     BeeEngine::Jobs::Schedule(
+                                                                         BeeEngine::Jobs::CreateJob(
+                                                                             counter, [&executed]() { ++executed; }));
+                                                                 }
+                                                                 BeeEngine::Jobs::WaitForJobsToComplete(counter);
+                                                             };
+                                                             // Fills fiber and stack pools. Twice as many jobs,
+                                                             // because fibers of the previous batch may still be
+                                                             // returning to the pool
+                                                             scheduleJobs(2 * numberOfJobs);
+                                                             AllocationCounter counter;
+                                                             scheduleJobs(numberOfJobs);
+                                                             allocations = counter.Stop();
+                                                         }));
+    BeeEngine::Jobs::WaitForJobsToComplete(rootCounter);
+    EXPECT_EQ(executed.load(), 3 * numberOfJobs);
+    EXPECT_EQ(allocations, 0);
+}
+
+TEST(JobAllocationTest, FireAndForgetJobsWithBigCapturesReuseArena)
+{
+    using namespace std::chrono_literals;
+    constexpr uint32_t numberOfJobs = 64;
+    BeeEngine::Jobs::Counter rootCounter;
+    std::atomic<uint32_t> executed = 0;
+    uint64_t allocations = 0;
+    auto before = BeeEngine::Jobs::GetJobArenaStatistics();
+    BeeEngine::Jobs::Schedule(BeeEngine::Jobs::CreateJob(
+        rootCounter,
+        [&executed, &allocations]()
+        {
+            auto scheduleJobs = [&executed](uint32_t count)
+            {
+                const uint32_t target = executed.load() + count;
+                for (uint32_t i = 0; i < count; ++i)
+                {
+                    // Too big for the inline storage of a job
+                    std::array<uint32_t, 128> payload{};
+                    payload[i % payload.size()] = 1;
+                    BeeEngine::Jobs::Schedule(
+                        BeeEngine::Jobs::CreateJob([&executed, payload]() { executed += payload.size() > 0; }));
+                }
+                while (executed.load() < target)
+                {
+                    BeeEngine::Jobs::this_job::SleepFor(1ms);
+                }
+            };
+            scheduleJobs(2 * numberOfJobs);
+            AllocationCounter counter;
+            scheduleJobs(numberOfJobs);
+            allocations = counter.Stop();
+        }));
+    BeeEngine::Jobs::WaitForJobsToComplete(rootCounter);
+    EXPECT_EQ(executed.load(), 3 * numberOfJobs);
+    EXPECT_EQ(allocations, 0);
+    auto after = BeeEngine::Jobs::GetJobArenaStatistics();
+    EXPECT_GE(after.BlockReuses - before.BlockReuses, numberOfJobs);
+    EXPECT_EQ(after.LargeAllocations, before.LargeAllocations);
+}
@@ -0,0 +1,160 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#include <JobSystem/AdaptiveMutex.h>
+#include <JobSystem/InternalJobScheduler.h>
+#include <JobSystem/JobScheduler.h>
+#include <JobSystem/Mutex.h>
+#include <JobSystem/SpinLock.h>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <iostream>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    /**
+     * Temporarily replaces the global job scheduler with one, that has
+     * the requested number of workers
+     */
+    class ScopedJobScheduler
+    {
+    public:
+        explicit ScopedJobScheduler(uint32_t numberOfThreads)
+            : m_Previous(BeeEngine::Internal::Job::s_Instance),
+              m_Scheduler(std::make_unique<BeeEngine::Internal::JobScheduler>(numberOfThreads))
+        {
+            BeeEngine::Internal::Job::s_Instance = m_Scheduler.get();
+        }
+        ~ScopedJobScheduler()
+        {
+            m_Scheduler.reset();
+            BeeEngine::Internal::Job::s_Instance = m_Previous;
+        }
+
+    private:
+        BeeEngine::Internal::JobScheduler* m_Previous;
+        std::unique_ptr<BeeEngine::Internal::JobScheduler> m_Scheduler;
+    };
+
+    double MeasureFanOut(uint32_t numberOfJobs)
+    {
+        BeeEngine::Jobs::Counter rootCounter;
+        std::atomic<uint32_t> executed = 0;
+        auto start = std::chrono::high_resolution_clock::now();
+        BeeEngine::Jobs::Schedule(BeeEngine::Jobs::CreateJob(rootCounter,
+                                                             [&executed, numberOfJobs]()
+                                                             {
+                                                                 BeeEngine::Jobs::Counter counter;
+                                                                 for (uint32_t i = 0; i < numberOfJobs; ++i)
+                                                                 {
+                                                                     BeeEngine::Jobs::Schedule(
+                                                                         BeeEngine::Jobs::CreateJob(
+                                                                             counter, [&executed]() { ++executed; }));
+                                                                 }
+                                                                 BeeEngine::Jobs::WaitForJobsToComplete(counter);
+                                                             }));
+        BeeEngine::Jobs::WaitForJobsToComplete(rootCounter);
+        auto end = std::chrono::high_resolution_clock::now();
+        EXPECT_EQ(executed.load(), numberOfJobs);
+        return std::chrono::duration<double>(end - start).count();
+    }
+
+    // Previous implementation of Jobs::Mutex, kept to compare against
+    class YieldingMutex
+    {
+    public:
+        void lock()
+        {
+            while (flag.test_and_set(std::memory_order_acquire))
+            {
+                BeeEngine::Jobs::this_job::yield();
+            }
+        }
+        void unlock() { flag.clear(std::memory_order_release); }
+
+    private:
+        std::atomic_flag flag = {};
+    };
+
+    uint64_t TotalResumes()
+    {
+        auto statistics = BeeEngine::Jobs::GetJobSystemStatistics();
+        uint64_t resumes = statistics.Helpers.Resumes;
+        for (auto& worker : statistics.Workers)
+        {
+            resumes += worker.Resumes;
+        }
+        return resumes;
+    }
+
+    template <typename MutexType>
+    void MeasureContention(std::string_view name, uint32_t numberOfJobs, uint32_t locksPerJob)
+    {
+        MutexType mutex;
+        uint64_t value = 0;
+        BeeEngine::Jobs::Counter counter;
+        const uint64_t resumesBefore = TotalResumes();
+        auto start = std::chrono::high_resolution_clock::now();
+        for (uint32_t i = 0; i < numberOfJobs; ++i)
+        {
+            BeeEngine::Jobs::Schedule(BeeEngine::Jobs::CreateJob(counter,
+                                                                 [&mutex, &value, locksPerJob]()
+                                                                 {
+                                                                     for (uint32_t j = 0; j < locksPerJob; ++j)
+                                                                     {
+                                                                         std::unique_lock lock(mutex);
+                                                                         // Some work inside of the critical section
+                                                                         for (uint32_t k = 0; k < 64; ++k)
+                                                                         {
+                                                                             value = value * 31 + k;
+                                                                         }
+                                                                     }
+                                                                 }));
+        }
+        BeeEngine::Jobs::WaitForJobsToComplete(counter);
+        auto end = std::chrono::high_resolution_clock::now();
+        const double seconds = std::chrono::duration<double>(end - start).count();
+        const uint64_t locks = static_cast<uint64_t>(numberOfJobs) * locksPerJob;
+        std::cout << "[JobMutexBenchmark] " << name << ": " << locks << " locks in " << seconds * 1000.0 << " ms ("
+                  << static_cast<uint64_t>(locks / seconds) << " locks/s, " << TotalResumes() - resumesBefore
+                  << " fiber resumes)" << std::endl;
+    }
+} // namespace
+
+// Compares contended locks of the job system, run it with --gtest_also_run_disabled_tests
+TEST(JobSchedulerBenchmark, DISABLED_MutexContention)
+{
+    constexpr uint32_t numberOfJobs = 64;
+    constexpr uint32_t locksPerJob = 2000;
+    MeasureContention<BeeEngine::Jobs::Mutex>("Jobs::Mutex (parking)", numberOfJobs, locksPerJob);
+    MeasureContention<YieldingMutex>("Yielding mutex (previous Jobs::Mutex)", numberOfJobs, locksPerJob);
+    MeasureContention<BeeEngine::Jobs::AdaptiveMutex>("Jobs::AdaptiveMutex", numberOfJobs, locksPerJob);
+    MeasureContention<BeeEngine::Jobs::SpinLock>("Jobs::SpinLock", numberOfJobs, locksPerJob);
+}
+
+// Prints jobs per second for growing numbers of workers, run it with --gtest_also_run_disabled_tests
+TEST(JobSchedulerBenchmark, DISABLED_SchedulingThroughputScaling)
+{
+    constexpr uint32_t numberOfJobs = 100000;
+    const uint32_t maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<uint32_t> threadCounts;
+    for (uint32_t threads = 1; threads < maxThreads; threads *= 2)
+    {
+        threadCounts.push_back(threads);
+    }
+    threadCounts.push_back(maxThreads);
+    for (uint32_t threads : threadCounts)
+    {
+        ScopedJobScheduler scheduler(threads);
+        MeasureFanOut(numberOfJobs / 10); // warm up
+        double seconds = MeasureFanOut(numberOfJobs);
+        std::cout << "[JobSchedulerBenchmark] " << threads << " worker(s): " << numberOfJobs << " jobs in "
+                  << seconds * 1000.0 << " ms (" << static_cast<uint64_t>(numberOfJobs / seconds) << " jobs/s)"
+                  << std::endl;
+    }
+}
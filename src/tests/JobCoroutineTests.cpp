@@ -0,0 +1,193 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#include <Core/Coroutines/JobAwaiters.h>
+#include <Core/Coroutines/Task.h>
+#include <JobSystem/JobScheduler.h>
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+using namespace BeeEngine;
+
+namespace
+{
+    Task<bool> IsInJobAfterResumeOnWorker()
+    {
+        if (Jobs::this_job::IsInJob())
+        {
+            co_return false;
+        }
+        co_await Jobs::ResumeOnWorker(Jobs::Priority::High);
+        co_return Jobs::this_job::IsInJob();
+    }
+
+    Task<int> SquareOnWorker(int value)
+    {
+        co_await Jobs::ResumeOnWorker();
+        co_return value * value;
+    }
+
+    Task<int> SumOfSquares(int count)
+    {
+        int sum = 0;
+        for (int i = 1; i <= count; ++i)
+        {
+            sum += co_await SquareOnWorker(i);
+        }
+        co_return sum;
+    }
+
+    Task<int> Throws()
+    {
+        co_await Jobs::ResumeOnWorker();
+        throw std::runtime_error("Task failed");
+    }
+
+    Task<> ThrowsWithoutResult()
+    {
+        co_await Jobs::ResumeOnWorker();
+        throw std::runtime_error("Task failed");
+    }
+
+    Task<bool> CatchesExceptionOfVoidTask()
+    {
+        try
+        {
+            co_await ThrowsWithoutResult();
+        }
+        catch (const std::runtime_error&)
+        {
+            co_return true;
+        }
+        co_return false;
+    }
+} // namespace
+
+TEST(JobCoroutineTest, ResumeOnWorkerContinuesInJob)
+{
+    EXPECT_TRUE(sync_await(IsInJobAfterResumeOnWorker()));
+}
+
+TEST(JobCoroutineTest, AwaitedTasksChainAcrossWorkers)
+{
+    EXPECT_EQ(sync_await(SumOfSquares(10)), 385);
+}
+
+TEST(JobCoroutineTest, AwaitCounterDoesNotBlockThread)
+{
+    std::atomic<uint32_t> finished = 0;
+    // Coroutine lambdas must not capture: the lambda object is destroyed before the task is resumed
+    auto task = [](std::atomic<uint32_t>& finished) -> Task<uint32_t>
+    {
+        Jobs::Counter counter;
+        for (uint32_t i = 0; i < 32; ++i)
+        {
+            Jobs::Schedule(Jobs::CreateJob(counter, [&finished]() { ++finished; }));
+        }
+        co_await counter;
+        co_return finished.load();
+    }(finished);
+    EXPECT_EQ(task.get(), 32);
+}
+
+TEST(JobCoroutineTest, DelayResumesAfterTime)
+{
+    using namespace std::chrono_literals;
+    auto task = []() -> Task<std::chrono::steady_clock::duration>
+    {
+        auto start = std::chrono::steady_clock::now();
+        co_await Jobs::Delay(20ms);
+        co_return std::chrono::steady_clock::now() - start;
+    }();
+    EXPECT_GE(task.get(), 20ms);
+}
+
+TEST(JobCoroutineTest, StartedTaskCanBePolled)
+{
+    using namespace std::chrono_literals;
+    auto task = []() -> Task<int>
+    {
+        co_await Jobs::ResumeOnWorker();
+        co_await Jobs::Delay(5ms);
+        co_return 42;
+    }();
+    EXPECT_FALSE(task.IsReady());
+    task.Start();
+    auto deadline = std::chrono::steady_clock::now() + 5s;
+    while (!task.IsReady() && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(1ms);
+    }
+    ASSERT_TRUE(task.IsReady());
+    EXPECT_EQ(task.get(), 42);
+}
+
+TEST(JobCoroutineTest, AwaitingStartedTaskWaitsForIt)
+{
+    using namespace std::chrono_literals;
+    auto inner = []() -> Task<int>
+    {
+        co_await Jobs::Delay(5ms);
+        co_return 7;
+    }();
+    inner.Start();
+    auto outer = [](Task<int>& task) -> Task<int> { co_return co_await task + 1; }(inner);
+    EXPECT_EQ(outer.get(), 8);
+}
+
+TEST(JobCoroutineTest, WhenAllReturnsResultsInOrder)
+{
+    auto [a, b, c] = sync_await(when_all(SquareOnWorker(2), SquareOnWorker(3), SumOfSquares(3)));
+    EXPECT_EQ(a, 4);
+    EXPECT_EQ(b, 9);
+    EXPECT_EQ(c, 14);
+
+    std::vector<Task<int>> tasks;
+    for (int i = 0; i < 64; ++i)
+    {
+        tasks.push_back(SquareOnWorker(i));
+    }
+    auto results = sync_await(when_all(std::move(tasks)));
+    ASSERT_EQ(results.size(), 64);
+    for (int i = 0; i < 64; ++i)
+    {
+        EXPECT_EQ(results[i], i * i);
+    }
+}
+
+TEST(JobCoroutineTest, WhenAllWaitsForVoidTasks)
+{
+    std::atomic<uint32_t> finished = 0;
+    std::vector<Task<>> tasks;
+    for (uint32_t i = 0; i < 16; ++i)
+    {
+        tasks.push_back(
+            [](std::atomic<uint32_t>& finished) -> Task<>
+            {
+                co_await Jobs::ResumeOnWorker(Jobs::Priority::Low);
+                ++finished;
+            }(finished));
+    }
+    sync_await(when_all(std::move(tasks)));
+    EXPECT_EQ(finished.load(), 16);
+}
+
+TEST(JobCoroutineTest, ExceptionsPropagateToAwaiter)
+{
+    EXPECT_THROW(sync_await(Throws()), std::runtime_error);
+    EXPECT_THROW(sync_await(when_all(SquareOnWorker(2), Throws())), std::runtime_error);
+}
+
+TEST(JobCoroutineTest, VoidTasksRethrowExceptions)
+{
+    auto task = ThrowsWithoutResult();
+    EXPECT_THROW(task.get(), std::runtime_error);
+    EXPECT_THROW(sync_await(ThrowsWithoutResult()), std::runtime_error);
+    EXPECT_TRUE(sync_await(CatchesExceptionOfVoidTask()));
+}
@@ -0,0 +1,117 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#include <JobSystem/JobGraph.h>
+#include <JobSystem/JobScheduler.h>
+#include <JobSystem/SpinLock.h>
+#include <atomic>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <vector>
+
+TEST(JobGraphTest, ChainRunsInOrder)
+{
+    BeeEngine::Jobs::JobGraph graph;
+    std::vector<uint32_t> order;
+    BeeEngine::Jobs::SpinLock lock;
+    std::vector<BeeEngine::Jobs::JobGraph::NodeID> nodes;
+    // Added in reverse, so the order can't come from the order of scheduling
+    for (uint32_t i = 0; i < 5; ++i)
+    {
+        nodes.push_back(graph.AddNode("Stage",
+                                      [i, &order, &lock]()
+                                      {
+                                          std::unique_lock guard(lock);
+                                          order.push_back(4 - i);
+                                      }));
+    }
+    for (uint32_t i = 4; i > 0; --i)
+    {
+        graph.AddDependency(nodes[i], nodes[i - 1]);
+    }
+    EXPECT_FALSE(graph.HasCycle());
+    graph.RunAndWait();
+    EXPECT_EQ(order, (std::vector<uint32_t>{0, 1, 2, 3, 4}));
+    EXPECT_FALSE(graph.IsRunning());
+}
+
+TEST(JobGraphTest, DiamondWaitsForAllInputs)
+{
+    BeeEngine::Jobs::JobGraph graph;
+    std::atomic<uint32_t> middleFinished = 0;
+    std::atomic<bool> rootFinished = false;
+    std::atomic<bool> failed = false;
+    auto root = graph.AddNode("Physics", [&]() { rootFinished = true; });
+    auto sink = graph.AddNode("Submission",
+                              [&]()
+                              {
+                                  if (middleFinished.load() != 16)
+                                  {
+                                      failed = true;
+                                  }
+                              });
+    for (uint32_t i = 0; i < 16; ++i)
+    {
+        auto middle = graph.AddNode("Extraction",
+                                    [&]()
+                                    {
+                                        if (!rootFinished.load())
+                                        {
+                                            failed = true;
+                                        }
+                                        ++middleFinished;
+                                    });
+        graph.AddDependency(root, middle);
+        graph.AddDependency(middle, sink);
+    }
+    graph.RunAndWait();
+    EXPECT_FALSE(failed.load());
+    EXPECT_EQ(middleFinished.load(), 16);
+}
+
+TEST(JobGraphTest, GraphCanBeRunManyTimes)
+{
+    BeeEngine::Jobs::JobGraph graph;
+    std::atomic<uint32_t> executed = 0;
+    auto first = graph.AddNode("First", [&executed]() { ++executed; }, BeeEngine::Jobs::Priority::High);
+    auto second = graph.AddNode("Second", [&executed]() { ++executed; });
+    auto third = graph.AddNode("Third", [&executed]() { ++executed; }, BeeEngine::Jobs::Priority::Low);
+    graph.AddDependency(first, second);
+    graph.AddDependency(first, third);
+    graph.AddDependency(second, third);
+    for (uint32_t frame = 0; frame < 100; ++frame)
+    {
+        BeeEngine::Jobs::Counter counter;
+        graph.Run(counter);
+        BeeEngine::Jobs::WaitForJobsToComplete(counter);
+    }
+    EXPECT_EQ(executed.load(), 300);
+}
+
+TEST(JobGraphTest, RunsInsideJob)
+{
+    BeeEngine::Jobs::JobGraph graph;
+    std::atomic<uint32_t> executed = 0;
+    auto first = graph.AddNode("First", [&executed]() { ++executed; });
+    auto second = graph.AddNode("Second", [&executed]() { ++executed; });
+    graph.AddDependency(first, second);
+    BeeEngine::Jobs::Counter counter;
+    BeeEngine::Jobs::Schedule(BeeEngine::Jobs::CreateJob(counter, [&graph]() { graph.RunAndWait(); }));
+    BeeEngine::Jobs::WaitForJobsToComplete(counter);
+    EXPECT_EQ(executed.load(), 2);
+}
+
+TEST(JobGraphTest, DetectsCycles)
+{
+    BeeEngine::Jobs::JobGraph graph;
+    auto a = graph.AddNode("A", []() {});
+    auto b = graph.AddNode("B", []() {});
+    auto c = graph.AddNode("C", []() {});
+    graph.AddDependency(a, b);
+    graph.AddDependency(b, c);
+    EXPECT_FALSE(graph.HasCycle());
+    graph.AddDependency(c, a);
+    EXPECT_TRUE(graph.HasCycle());
+    EXPECT_EQ(graph.GetNodeName(b), "B");
+}
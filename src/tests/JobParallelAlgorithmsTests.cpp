@@ -0,0 +1,113 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#include <JobSystem/JobScheduler.h>
+#include <JobSystem/ParallelAlgorithms.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+TEST(JobParallelForTest, EveryIndexIsVisitedOnce)
+{
+    for (size_t grainSize : {0, 1, 7, 64, 100000})
+    {
+        std::vector<std::atomic<uint32_t>> visits(10000);
+        BeeEngine::Jobs::ParallelFor(
+            size_t{0}, visits.size(), [&visits](size_t i) { ++visits[i]; }, {.GrainSize = grainSize});
+        EXPECT_TRUE(std::ranges::all_of(visits, [](auto& visit) { return visit.load() == 1; }))
+            << "Grain size " << grainSize;
+    }
+}
+
+TEST(JobParallelForTest, PiecesRespectGrainSize)
+{
+    constexpr size_t grainSize = 100;
+    std::atomic<size_t> total = 0;
+    std::atomic<bool> tooBig = false;
+    BeeEngine::Jobs::ParallelFor(
+        size_t{0},
+        size_t{12345},
+        [&](size_t begin, size_t end)
+        {
+            if (end - begin > grainSize)
+            {
+                tooBig = true;
+            }
+            total += end - begin;
+        },
+        {.GrainSize = grainSize});
+    EXPECT_FALSE(tooBig.load());
+    EXPECT_EQ(total.load(), 12345);
+}
+
+TEST(JobParallelForTest, RangeOverloadWorksInsideJob)
+{
+    std::vector<uint32_t> values(5000);
+    BeeEngine::Jobs::Counter counter;
+    BeeEngine::Jobs::Schedule(BeeEngine::Jobs::CreateJob(
+        counter,
+        [&values]()
+        {
+            BeeEngine::Jobs::ParallelFor(
+                values, [](uint32_t& value, size_t index) { value = static_cast<uint32_t>(index * 2); });
+        }));
+    BeeEngine::Jobs::WaitForJobsToComplete(counter);
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        ASSERT_EQ(values[i], i * 2);
+    }
+}
+
+TEST(JobParallelReduceTest, SumMatchesSerial)
+{
+    std::vector<uint64_t> values(100000);
+    std::iota(values.begin(), values.end(), 1);
+    const uint64_t expected = std::accumulate(values.begin(), values.end(), uint64_t{0});
+    EXPECT_EQ(BeeEngine::Jobs::ParallelReduce(values, uint64_t{0}), expected);
+    EXPECT_EQ(BeeEngine::Jobs::ParallelReduce(values, uint64_t{0}, std::plus<>{}, {.GrainSize = 3}), expected);
+    const uint64_t maximum = BeeEngine::Jobs::ParallelReduce(
+        size_t{0},
+        values.size(),
+        uint64_t{0},
+        [&values](size_t begin, size_t end) { return *std::max_element(values.begin() + begin, values.begin() + end); },
+        [](uint64_t a, uint64_t b) { return std::max(a, b); });
+    EXPECT_EQ(maximum, values.size());
+    EXPECT_EQ(BeeEngine::Jobs::ParallelReduce(std::vector<uint64_t>{}, uint64_t{42}), 42);
+}
+
+TEST(JobParallelSortTest, SortsLikeStdSort)
+{
+    std::mt19937 random(12345);
+    for (size_t size : {0, 1, 100, 5000, 100000})
+    {
+        std::vector<int32_t> values(size);
+        for (auto& value : values)
+        {
+            value = static_cast<int32_t>(random() % 1000);
+        }
+        auto expected = values;
+        std::sort(expected.begin(), expected.end());
+        BeeEngine::Jobs::ParallelSort(values, std::ranges::less{}, {.GrainSize = 256});
+        EXPECT_EQ(values, expected) << "Size " << size;
+    }
+}
+
+TEST(JobParallelSortTest, SortsStringsWithCustomComparator)
+{
+    std::mt19937 random(42);
+    std::vector<std::string> values(20000);
+    for (auto& value : values)
+    {
+        value = std::to_string(random());
+    }
+    auto expected = values;
+    std::sort(expected.begin(), expected.end(), std::greater<>{});
+    BeeEngine::Jobs::ParallelSort(values, std::greater<>{});
+    EXPECT_EQ(values, expected);
+}
@@ -0,0 +1,204 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#include <JobSystem/JobScheduler.h>
+#include <JobSystem/Mutex.h>
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+TEST(JobMutexTest, ProtectsCounterUnderContention)
+{
+    BeeEngine::Jobs::Mutex mutex;
+    BeeEngine::Jobs::Counter counter;
+    uint64_t value = 0;
+    for (uint32_t i = 0; i < 64; ++i)
+    {
+        BeeEngine::Jobs::Schedule(BeeEngine::Jobs::CreateJob(counter,
+                                                             [&mutex, &value]()
+                                                             {
+                                                                 for (uint32_t j = 0; j < 1000; ++j)
+                                                                 {
+                                                                     std::unique_lock lock(mutex);
+                                                                     ++value;
+                                                                 }
+                                                             }));
+    }
+    // The main thread isn't a job, it must block instead of parking
+    for (uint32_t j = 0; j < 1000; ++j)
+    {
+        std::unique_lock lock(mutex);
+        ++value;
+    }
+    BeeEngine::Jobs::WaitForJobsToComplete(counter);
+    EXPECT_EQ(value, 65 * 1000);
+}
+
+TEST(JobMutexTest, WaitingJobsAreParked)
+{
+    using namespace std::chrono_literals;
+    BeeEngine::Jobs::Mutex mutex;
+    BeeEngine::Jobs::Counter counter;
+    std::atomic<uint32_t> entered = 0;
+    mutex.lock();
+    for (uint32_t i = 0; i < 8; ++i)
+    {
+        BeeEngine::Jobs::Schedule(BeeEngine::Jobs::CreateJob(counter,
+                                                             [&mutex, &entered]()
+                                                             {
+                                                                 std::unique_lock lock(mutex);
+                                                                 ++entered;
+                                                             }));
+    }
+    std::this_thread::sleep_for(20ms);
+    EXPECT_EQ(entered.load(), 0);
+    EXPECT_EQ(BeeEngine::Jobs::GetJobSystemStatistics().WaitingJobs, 8);
+    EXPECT_FALSE(mutex.try_lock());
+    mutex.unlock();
+    BeeEngine::Jobs::WaitForJobsToComplete(counter);
+    EXPECT_EQ(entered.load(), 8);
+    EXPECT_TRUE(mutex.try_lock());
+    mutex.unlock();
+}
+
+TEST(JobRWLockTest, WritersAreExclusiveAndReadersShare)
+{
+    BeeEngine::Jobs::RWLock rwLock;
+    BeeEngine::Jobs::Counter counter;
+    std::atomic<int32_t> readers = 0;
+    std::atomic<int32_t> writers = 0;
+    std::atomic<int32_t> maxReaders = 0;
+    std::atomic<bool> failed = false;
+    for (uint32_t i = 0; i < 64; ++i)
+    {
+        BeeEngine::Jobs::Schedule(BeeEngine::Jobs::CreateJob(counter,
+                                                             [&, i]()
+                                                             {
+                                                                 for (uint32_t j = 0; j < 200; ++j)
+                                                                 {
+                                                                     if ((i + j) % 4 == 0)
+                                                                     {
+                                                                         std::unique_lock lock(rwLock);
+                                                                         if (++writers != 1 || readers.load() != 0)
+                                                                         {
+                                                                             failed = true;
+                                                                         }
+                                                                         --writers;
+                                                                     }
+                                                                     else
+                                                                     {
+                                                                         std::shared_lock lock(rwLock);
+                                                                         auto current = ++readers;
+                                                                         if (writers.load() != 0)
+                                                                         {
+                                                                             failed = true;
+                                                                         }
+                                                                         int32_t previous = maxReaders.load();
+                                                                         while (previous < current &&
+                                                                                !maxReaders.compare_exchange_weak(
+                                                                                    previous, current))
+                                                                         {
+                                                                         }
+                                                                         BeeEngine::Jobs::this_job::yield();
+                                                                         --readers;
+                                                                     }
+                                                                 }
+                                                             }));
+    }
+    BeeEngine::Jobs::WaitForJobsToComplete(counter);
+    EXPECT_FALSE(failed.load());
+    EXPECT_GT(maxReaders.load(), 1);
+}
+
+TEST(JobSemaphoreTest, LimitsConcurrency)
+{
+    BeeEngine::Jobs::Semaphore semaphore(3);
+    BeeEngine::Jobs::Counter counter;
+    std::atomic<int32_t> inside = 0;
+    std::atomic<int32_t> maxInside = 0;
+    for (uint32_t i = 0; i < 64; ++i)
+    {
+        BeeEngine::Jobs::Schedule(BeeEngine::Jobs::CreateJob(counter,
+                                                             [&]()
+                                                             {
+                                                                 semaphore.acquire();
+                                                                 auto current = ++inside;
+                                                                 int32_t previous = maxInside.load();
+                                                                 while (previous < current &&
+                                                                        !maxInside.compare_exchange_weak(previous,
+                                                                                                         current))
+                                                                 {
+                                                                 }
+                                                                 BeeEngine::Jobs::this_job::yield();
+                                                                 --inside;
+                                                                 semaphore.release();
+                                                             }));
+    }
+    BeeEngine::Jobs::WaitForJobsToComplete(counter);
+    EXPECT_LE(maxInside.load(), 3);
+    EXPECT_GE(maxInside.load(), 1);
+    EXPECT_TRUE(semaphore.try_acquire());
+    EXPECT_TRUE(semaphore.try_acquire());
+    EXPECT_TRUE(semaphore.try_acquire());
+    EXPECT_FALSE(semaphore.try_acquire());
+}
+
+TEST(JobEventTest, ManualResetReleasesEveryWaiter)
+{
+    BeeEngine::Jobs::Event event(BeeEngine::Jobs::Event::ResetMode::Manual);
+    BeeEngine::Jobs::Counter counter;
+    std::atomic<uint32_t> released = 0;
+    for (uint32_t i = 0; i < 32; ++i)
+    {
+        BeeEngine::Jobs::Schedule(BeeEngine::Jobs::CreateJob(counter,
+                                                             [&]()
+                                                             {
+                                                                 event.Wait();
+                                                                 ++released;
+                                                             }));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_EQ(released.load(), 0);
+    event.Set();
+    BeeEngine::Jobs::WaitForJobsToComplete(counter);
+    EXPECT_EQ(released.load(), 32);
+    EXPECT_TRUE(event.IsSet());
+    event.Reset();
+    EXPECT_FALSE(event.IsSet());
+}
+
+TEST(JobEventTest, AutoResetReleasesOneWaiterPerSet)
+{
+    using namespace std::chrono_literals;
+    BeeEngine::Jobs::Event event(BeeEngine::Jobs::Event::ResetMode::Auto);
+    BeeEngine::Jobs::Counter counter;
+    std::atomic<uint32_t> released = 0;
+    for (uint32_t i = 0; i < 4; ++i)
+    {
+        BeeEngine::Jobs::Schedule(BeeEngine::Jobs::CreateJob(counter,
+                                                             [&]()
+                                                             {
+                                                                 event.Wait();
+                                                                 ++released;
+                                                             }));
+    }
+    std::this_thread::sleep_for(10ms);
+    for (uint32_t i = 1; i <= 4; ++i)
+    {
+        event.Set();
+        auto deadline = std::chrono::steady_clock::now() + 1s;
+        while (released.load() < i && std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::yield();
+        }
+        std::this_thread::sleep_for(5ms);
+        EXPECT_EQ(released.load(), i);
+    }
+    BeeEngine::Jobs::WaitForJobsToComplete(counter);
+    EXPECT_FALSE(event.IsSet());
+}
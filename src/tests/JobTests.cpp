@@ -1,6 +1,7 @@
 #include <JobSystem/JobScheduler.h> // Include the Jobs module
 #include <JobSystem/SpinLock.h>
 #include <gtest/gtest.h>
+#include <thread>
 
 TEST(JobCompletionTest, WaitForJobsToComplete)
 {
@@ -95,4 +96,214 @@ TEST_F(JobSleepForTest, SleepForNegativeTime)
     BeeEngine::Jobs::WaitForJobsToComplete(counter);
 
     EXPECT_TRUE(counter.IsZero());
-}
\ No newline at end of file
+}
+TEST(JobWorkStealingTest, ManyJobsFromMainThread)
+{
+    BeeEngine::Jobs::Counter counter;
+    std::atomic<uint32_t> executed = 0;
+    constexpr uint32_t numberOfJobs = 10000;
+    for (uint32_t i = 0; i < numberOfJobs; ++i)
+    {
+        BeeEngine::Jobs::Schedule(BeeEngine::Jobs::CreateJob(counter, [&executed]() { ++executed; }));
+    }
+    BeeEngine::Jobs::WaitForJobsToComplete(counter);
+    EXPECT_EQ(executed.load(), numberOfJobs);
+}
+TEST(JobWorkStealingTest, ScheduleAllRunsEveryJob)
+{
+    BeeEngine::Jobs::Counter counter;
+    std::atomic<uint32_t> executed = 0;
+    auto increment = [&executed](uint32_t value) { executed += value; };
+    using Job_T = decltype(BeeEngine::Jobs::CreateJob(counter, increment, 0u));
+    std::vector<Job_T> jobs;
+    for (uint32_t i = 1; i <= 100; ++i)
+    {
+        jobs.push_back(BeeEngine::Jobs::CreateJob(counter, increment, uint32_t{i}));
+    }
+    BeeEngine::Jobs::ScheduleAll(std::span<Job_T>{jobs});
+    BeeEngine::Jobs::WaitForJobsToComplete(counter);
+    EXPECT_EQ(executed.load(), 5050);
+}
+
+TEST(JobWorkStealingTest, NestedJobsAreStolen)
+{
+    BeeEngine::Jobs::Counter rootCounter;
+    std::atomic<uint32_t> executed = 0;
+    constexpr uint32_t numberOfJobs = 10000;
+    BeeEngine::Jobs::Schedule(BeeEngine::Jobs::CreateJob(rootCounter,
+                                                         [&executed]()
+                                                         {
+                                                             BeeEngine::Jobs::Counter counter;
+                                                             for (uint32_t i = 0; i < numberOfJobs; ++i)
+                                                             {
+                                                                 BeeEngine::Jobs::Schedule(BeeEngine::Jobs::CreateJob(
+                                                                     counter, [&executed]() { ++executed; }));
+                                                             }
+                                                             BeeEngine::Jobs::WaitForJobsToComplete(counter);
+                                                         }));
+    BeeEngine::Jobs::WaitForJobsToComplete(rootCounter);
+    EXPECT_EQ(executed.load(), numberOfJobs);
+}
+
+TEST(JobWorkStealingTest, YieldWithCounterCompletes)
+{
+    BeeEngine::Jobs::Counter counter;
+    std::atomic<uint32_t> executed = 0;
+    for (uint32_t i = 0; i < 64; ++i)
+    {
+        BeeEngine::Jobs::Schedule(BeeEngine::Jobs::CreateJob(counter,
+                                                             [&executed]()
+                                                             {
+                                                                 BeeEngine::Jobs::this_job::yield();
+                                                                 BeeEngine::Jobs::this_job::yield();
+                                                                 ++executed;
+                                                             }));
+    }
+    BeeEngine::Jobs::WaitForJobsToComplete(counter);
+    EXPECT_EQ(executed.load(), 64);
+}
+
+TEST(JobFiberPoolTest, StacksAreReused)
+{
+    auto before = BeeEngine::Jobs::GetFiberPoolStatistics();
+    for (uint32_t iteration = 0; iteration < 10; ++iteration)
+    {
+        BeeEngine::Jobs::Counter counter;
+        for (uint32_t i = 0; i < 100; ++i)
+        {
+            BeeEngine::Jobs::Schedule(BeeEngine::Jobs::CreateJob(counter, []() {}));
+        }
+        BeeEngine::Jobs::WaitForJobsToComplete(counter);
+    }
+    auto after = BeeEngine::Jobs::GetFiberPoolStatistics();
+    const uint64_t newStacks = after.StackAllocations - before.StackAllocations;
+    const uint64_t reusedStacks = after.StackReuses - before.StackReuses;
+    EXPECT_EQ(newStacks + reusedStacks, 1000);
+    // At most one stack per concurrently running job has to be allocated
+    EXPECT_LE(newStacks, 100);
+    EXPECT_GT(after.StackHitRate(), 0.0);
+    EXPECT_GT(after.FiberReuses, before.FiberReuses);
+}
+
+TEST(JobWaitingTest, ManyFibersWaitOnOneCounter)
+{
+    using namespace std::chrono_literals;
+    BeeEngine::Jobs::Counter gate;
+    BeeEngine::Jobs::Counter waitersCounter;
+    std::atomic<uint32_t> released = 0;
+    BeeEngine::Jobs::Schedule(BeeEngine::Jobs::CreateJob(gate, []() { BeeEngine::Jobs::this_job::SleepFor(20ms); }));
+    for (uint32_t i = 0; i < 200; ++i)
+    {
+        BeeEngine::Jobs::Schedule(BeeEngine::Jobs::CreateJob(waitersCounter,
+                                                             [&gate, &released]()
+                                                             {
+                                                                 BeeEngine::Jobs::WaitForJobsToComplete(gate);
+                                                                 EXPECT_TRUE(gate.IsZero());
+                                                                 ++released;
+                                                             }));
+    }
+    BeeEngine::Jobs::WaitForJobsToComplete(waitersCounter);
+    EXPECT_EQ(released.load(), 200);
+}
+
+TEST(JobWaitingTest, SleepingFibersWakeUpInDeadlineOrder)
+{
+    using namespace std::chrono_literals;
+    BeeEngine::Jobs::Counter counter;
+    std::vector<uint32_t> order;
+    BeeEngine::Jobs::SpinLock lock;
+    for (uint32_t i = 0; i < 5; ++i)
+    {
+        BeeEngine::Jobs::Schedule(BeeEngine::Jobs::CreateJob(counter,
+                                                             [i, &order, &lock]()
+                                                             {
+                                                                 BeeEngine::Jobs::this_job::SleepFor((5 - i) * 30ms);
+                                                                 std::unique_lock guard(lock);
+                                                                 order.push_back(i);
+                                                             }));
+    }
+    BeeEngine::Jobs::WaitForJobsToComplete(counter);
+    EXPECT_EQ(order, (std::vector<uint32_t>{4, 3, 2, 1, 0}));
+}
+
+TEST(JobWaitingTest, BlockingWaitDoesNotPoll)
+{
+    // Used to poll every 10 ms outside of jobs
+    constexpr uint32_t iterations = 20;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (uint32_t i = 0; i < iterations; ++i)
+    {
+        BeeEngine::Jobs::Counter counter;
+        BeeEngine::Jobs::Schedule(BeeEngine::Jobs::CreateJob(counter, []() {}));
+        BeeEngine::Jobs::WaitForJobsToComplete(counter);
+        EXPECT_TRUE(counter.IsZero());
+    }
+    auto elapsed = std::chrono::high_resolution_clock::now() - start;
+    EXPECT_LT(elapsed, std::chrono::milliseconds(10 * iterations / 2));
+}
+
+TEST(JobWaitingTest, WaitAndHelpRunsJobsOnCallingThread)
+{
+    BeeEngine::Jobs::Counter counter;
+    std::atomic<uint32_t> executed = 0;
+    for (uint32_t i = 0; i < 1000; ++i)
+    {
+        BeeEngine::Jobs::Schedule(BeeEngine::Jobs::CreateJob<BeeEngine::Jobs::Priority::High,
+                                                             BeeEngine::Jobs::DefaultStackSize>(
+            counter, [&executed]() { ++executed; }));
+    }
+    BeeEngine::Jobs::WaitForJobsToCompleteAndHelp(counter);
+    EXPECT_EQ(executed.load(), 1000);
+    EXPECT_FALSE(BeeEngine::Jobs::this_job::IsInJob());
+}
+
+TEST(JobStatisticsTest, CountersTrackCompletedJobs)
+{
+    auto before = BeeEngine::Jobs::GetJobSystemStatistics();
+    ASSERT_EQ(before.Workers.size(), BeeEngine::Jobs::GetNumberOfWorkers());
+    BeeEngine::Jobs::Counter counter;
+    for (uint32_t i = 0; i < 100; ++i)
+    {
+        BeeEngine::Jobs::Schedule(BeeEngine::Jobs::CreateJob(counter, []() { BeeEngine::Jobs::this_job::yield(); }));
+    }
+    BeeEngine::Jobs::WaitForJobsToComplete(counter);
+    // Workers count the job after it switched back, that may happen after the counter reached zero
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    auto after = BeeEngine::Jobs::GetJobSystemStatistics();
+    auto total = [](const BeeEngine::Jobs::JobSystemStatistics& statistics, auto member)
+    {
+        uint64_t sum = statistics.Helpers.*member;
+        for (auto& worker : statistics.Workers)
+        {
+            sum += worker.*member;
+        }
+        return sum;
+    };
+    using Statistics = BeeEngine::Jobs::WorkerStatistics;
+    EXPECT_EQ(total(after, &Statistics::JobsCompleted) - total(before, &Statistics::JobsCompleted), 100);
+    EXPECT_EQ(total(after, &Statistics::Yields) - total(before, &Statistics::Yields), 100);
+    EXPECT_GE(total(after, &Statistics::Resumes) - total(before, &Statistics::Resumes), 200);
+    EXPECT_GT(total(after, &Statistics::BusyTime), total(before, &Statistics::BusyTime));
+}
+
+TEST(JobStatisticsTest, SamplerComputesFrameValues)
+{
+    BeeEngine::Jobs::JobStatisticsSampler sampler;
+    sampler.Sample();
+    BeeEngine::Jobs::Counter counter;
+    for (uint32_t i = 0; i < 10; ++i)
+    {
+        BeeEngine::Jobs::Schedule(BeeEngine::Jobs::CreateJob(
+            counter, []() { std::this_thread::sleep_for(std::chrono::milliseconds(1)); }));
+    }
+    BeeEngine::Jobs::WaitForJobsToComplete(counter);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    sampler.Sample();
+    auto& frame = sampler.GetLastFrame();
+    EXPECT_EQ(frame.Workers.size(), BeeEngine::Jobs::GetNumberOfWorkers());
+    EXPECT_EQ(frame.JobsCompleted, 10);
+    EXPECT_GT(frame.FrameTime, 0.0);
+    EXPECT_GT(frame.AverageUtilization, 0.0);
+    EXPECT_LE(frame.AverageUtilization, 1.0);
+    EXPECT_EQ(sampler.GetHistoryOffset(), 1);
+}
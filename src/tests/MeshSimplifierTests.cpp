@@ -0,0 +1,170 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#include <Core/AssetManagement/MeshSource.h>
+#include <Renderer/MeshSimplifier.h>
+#include <algorithm>
+#include <cmath>
+#include <glm/glm.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace BeeEngine;
+
+namespace
+{
+    struct Grid
+    {
+        std::vector<glm::vec3> Positions;
+        std::vector<uint32_t> Indices;
+    };
+
+    // Flat square in the xy plane with size x size quads, that face +z
+    Grid MakeGrid(uint32_t size, float (*height)(float, float) = nullptr)
+    {
+        Grid grid;
+        for (uint32_t y = 0; y <= size; ++y)
+        {
+            for (uint32_t x = 0; x <= size; ++x)
+            {
+                const float fx = static_cast<float>(x) / static_cast<float>(size);
+                const float fy = static_cast<float>(y) / static_cast<float>(size);
+                grid.Positions.emplace_back(fx, fy, height ? height(fx, fy) : 0.0f);
+            }
+        }
+        for (uint32_t y = 0; y < size; ++y)
+        {
+            for (uint32_t x = 0; x < size; ++x)
+            {
+                const uint32_t i = y * (size + 1) + x;
+                grid.Indices.insert(grid.Indices.end(), {i, i + 1, i + size + 2, i, i + size + 2, i + size + 1});
+            }
+        }
+        return grid;
+    }
+
+    glm::vec3 NormalOf(const Grid& grid, const std::vector<uint32_t>& indices, size_t triangle)
+    {
+        const glm::vec3 p0 = grid.Positions[indices[triangle * 3]];
+        const glm::vec3 p1 = grid.Positions[indices[triangle * 3 + 1]];
+        const glm::vec3 p2 = grid.Positions[indices[triangle * 3 + 2]];
+        return glm::cross(p1 - p0, p2 - p0);
+    }
+
+    void ExpectValidTriangles(const Grid& grid, const std::vector<uint32_t>& indices)
+    {
+        ASSERT_EQ(indices.size() % 3, 0);
+        for (size_t t = 0; t < indices.size() / 3; ++t)
+        {
+            for (size_t corner = 0; corner < 3; ++corner)
+            {
+                EXPECT_LT(indices[t * 3 + corner], grid.Positions.size());
+            }
+            EXPECT_GT(glm::length(NormalOf(grid, indices, t)), 0.0f);
+        }
+    }
+} // namespace
+
+TEST(MeshSimplifierTest, FlatGridCollapsesWithoutError)
+{
+    const Grid grid = MakeGrid(8);
+    const auto result = SimplifyMesh(grid.Indices, grid.Positions, 0, 0.01f);
+    ExpectValidTriangles(grid, result.Indices);
+    // Two triangles are enough for a square
+    EXPECT_EQ(result.Indices.size(), 6);
+    EXPECT_NEAR(result.Error, 0.0f, 1e-3f);
+    for (size_t t = 0; t < result.Indices.size() / 3; ++t)
+    {
+        EXPECT_GT(NormalOf(grid, result.Indices, t).z, 0.0f);
+    }
+}
+
+TEST(MeshSimplifierTest, BorderCornersAreKept)
+{
+    const Grid grid = MakeGrid(8);
+    const auto result = SimplifyMesh(grid.Indices, grid.Positions, 0, 0.01f);
+    const uint32_t last = 8 * 9 + 8;
+    for (uint32_t corner : {0u, 8u, 8u * 9u, last})
+    {
+        EXPECT_NE(std::ranges::find(result.Indices, corner), result.Indices.end()) << corner;
+    }
+}
+
+TEST(MeshSimplifierTest, SeamsStayClosed)
+{
+    // Column x = 4 of the grid is split like a UV seam: quads on the right reference copies of its vertices
+    constexpr uint32_t size = 8;
+    constexpr uint32_t seamColumn = 4;
+    Grid grid = MakeGrid(size);
+    std::vector<uint32_t> originals;
+    std::vector<uint32_t> copies;
+    for (uint32_t y = 0; y <= size; ++y)
+    {
+        originals.push_back(y * (size + 1) + seamColumn);
+        copies.push_back(static_cast<uint32_t>(grid.Positions.size()));
+        grid.Positions.push_back(grid.Positions[originals.back()]);
+    }
+    for (size_t i = 0; i < grid.Indices.size(); i += 3)
+    {
+        const bool right = std::ranges::any_of(grid.Indices.begin() + i,
+                                               grid.Indices.begin() + i + 3,
+                                               [&](uint32_t index) { return index % (size + 1) > seamColumn; });
+        for (size_t corner = i; right && corner < i + 3; ++corner)
+        {
+            if (grid.Indices[corner] % (size + 1) == seamColumn && grid.Indices[corner] < copies.front())
+            {
+                grid.Indices[corner] = copies[grid.Indices[corner] / (size + 1)];
+            }
+        }
+    }
+
+    const auto result = SimplifyMesh(grid.Indices, grid.Positions, 0, 0.01f);
+    ExpectValidTriangles(grid, result.Indices);
+    EXPECT_LT(result.Indices.size(), grid.Indices.size() / 2);
+    // Both sides keep every seam vertex, so their edges along the seam match
+    for (uint32_t y = 0; y <= size; ++y)
+    {
+        EXPECT_NE(std::ranges::find(result.Indices, originals[y]), result.Indices.end()) << y;
+        EXPECT_NE(std::ranges::find(result.Indices, copies[y]), result.Indices.end()) << y;
+    }
+}
+
+TEST(MeshSimplifierTest, StopsAtTargetIndexCount)
+{
+    const Grid grid = MakeGrid(16);
+    const size_t target = grid.Indices.size() / 2;
+    const auto result = SimplifyMesh(grid.Indices, grid.Positions, target, 1.0f);
+    ExpectValidTriangles(grid, result.Indices);
+    EXPECT_LE(result.Indices.size(), target);
+    // Every collapse removes at most two triangles
+    EXPECT_GE(result.Indices.size(), target - 6);
+}
+
+TEST(MeshSimplifierTest, StopsAtMaxError)
+{
+    const Grid grid = MakeGrid(16, [](float x, float y) { return 0.2f * std::sin(x * 12.0f) * std::cos(y * 12.0f); });
+    const auto coarse = SimplifyMesh(grid.Indices, grid.Positions, 0, 1.0f);
+    const auto precise = SimplifyMesh(grid.Indices, grid.Positions, 0, 0.001f);
+    ExpectValidTriangles(grid, coarse.Indices);
+    ExpectValidTriangles(grid, precise.Indices);
+    EXPECT_LT(coarse.Indices.size(), precise.Indices.size());
+    EXPECT_LE(precise.Error, 0.001f);
+    EXPECT_GT(precise.Indices.size(), grid.Indices.size() / 4);
+}
+
+TEST(MeshSimplifierTest, TargetAboveIndexCountKeepsMesh)
+{
+    const Grid grid = MakeGrid(4);
+    const auto result = SimplifyMesh(grid.Indices, grid.Positions, grid.Indices.size(), 1.0f);
+    EXPECT_EQ(result.Indices, grid.Indices);
+    EXPECT_EQ(result.Error, 0.0f);
+}
+
+TEST(MeshSimplifierTest, SmallerMeshesSelectCoarserLods)
+{
+    EXPECT_EQ(MeshSource::SelectLod(1.0f), 0);
+    EXPECT_EQ(MeshSource::SelectLod(0.2f), 1);
+    EXPECT_EQ(MeshSource::SelectLod(0.1f), 2);
+    EXPECT_EQ(MeshSource::SelectLod(0.01f), MeshSource::MaxLodLevels - 1);
+}
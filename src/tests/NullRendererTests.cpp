@@ -0,0 +1,278 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#include <Core/DeletionQueue.h>
+#include <Platform/Null/NullFrameBuffer.h>
+#include <Platform/Null/NullInstancedBuffer.h>
+#include <Platform/Null/NullMesh.h>
+#include <Platform/Null/NullPipeline.h>
+#include <Platform/Null/NullRendererAPI.h>
+#include <Platform/Null/NullStorageBuffer.h>
+#include <Platform/Null/NullUniformBuffer.h>
+#include <Renderer/Renderer.h>
+#include <Renderer/SceneRenderer.h>
+#include <Scene/Components.h>
+#include <Scene/Entity.h>
+#include <array>
+#include <glm/gtc/matrix_transform.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace BeeEngine;
+using namespace BeeEngine::Internal;
+
+namespace
+{
+    class TestMaterial final : public Material
+    {
+    public:
+        InstancedBuffer& GetInstancedBuffer() const override { return *m_InstancedBuffer; }
+        void Bind(CommandBuffer& cmd) override {}
+
+    private:
+        Scope<InstancedBuffer> m_InstancedBuffer = CreateScope<NullInstancedBuffer>(1024);
+    };
+
+    size_t GetUploadedBytes()
+    {
+        return RenderingQueue::GetGlobalStatistics().UploadedBytes;
+    }
+
+    size_t GetAllocatedGPUBuffers()
+    {
+        return RenderingQueue::GetGlobalStatistics().AllocatedGPUBuffers;
+    }
+
+    void RunEmptyFrame()
+    {
+        auto frameData = Renderer::BeginFrame().Value();
+        Renderer::StartMainCommandBuffer(frameData);
+        Renderer::EndMainCommandBuffer(frameData);
+        Renderer::EndFrame(frameData);
+        DeletionQueue::Frame().Flush();
+    }
+} // namespace
+
+TEST(NullRendererTests, CountsDrawCallsOfFrame)
+{
+    NullMesh mesh(4, 6);
+    TestMaterial material;
+    Model model(mesh, material);
+    NullRendererAPI api;
+    api.Init();
+
+    auto commandBuffer = api.BeginFrame().Value();
+    ASSERT_TRUE(commandBuffer.IsValid());
+    api.StartMainCommandBuffer(commandBuffer);
+    api.DrawInstanced(commandBuffer, model, material.GetInstancedBuffer(), {}, 5, 0);
+    api.DrawInstanced(commandBuffer, model, material.GetInstancedBuffer(), {}, 3, 64);
+    api.EndMainCommandBuffer(commandBuffer);
+    api.EndFrame();
+
+    const auto& counters = api.GetCounters();
+    EXPECT_EQ(counters.FrameCount, 1);
+    EXPECT_EQ(counters.SubmittedCommandBufferCount, 1);
+    EXPECT_EQ(counters.DrawCallCount, 2);
+    EXPECT_EQ(counters.InstanceCount, 8);
+    EXPECT_EQ(counters.VertexCount, 32);
+    EXPECT_EQ(counters.IndexCount, 48);
+}
+
+TEST(NullRendererTests, RenderingQueueFrameFillsRendererStatistics)
+{
+    // The test executable runs with the null renderer API, so the frame goes through the queue of the application
+    ASSERT_EQ(Renderer::GetAPI(), RenderAPI::Null);
+    NullMesh quad(4, 6);
+    NullMesh cube(8, 36);
+    TestMaterial material;
+    Model quadModel(quad, material);
+    Model cubeModel(cube, material);
+    std::array<byte, 64> instance{};
+    RenderingQueue::ResetStatistics();
+
+    auto frameData = Renderer::BeginFrame().Value();
+    Renderer::StartMainCommandBuffer(frameData);
+    auto& commandBuffer = frameData.GetMainCommandBuffer();
+    for (size_t i = 0; i < 3; ++i)
+    {
+        commandBuffer.SubmitInstance(quadModel, {}, instance);
+        commandBuffer.SubmitInstance(cubeModel, {}, instance);
+    }
+    commandBuffer.SubmitInstance(quadModel, {}, instance);
+    Renderer::EndMainCommandBuffer(frameData);
+    Renderer::EndFrame(frameData);
+
+    const auto& statistics = Renderer::GetStatistics();
+    EXPECT_EQ(statistics.TotalInstanceCount, 7);
+    // Instances of a model are batched into one instanced draw
+    EXPECT_EQ(statistics.DrawCallCount, 2);
+    EXPECT_EQ(statistics.VertexCount, 4 * 4 + 3 * 8);
+    EXPECT_EQ(statistics.IndexCount, 4 * 6 + 3 * 36);
+    EXPECT_EQ(statistics.PipelineChangeCount, 1);
+    EXPECT_EQ(statistics.UploadedBytes, 7 * instance.size());
+    EXPECT_GT(statistics.AllocatedGPUMemory, 0);
+}
+
+TEST(NullRendererTests, RenderingQueueCanBeDestroyedAfterFinishFrame)
+{
+    NullMesh quad(4, 6);
+    TestMaterial material;
+    Model model(quad, material);
+    std::array<byte, 64> instance{};
+    FrameBufferPreferences preferences(16, 8);
+    preferences.Attachments = {{FrameBufferTextureFormat::RGBA8}};
+    // Buffers of queues, that other tests destroyed, are released first
+    for (uint32_t i = 0; i <= Renderer::FramesInFlight; ++i)
+    {
+        RunEmptyFrame();
+    }
+    const size_t allocatedBuffers = GetAllocatedGPUBuffers();
+    {
+        // Like a frame buffer, that a script renders into and destroys in the same frame
+        NullFrameBuffer frameBuffer(preferences);
+        auto commandBuffer = frameBuffer.Bind();
+        commandBuffer.SubmitInstance(model, {}, instance);
+        frameBuffer.Unbind(commandBuffer);
+        EXPECT_EQ(GetAllocatedGPUBuffers(), allocatedBuffers + 1);
+    }
+    DeletionQueue::Frame().Flush();
+    // Instance buffer of the queue is kept, while the frames in flight may read it
+    for (uint32_t i = 0; i < Renderer::FramesInFlight; ++i)
+    {
+        EXPECT_EQ(GetAllocatedGPUBuffers(), allocatedBuffers + 1);
+        RunEmptyFrame();
+    }
+    RunEmptyFrame();
+    EXPECT_EQ(GetAllocatedGPUBuffers(), allocatedBuffers);
+}
+
+TEST(NullRendererTests, SceneFrameCullsAndSortsSprites)
+{
+    // 40 x 40 grid of small sprites, the middle 20 x 20 of them are inside of the view.
+    // Sprites in odd rows are transparent
+    constexpr int side = 40;
+    auto scene = CreateRef<Scene>();
+    for (int row = 0; row < side; ++row)
+    {
+        for (int column = 0; column < side; ++column)
+        {
+            auto entity = scene->CreateEntity("Sprite");
+            auto& transform = entity.GetComponent<TransformComponent>();
+            transform.Translation = {(column - 19.5f) * 0.1f, (row - 19.5f) * 0.1f, 0.0f};
+            transform.Scale = glm::vec3(0.05f);
+            entity.AddComponent<SpriteRendererComponent>().Color =
+                row % 2 ? Color4{1.0f, 1.0f, 1.0f, 0.5f} : Color4{Color4::White};
+        }
+    }
+    const glm::mat4 viewProjection = glm::ortho(-1.0f, 1.0f, -1.0f, 1.0f, -1.0f, 1.0f);
+    const Locale::Localization locale;
+    RenderingQueue::ResetStatistics();
+
+    auto frameData = Renderer::BeginFrame().Value();
+    Renderer::StartMainCommandBuffer(frameData);
+    SceneRenderer::RenderScene(
+        *scene, frameData.GetMainCommandBuffer(), locale, viewProjection, GetFrustumPlanes(viewProjection));
+    Renderer::EndMainCommandBuffer(frameData);
+    Renderer::EndFrame(frameData);
+    DeletionQueue::Frame().Flush();
+
+    // Sprites become static only after a few unchanged frames, so all of them went through the extraction
+    const auto& statistics = Renderer::GetStatistics();
+    EXPECT_EQ(statistics.VisibleInstanceCount, 20 * 20);
+    EXPECT_EQ(statistics.CulledInstanceCount, side * side - 20 * 20);
+    EXPECT_EQ(statistics.OpaqueInstanceCount, 20 * 10);
+    EXPECT_EQ(statistics.TransparentInstanceCount, 20 * 10);
+    EXPECT_EQ(statistics.TotalInstanceCount, 20 * 20);
+}
+
+TEST(NullRendererTests, CountsIndirectDrawsAndDispatches)
+{
+    NullMesh mesh(4, 6);
+    TestMaterial material;
+    Model model(mesh, material);
+    NullPipeline computePipeline(PipelineType::Compute);
+    NullStorageBuffer instances(256, StorageBufferUsage::GPUOnly);
+    NullStorageBuffer commands(3 * sizeof(IndirectDrawCommand), StorageBufferUsage::CPUToGPU);
+    NullRendererAPI api;
+    api.Init();
+    EXPECT_FALSE(api.SupportsIndirectDrawing());
+
+    auto commandBuffer = api.BeginFrame().Value();
+    api.StartMainCommandBuffer(commandBuffer);
+    api.Dispatch(computePipeline, {}, 4);
+    api.DrawIndexedIndirect(commandBuffer, model, instances, {}, commands, sizeof(IndirectDrawCommand), 2);
+    api.EndMainCommandBuffer(commandBuffer);
+    api.EndFrame();
+
+    const auto& counters = api.GetCounters();
+    EXPECT_EQ(counters.DispatchCount, 1);
+    EXPECT_EQ(counters.IndirectDrawCallCount, 1);
+    EXPECT_EQ(counters.DrawCallCount, 0);
+}
+
+TEST(NullRendererTests, StorageBufferKeepsDataAndCountsUploadedBytes)
+{
+    NullStorageBuffer buffer(64, StorageBufferUsage::CPUToGPU);
+    std::vector<byte> data(16, byte{7});
+    const size_t before = GetUploadedBytes();
+
+    buffer.SetData(32, data);
+
+    EXPECT_EQ(GetUploadedBytes() - before, 16);
+    auto contents = buffer.ReadData();
+    ASSERT_EQ(contents.size(), 64);
+    EXPECT_EQ(contents[31], byte{0});
+    EXPECT_EQ(contents[32], byte{7});
+    EXPECT_EQ(contents[47], byte{7});
+    EXPECT_EQ(contents[48], byte{0});
+}
+
+TEST(NullRendererTests, InstancedBufferCountsUploadedBytes)
+{
+    NullInstancedBuffer buffer(256);
+    std::vector<byte> data(32);
+    const size_t before = GetUploadedBytes();
+
+    buffer.UpdateRange(16, data);
+    auto memory = buffer.BeginWrite(128, 64);
+    EXPECT_EQ(memory.size(), 64);
+    buffer.EndWrite(128, 64);
+
+    EXPECT_EQ(GetUploadedBytes() - before, 96);
+}
+
+TEST(NullRendererTests, UniformBufferCountsUploadedBytes)
+{
+    NullUniformBuffer elements(64, 4);
+    std::vector<byte> data(48);
+    const size_t before = GetUploadedBytes();
+
+    elements.SetElement(3, data.data(), data.size());
+    UniformBufferElement element(elements, 2);
+    element.SetData(data.data(), 16);
+
+    EXPECT_EQ(GetUploadedBytes() - before, 64);
+    EXPECT_EQ(element.GetDynamicOffset(), 128);
+    EXPECT_EQ(elements.GetElementOffset(3), 192);
+}
+
+TEST(NullRendererTests, FrameBufferKeepsClearValues)
+{
+    FrameBufferPreferences preferences(16, 8);
+    FrameBufferTextureSpecification entityId{FrameBufferTextureFormat::RedInteger};
+    entityId.ClearRedInteger = -1;
+    preferences.Attachments = {{FrameBufferTextureFormat::RGBA8}, entityId, {FrameBufferTextureFormat::Depth}};
+    NullFrameBuffer frameBuffer(preferences);
+
+    auto commandBuffer = frameBuffer.Bind();
+    ASSERT_TRUE(commandBuffer.IsValid());
+    frameBuffer.Unbind(commandBuffer);
+    EXPECT_FALSE(commandBuffer.IsValid());
+
+    EXPECT_EQ(frameBuffer.ReadPixel(1, 15, 7), -1);
+    frameBuffer.Resize(32, 32);
+    EXPECT_EQ(frameBuffer.GetColorAttachmentResource(1).GetWidth(), 32);
+    EXPECT_NE(frameBuffer.GetColorAttachmentImGuiRendererID(0), frameBuffer.GetColorAttachmentImGuiRendererID(1));
+    EXPECT_NE(frameBuffer.GetDepthAttachmentImGuiRendererID(), 0);
+}
@@ -0,0 +1,84 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#include <Renderer/RingOffsetAllocator.h>
+#include <gtest/gtest.h>
+
+using namespace BeeEngine;
+
+TEST(RingOffsetAllocatorTest, AllocationsAreAligned)
+{
+    RingOffsetAllocator allocator(256);
+    EXPECT_EQ(allocator.Allocate(10, 16), 0);
+    EXPECT_EQ(allocator.Allocate(10, 16), 16);
+    EXPECT_EQ(allocator.Allocate(1, 64), 64);
+    EXPECT_EQ(allocator.GetUsedSize(), 65);
+}
+
+TEST(RingOffsetAllocatorTest, FramesAreReleasedInOrder)
+{
+    RingOffsetAllocator allocator(256);
+    EXPECT_EQ(allocator.Allocate(100, 16), 0);
+    allocator.FinishFrame();
+    EXPECT_EQ(allocator.Allocate(100, 16), 112);
+    allocator.FinishFrame();
+    // Both frames are still in flight
+    EXPECT_FALSE(allocator.Allocate(100, 16).has_value());
+
+    allocator.ReleaseFrame();
+    EXPECT_EQ(allocator.GetUsedSize(), 212 - 100);
+    // Does not fit at the end, so it wraps around into the space of the first frame
+    EXPECT_EQ(allocator.Allocate(96, 16), 0);
+    allocator.FinishFrame();
+    EXPECT_EQ(allocator.GetFinishedFrameCount(), 2);
+    EXPECT_EQ(allocator.GetUsedSize(), 256 - 100 + 96);
+
+    allocator.ReleaseFrame();
+    EXPECT_EQ(allocator.GetUsedSize(), 256 - 212 + 96);
+    EXPECT_EQ(allocator.Allocate(100, 16), 96);
+}
+
+TEST(RingOffsetAllocatorTest, RingIsNeverFull)
+{
+    RingOffsetAllocator allocator(128);
+    EXPECT_EQ(allocator.Allocate(64, 16), 0);
+    EXPECT_EQ(allocator.Allocate(64, 16), 64);
+    allocator.FinishFrame();
+    EXPECT_EQ(allocator.Allocate(32, 16), std::nullopt);
+    allocator.ReleaseFrame();
+    EXPECT_EQ(allocator.GetUsedSize(), 0);
+
+    EXPECT_EQ(allocator.Allocate(96, 16), 0);
+    allocator.FinishFrame();
+    EXPECT_EQ(allocator.Allocate(16, 16), 96);
+    allocator.ReleaseFrame();
+    // Wrapped allocation must not reach the tail, otherwise the full ring would look empty
+    EXPECT_EQ(allocator.Allocate(96, 16), std::nullopt);
+    EXPECT_EQ(allocator.Allocate(95, 16), 0);
+    EXPECT_EQ(allocator.GetUsedSize(), 128 - 96 + 95);
+}
+
+TEST(RingOffsetAllocatorTest, EmptyRingStartsFromTheBeginning)
+{
+    RingOffsetAllocator allocator(256);
+    EXPECT_EQ(allocator.Allocate(200, 16), 0);
+    allocator.FinishFrame();
+    // Frame without allocations
+    allocator.FinishFrame();
+    allocator.ReleaseFrame();
+    allocator.ReleaseFrame();
+    EXPECT_EQ(allocator.GetUsedSize(), 0);
+    EXPECT_EQ(allocator.Allocate(200, 16), 0);
+}
+
+TEST(RingOffsetAllocatorTest, ResetChangesCapacity)
+{
+    RingOffsetAllocator allocator(64);
+    EXPECT_EQ(allocator.Allocate(64, 16), 0);
+    allocator.FinishFrame();
+    allocator.Reset(128);
+    EXPECT_EQ(allocator.GetCapacity(), 128);
+    EXPECT_EQ(allocator.GetFinishedFrameCount(), 0);
+    EXPECT_EQ(allocator.Allocate(128, 16), 0);
+}
@@ -0,0 +1,205 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#include <Renderer/FrustumCulling.h>
+#include <Renderer/Material.h>
+#include <Renderer/Mesh.h>
+#include <Renderer/Model.h>
+#include <Renderer/SceneRenderer.h>
+#include <Renderer/SceneTreeRenderer.h>
+#include <Scene/Components.h>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <entt/entt.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <gtest/gtest.h>
+#include <iostream>
+#include <vector>
+
+using namespace BeeEngine;
+
+namespace
+{
+    class FakeMesh final : public Mesh
+    {
+    public:
+        FakeMesh() { SetLocalBounds({{-0.5f, -0.5f, 0.0f}, {0.5f, 0.5f, 0.0f}}); }
+        [[nodiscard]] uint32_t GetVertexCount() const override { return 4; }
+        [[nodiscard]] uint32_t GetIndexCount() const override { return 6; }
+        void Bind(CommandBuffer&) override {}
+        [[nodiscard]] bool IsIndexed() const override { return true; }
+    };
+
+    class FakeMaterial final : public Material
+    {
+    public:
+        [[nodiscard]] InstancedBuffer& GetInstancedBuffer() const override { std::abort(); }
+        void Bind(CommandBuffer&) override {}
+    };
+
+    /**
+     * Registry with sprites on a grid, that is four times bigger than the visible area,
+     * so about a quarter of them survives frustum culling
+     */
+    struct SpriteScene
+    {
+        entt::registry Registry;
+        std::vector<entt::entity> Sprites;
+
+        explicit SpriteScene(size_t count)
+        {
+            const auto side = static_cast<size_t>(std::ceil(std::sqrt(static_cast<double>(count))));
+            Sprites.reserve(count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                auto entity = Registry.create();
+                const glm::vec3 position{static_cast<float>(i % side) / side * 4.0f - 1.0f,
+                                         static_cast<float>(i / side) / side * 4.0f - 1.0f,
+                                         -0.5f};
+                Registry.emplace<WorldTransformComponent>(entity).Transform =
+                    glm::scale(glm::translate(glm::mat4(1.0f), position), glm::vec3(1.0f / side));
+                Registry.emplace<SpriteRendererComponent>(entity).Color = Color4::White;
+                Sprites.push_back(entity);
+            }
+        }
+    };
+
+    // Same work per sprite as SceneRenderer::RenderScene
+    void ExtractSprites(SceneTreeRenderer& bucket,
+                        SpriteScene& scene,
+                        Model& model,
+                        const FrustumCuller& culler,
+                        size_t begin,
+                        size_t end)
+    {
+        auto view = scene.Registry.view<SpriteRendererComponent, WorldTransformComponent>();
+        BoundsBatch bounds;
+        std::vector<Math::AABB> worldBounds;
+        std::vector<uint8_t> visibility;
+        bounds.Reserve(end - begin);
+        worldBounds.reserve(end - begin);
+        for (size_t i = begin; i < end; ++i)
+        {
+            worldBounds.push_back(
+                model.GetLocalBounds().Transformed(view.get<WorldTransformComponent>(scene.Sprites[i]).Transform));
+            bounds.Add(worldBounds.back());
+        }
+        culler.Cull(bounds, visibility);
+        const std::vector<BindingSet*> bindingSets{nullptr, nullptr};
+        for (size_t i = begin; i < end; ++i)
+        {
+            if (!visibility[i - begin])
+            {
+                continue;
+            }
+            auto entity = scene.Sprites[i];
+            auto [sprite, worldTransform] = view.get<SpriteRendererComponent, WorldTransformComponent>(entity);
+            SpriteInstanceBufferData data{
+                worldTransform.Transform, sprite.Color, sprite.TilingFactor, static_cast<int32_t>(entity) + 1};
+            bucket.AddEntity(data.Model,
+                             worldBounds[i - begin],
+                             IsTransparent(data, nullptr),
+                             model,
+                             bindingSets,
+                             {(byte*)&data, sizeof(SpriteInstanceBufferData)});
+        }
+    }
+
+    // Order sensitive checksum of the extracted instances
+    uint64_t Checksum(SceneTreeRenderer& renderer)
+    {
+        uint64_t hash = 14695981039346656037ull;
+        for (const auto& entities : {renderer.GetOpaque(), renderer.GetTransparent()})
+        {
+            hash = (hash ^ entities.size()) * 1099511628211ull;
+            for (const auto& entity : entities)
+            {
+                int32_t entityID;
+                memcpy(&entityID,
+                       entity.InstancedData.data() + offsetof(SpriteInstanceBufferData, EntityID),
+                       sizeof(int32_t));
+                hash = (hash ^ static_cast<uint32_t>(entityID)) * 1099511628211ull;
+            }
+        }
+        return hash;
+    }
+
+    template <typename Extract>
+    double Measure(Extract&& extract)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+        extract();
+        return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+    }
+} // namespace
+
+TEST(SceneExtractionTest, ParallelExtractionKeepsSerialOrder)
+{
+    FakeMesh mesh;
+    FakeMaterial material;
+    Model model(mesh, material);
+    const glm::mat4 viewProjection = glm::ortho(-1.0f, 1.0f, -1.0f, 1.0f, 0.1f, 10.0f);
+    FrustumCuller culler(GetFrustumPlanes(viewProjection));
+    // Extraction chunks have at least 512 sprites, so there are several of them
+    constexpr size_t count = 5000;
+    SpriteScene scene(count);
+
+    uint64_t serialChecksum;
+    {
+        SceneTreeRenderer renderer(viewProjection, nullptr);
+        ExtractSprites(renderer, scene, model, culler, 0, count);
+        // About a quarter of the sprites is visible
+        ASSERT_GT(renderer.GetOpaque().size(), count / 8);
+        ASSERT_LT(renderer.GetOpaque().size(), count / 2);
+        serialChecksum = Checksum(renderer);
+    }
+    SceneTreeRenderer renderer(viewProjection, nullptr);
+    renderer.ExtractInParallel(count,
+                               [&](SceneTreeRenderer& bucket, size_t begin, size_t end)
+                               { ExtractSprites(bucket, scene, model, culler, begin, end); });
+    EXPECT_EQ(Checksum(renderer), serialChecksum);
+}
+
+// Measures the extraction of big scenes, run it with --gtest_also_run_disabled_tests
+TEST(SceneExtractionBenchmark, DISABLED_SerialVersusParallel)
+{
+    FakeMesh mesh;
+    FakeMaterial material;
+    Model model(mesh, material);
+    const glm::mat4 viewProjection = glm::ortho(-1.0f, 1.0f, -1.0f, 1.0f, 0.1f, 10.0f);
+    FrustumCuller culler(GetFrustumPlanes(viewProjection));
+
+    for (size_t count : {10'000, 100'000, 1'000'000})
+    {
+        SpriteScene scene(count);
+        uint64_t serialChecksum;
+        uint64_t parallelChecksum;
+        double serial;
+        double parallel;
+        {
+            SceneTreeRenderer renderer(viewProjection, nullptr);
+            serial = Measure([&]() { ExtractSprites(renderer, scene, model, culler, 0, count); });
+            serialChecksum = Checksum(renderer);
+        }
+        {
+            SceneTreeRenderer renderer(viewProjection, nullptr);
+            parallel = Measure(
+                [&]()
+                {
+                    renderer.ExtractInParallel(count,
+                                               [&](SceneTreeRenderer& bucket, size_t begin, size_t end)
+                                               { ExtractSprites(bucket, scene, model, culler, begin, end); });
+                });
+            parallelChecksum = Checksum(renderer);
+        }
+        EXPECT_EQ(serialChecksum, parallelChecksum) << "Parallel extraction must keep the serial order";
+        std::cout << "[SceneExtractionBenchmark] " << count << " sprites: serial " << serial << " ms, parallel "
+                  << parallel << " ms on " << Jobs::GetNumberOfWorkers() << " worker(s)" << std::endl;
+        // Every scene size is a frame, so memory of the extracted instances is reused
+        FrameAllocator::NextFrame();
+    }
+}
@@ -0,0 +1,208 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#include <Renderer/StaticBatches.h>
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace BeeEngine;
+using namespace BeeEngine::Internal;
+
+namespace
+{
+    struct Data
+    {
+        float Position;
+        int32_t EntityID;
+    };
+
+    /**
+     * Renderers with one instance each, that are tracked every frame like SceneRenderer does it
+     */
+    struct Renderers
+    {
+        StaticBatches Batches;
+        std::vector<StaticRenderingState> States;
+        std::vector<Data> Values;
+        DrawState State{*reinterpret_cast<Model*>(0x1000), {}};
+
+        explicit Renderers(size_t count) : States(count)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                Values.push_back({static_cast<float>(i), static_cast<int32_t>(i)});
+            }
+        }
+
+        StaticBatches::Instance GetInstance(size_t i) const
+        {
+            return {.State = State, .Data = {(const byte*)&Values[i], sizeof(Data)}, .WorldBounds = {}};
+        }
+
+        // Returns renderers, that were drawn from the batches
+        size_t Frame(size_t count)
+        {
+            size_t tracked = 0;
+            for (size_t i = 0; i < count; ++i)
+            {
+                const auto instance = GetInstance(i);
+                tracked += Batches.Track(States[i], {&instance, 1});
+            }
+            Batches.Commit();
+            return tracked;
+        }
+        size_t Frame() { return Frame(States.size()); }
+
+        bool IsStatic(size_t i) const
+        {
+            const auto instance = GetInstance(i);
+            return Batches.Matches(States[i].Handle, {&instance, 1});
+        }
+    };
+} // namespace
+
+TEST(StaticBatchesTest, UnchangedRenderersBecomeStatic)
+{
+    Renderers renderers(10);
+    for (uint32_t frame = 0; frame < StaticBatches::FramesToBecomeStatic; ++frame)
+    {
+        EXPECT_EQ(renderers.Frame(), 0) << "Frame " << frame;
+    }
+    EXPECT_EQ(renderers.Frame(), 10);
+    EXPECT_EQ(renderers.Batches.GetInstanceCount(), 10);
+    EXPECT_EQ(renderers.Batches.GetBatchCount(), 1);
+    for (size_t i = 0; i < 10; ++i)
+    {
+        EXPECT_TRUE(renderers.IsStatic(i));
+    }
+}
+
+TEST(StaticBatchesTest, ChangedRendererIsUpdatedInPlace)
+{
+    Renderers renderers(3);
+    for (uint32_t frame = 0; frame <= StaticBatches::FramesToBecomeStatic + 1; ++frame)
+    {
+        renderers.Frame();
+    }
+    const auto handle = renderers.States[1].Handle;
+    renderers.Values[1].Position = 42.0f;
+    EXPECT_EQ(renderers.Frame(), 3);
+    EXPECT_EQ(renderers.States[1].Handle.Index, handle.Index);
+    EXPECT_EQ(renderers.States[1].Handle.Generation, handle.Generation);
+    EXPECT_TRUE(renderers.IsStatic(1));
+    EXPECT_EQ(renderers.Batches.GetInstanceCount(), 3);
+}
+
+TEST(StaticBatchesTest, MovingRendererBecomesDynamic)
+{
+    Renderers renderers(3);
+    for (uint32_t frame = 0; frame <= StaticBatches::FramesToBecomeStatic + 1; ++frame)
+    {
+        renderers.Frame();
+    }
+    renderers.Values[0].Position += 1.0f;
+    EXPECT_EQ(renderers.Frame(), 3);
+    renderers.Values[0].Position += 1.0f;
+    EXPECT_EQ(renderers.Frame(), 2);
+    EXPECT_FALSE(renderers.States[0].Handle.IsValid());
+    EXPECT_EQ(renderers.Batches.GetInstanceCount(), 2);
+    // Moved into the removed slot
+    EXPECT_TRUE(renderers.IsStatic(1));
+    EXPECT_TRUE(renderers.IsStatic(2));
+}
+
+TEST(StaticBatchesTest, RenderersThatAreNotTrackedAreRemoved)
+{
+    Renderers renderers(5);
+    for (uint32_t frame = 0; frame <= StaticBatches::FramesToBecomeStatic; ++frame)
+    {
+        renderers.Frame();
+    }
+    ASSERT_EQ(renderers.Batches.GetInstanceCount(), 5);
+    const auto removed = renderers.States[3].Handle;
+    const auto reused = renderers.States[4].Handle;
+    // Last two renderers were destroyed
+    EXPECT_EQ(renderers.Frame(3), 3);
+    EXPECT_EQ(renderers.Batches.GetInstanceCount(), 3);
+    EXPECT_FALSE(renderers.Batches.Contains(removed));
+    EXPECT_FALSE(renderers.Batches.Contains(reused));
+    for (size_t i = 0; i < 3; ++i)
+    {
+        EXPECT_TRUE(renderers.IsStatic(i));
+    }
+
+    // Handle of a removed renderer stays invalid, when its record is reused
+    renderers.States[3] = {};
+    for (uint32_t frame = 0; frame <= StaticBatches::FramesToBecomeStatic; ++frame)
+    {
+        renderers.Frame(4);
+    }
+    EXPECT_TRUE(renderers.IsStatic(3));
+    EXPECT_EQ(renderers.States[3].Handle.Index, reused.Index);
+    EXPECT_FALSE(renderers.Batches.Contains(reused));
+}
+
+TEST(StaticBatchesTest, UntrackedRendererIsRemoved)
+{
+    Renderers renderers(2);
+    for (uint32_t frame = 0; frame <= StaticBatches::FramesToBecomeStatic; ++frame)
+    {
+        renderers.Frame();
+    }
+    // Renderer 0 became transparent
+    renderers.Batches.Untrack(renderers.States[0]);
+    const auto instance = renderers.GetInstance(1);
+    EXPECT_TRUE(renderers.Batches.Track(renderers.States[1], {&instance, 1}));
+    renderers.Batches.Commit();
+    EXPECT_FALSE(renderers.States[0].Handle.IsValid());
+    EXPECT_EQ(renderers.Batches.GetInstanceCount(), 1);
+    EXPECT_TRUE(renderers.IsStatic(1));
+}
+
+TEST(StaticBatchesTest, RenderersWithSeveralInstances)
+{
+    StaticBatches batches;
+    BindingSet* const bindingSets[] = {reinterpret_cast<BindingSet*>(0x2000)};
+    const DrawState first(*reinterpret_cast<Model*>(0x1000), bindingSets);
+    const DrawState second(*reinterpret_cast<Model*>(0x3000), bindingSets);
+    Data data{1.0f, 1};
+    StaticRenderingState mesh;
+    StaticRenderingState other;
+    auto track = [&](std::span<const StaticBatches::Instance> instances)
+    {
+        const Data otherData{2.0f, 2};
+        const StaticBatches::Instance otherInstance{first, {(const byte*)&otherData, sizeof(Data)}, {}};
+        batches.Track(other, {&otherInstance, 1});
+        const bool tracked = batches.Track(mesh, instances);
+        batches.Commit();
+        return tracked;
+    };
+    const StaticBatches::Instance instances[] = {{first, {(const byte*)&data, sizeof(Data)}, {}},
+                                                 {second, {(const byte*)&data, sizeof(Data)}, {}},
+                                                 {first, {(const byte*)&data, sizeof(Data)}, {}}};
+    for (uint32_t frame = 0; frame <= StaticBatches::FramesToBecomeStatic; ++frame)
+    {
+        track(instances);
+    }
+    EXPECT_EQ(batches.GetBatchCount(), 2);
+    EXPECT_EQ(batches.GetInstanceCount(), 4);
+    EXPECT_TRUE(batches.Matches(mesh.Handle, instances));
+
+    // Different number of instances adds the renderer again. Its old instances move each other, when removed
+    data.Position = 5.0f;
+    EXPECT_TRUE(track(std::span(instances).first(2)));
+    EXPECT_TRUE(batches.Matches(mesh.Handle, std::span(instances).first(2)));
+    EXPECT_EQ(batches.GetInstanceCount(), 3);
+
+    // Changes in two frames in a row make it dynamic
+    EXPECT_TRUE(track(std::span(instances).first(2)));
+    data.Position = 6.0f;
+    EXPECT_TRUE(track(std::span(instances).first(2)));
+    data.Position = 7.0f;
+    EXPECT_FALSE(track(std::span(instances).first(2)));
+    EXPECT_EQ(batches.GetInstanceCount(), 1);
+    const Data otherData{2.0f, 2};
+    const StaticBatches::Instance otherInstance{first, {(const byte*)&otherData, sizeof(Data)}, {}};
+    EXPECT_TRUE(batches.Matches(other.Handle, {&otherInstance, 1}));
+}
@@ -0,0 +1,114 @@
+//
+// Created by alexl on 17.10.2026.
+//
+
+#include <Renderer/TextLayout.h>
+#include <glm/gtc/matrix_transform.hpp>
+#include <gtest/gtest.h>
+
+using namespace BeeEngine;
+
+namespace
+{
+    constexpr float Advance = 0.5f;
+    constexpr float LineHeight = 1.2f;
+
+    FontMetrics::Glyph MakeGlyph(int32_t fontIndex, float advance = Advance)
+    {
+        return {.QuadMin = {0.0f, 0.0f},
+                .QuadMax = {0.4f, 0.8f},
+                .TexCoordMin = {0.1f * fontIndex, 0.0f},
+                .TexCoordMax = {0.1f * fontIndex + 0.05f, 0.1f},
+                .Advance = advance,
+                .FontIndex = fontIndex};
+    }
+
+    /**
+     * Font with 'A', 'V', '?' and a space. Pair "AV" is kerned
+     */
+    FontMetrics MakeMetrics()
+    {
+        FontMetrics metrics;
+        metrics.SetLineHeight(LineHeight);
+        metrics.AddGlyph('A', MakeGlyph(1));
+        metrics.AddGlyph('V', MakeGlyph(2));
+        metrics.AddGlyph('?', MakeGlyph(3));
+        metrics.AddGlyph(' ', MakeGlyph(4, 0.25f));
+        metrics.AddKerning(1, 2, -0.1f);
+        return metrics;
+    }
+} // namespace
+
+TEST(TextLayoutTest, GlyphsAreAdvancedWithKerning)
+{
+    const auto metrics = MakeMetrics();
+    TextLayout layout(UTF8String("AVA"), metrics, {});
+    auto glyphs = layout.GetGlyphs();
+    ASSERT_EQ(glyphs.size(), 3);
+    EXPECT_FLOAT_EQ(glyphs[0].QuadMin.x, 0.0f);
+    EXPECT_FLOAT_EQ(glyphs[1].QuadMin.x, Advance - 0.1f);
+    // "VA" is not kerned
+    EXPECT_FLOAT_EQ(glyphs[2].QuadMin.x, 2 * Advance - 0.1f);
+    EXPECT_EQ(glyphs[1].TexCoordMin, metrics.GetGlyph('V')->TexCoordMin);
+}
+
+TEST(TextLayoutTest, WhitespaceAndConfigurationMoveTheCursor)
+{
+    const auto metrics = MakeMetrics();
+    TextRenderingConfiguration config;
+    config.KerningOffset = 0.05f;
+    config.LineSpacing = 0.3f;
+    TextLayout layout(UTF8String("A A\r\n\tA"), metrics, config);
+    auto glyphs = layout.GetGlyphs();
+    ASSERT_EQ(glyphs.size(), 3);
+    EXPECT_FLOAT_EQ(glyphs[1].QuadMin.x, Advance + 0.25f + 2 * config.KerningOffset);
+    EXPECT_FLOAT_EQ(glyphs[1].QuadMin.y, 0.0f);
+    // Tab is four spaces
+    EXPECT_FLOAT_EQ(glyphs[2].QuadMin.x, 4 * (0.25f + config.KerningOffset));
+    EXPECT_FLOAT_EQ(glyphs[2].QuadMin.y, -(LineHeight + config.LineSpacing));
+}
+
+TEST(TextLayoutTest, MissingGlyphsAreReplaced)
+{
+    const auto metrics = MakeMetrics();
+    TextLayout layout(UTF8String("A\xD0\x96"), metrics, {});
+    auto glyphs = layout.GetGlyphs();
+    ASSERT_EQ(glyphs.size(), 2);
+    EXPECT_EQ(glyphs[1].TexCoordMin, metrics.GetGlyph('?')->TexCoordMin);
+    EXPECT_EQ(metrics.GetGlyph(U'Ж'), nullptr);
+}
+
+TEST(TextLayoutTest, BoundsAndRebuild)
+{
+    const auto metrics = MakeMetrics();
+    TextLayout layout(UTF8String("AA\nA"), metrics, {});
+    const auto& bounds = layout.GetLocalBounds();
+    EXPECT_FLOAT_EQ(bounds.Min.x, 0.0f);
+    EXPECT_FLOAT_EQ(bounds.Max.x, Advance + 0.4f);
+    EXPECT_FLOAT_EQ(bounds.Min.y, -LineHeight);
+    EXPECT_FLOAT_EQ(bounds.Max.y, 0.8f);
+
+    layout.Rebuild(UTF8String("A"), metrics, {});
+    EXPECT_EQ(layout.GetGlyphs().size(), 1);
+    EXPECT_FLOAT_EQ(layout.GetLocalBounds().Max.x, 0.4f);
+
+    layout.Rebuild(UTF8String(" "), metrics, {});
+    EXPECT_TRUE(layout.GetGlyphs().empty());
+    EXPECT_TRUE(layout.GetLocalBounds().IsEmpty());
+}
+
+TEST(TextLayoutTest, InstancedDataIsTransformed)
+{
+    const GlyphQuad glyph{.QuadMin = {0.0f, 0.0f}, .QuadMax = {1.0f, 2.0f}, .TexCoordMin = {0.0f, 0.5f}, .TexCoordMax = {0.5f, 1.0f}};
+    const glm::mat4 transform = glm::translate(glm::mat4(1.0f), glm::vec3(10.0f, 20.0f, 5.0f));
+    TextRenderingConfiguration config;
+    config.ForegroundColor = Color4::Red;
+    const auto data = TextInstancedData::FromGlyph(glyph, transform, config, 7);
+    EXPECT_EQ(data.PositionOffset0, glm::vec3(10.0f, 20.0f, 5.0f));
+    EXPECT_EQ(data.PositionOffset1, glm::vec3(10.0f, 22.0f, 5.0f));
+    EXPECT_EQ(data.PositionOffset2, glm::vec3(11.0f, 22.0f, 5.0f));
+    EXPECT_EQ(data.PositionOffset3, glm::vec3(11.0f, 20.0f, 5.0f));
+    EXPECT_EQ(data.TexCoord1, glm::vec2(0.0f, 1.0f));
+    EXPECT_EQ(data.TexCoord3, glm::vec2(0.5f, 0.5f));
+    EXPECT_EQ(data.EntityID, 7);
+}
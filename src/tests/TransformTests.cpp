@@ -188,3 +188,65 @@ TEST(GetTransformFromToTest, SimpleTransformation) {
     EXPECT_TRUE(AreMatricesEqual(expected, result));
 }
 
+
+static entt::entity CreateTransformEntity(entt::registry& registry, glm::vec3 translation, entt::entity parent = entt::null)
+{
+    auto entity = registry.create();
+    registry.emplace<TransformComponent>(entity, translation);
+    auto& hierarchy = registry.emplace<HierarchyComponent>(entity);
+    if (parent != entt::null)
+    {
+        hierarchy.Parent = Entity{parent, {}};
+        registry.get<HierarchyComponent>(parent).Children.push_back(Entity{entity, {}});
+    }
+    return entity;
+}
+
+TEST(WorldTransformTest, ParentBeforeChildren)
+{
+    entt::registry registry;
+    // Child is created before the parent, so storage order differs from hierarchy order
+    auto grandChild = registry.create();
+    auto root = CreateTransformEntity(registry, {1.0f, 0.0f, 0.0f});
+    auto child = CreateTransformEntity(registry, {0.0f, 2.0f, 0.0f}, root);
+    registry.emplace<TransformComponent>(grandChild, glm::vec3{0.0f, 0.0f, 3.0f});
+    registry.emplace<HierarchyComponent>(grandChild).Parent = Entity{child, {}};
+    registry.get<HierarchyComponent>(child).Children.push_back(Entity{grandChild, {}});
+    registry.get<TransformComponent>(root).Scale = glm::vec3{2.0f};
+
+    UpdateWorldTransforms(registry);
+
+    glm::mat4 expected = registry.get<TransformComponent>(root).GetTransform() *
+                         registry.get<TransformComponent>(child).GetTransform() *
+                         registry.get<TransformComponent>(grandChild).GetTransform();
+    EXPECT_TRUE(AreMatricesEqual(registry.get<WorldTransformComponent>(grandChild).Transform, expected));
+    EXPECT_EQ(glm::vec3(registry.get<WorldTransformComponent>(grandChild).Transform[3]), glm::vec3(1.0f, 4.0f, 6.0f));
+}
+
+TEST(WorldTransformTest, OnlyChangedSubtreesAreUpdated)
+{
+    entt::registry registry;
+    auto root = CreateTransformEntity(registry, {1.0f, 0.0f, 0.0f});
+    auto child = CreateTransformEntity(registry, {0.0f, 1.0f, 0.0f}, root);
+    auto other = CreateTransformEntity(registry, {5.0f, 0.0f, 0.0f});
+    UpdateWorldTransforms(registry);
+
+    // Tamper with the cache to see, which entities are recomputed
+    const glm::mat4 marker(42.0f);
+    registry.get<WorldTransformComponent>(other).Transform = marker;
+    registry.get<WorldTransformComponent>(child).Transform = marker;
+    UpdateWorldTransforms(registry);
+    EXPECT_EQ(registry.get<WorldTransformComponent>(other).Transform, marker);
+    EXPECT_EQ(registry.get<WorldTransformComponent>(child).Transform, marker);
+
+    // Change of the parent propagates to the child, but not to unrelated entities
+    registry.get<TransformComponent>(root).Translation.x = 3.0f;
+    UpdateWorldTransforms(registry);
+    EXPECT_EQ(registry.get<WorldTransformComponent>(other).Transform, marker);
+    EXPECT_EQ(glm::vec3(registry.get<WorldTransformComponent>(child).Transform[3]), glm::vec3(3.0f, 1.0f, 0.0f));
+
+    // Dirty flag forces the update even if the local transform is the same
+    registry.get<WorldTransformComponent>(other).Dirty = true;
+    UpdateWorldTransforms(registry);
+    EXPECT_EQ(glm::vec3(registry.get<WorldTransformComponent>(other).Transform[3]), glm::vec3(5.0f, 0.0f, 0.0f));
+}
@@ -9,6 +9,9 @@ using namespace BeeEngine;
 gsl::not_null<Application*> BeeEngine::CreateApplication(const ApplicationArgs& args)
 {
     auto windowProperties = BeeEngine::ApplicationProperties{1280, 720, "BeeEngineTests", VSync::On};
+#if defined(BEE_TEST_HEADLESS)
+    windowProperties.PreferredRenderAPI = RenderAPI::Null;
+#endif
     int argc = args.GetArgc();
     testing::InitGoogleTest(&argc, args.GetArgv());
     auto* app = new TestApplication(windowProperties);